@@ -435,14 +435,25 @@ void Cluster_impl::execute_in_members(
                              const Instance_md_and_gr_member &info)>
         &on_connect_error) const {
   auto instance_definitions = get_instances_with_state(true);
-  auto ipool = current_ipool();
+
+  std::vector<std::string> endpoints;
+  endpoints.reserve(instance_definitions.size());
 
   for (const auto &i : instance_definitions) {
+    endpoints.emplace_back(i.first.endpoint);
+  }
+
+  // connect to all members at once, callbacks are still executed one by one,
+  // in the order of the members
+  auto sessions = current_ipool()->connect_unchecked_endpoints(endpoints);
+  std::size_t idx = 0;
+
+  for (const auto &i : instance_definitions) {
+    auto &session = sessions[idx++];
     Scoped_instance instance_session;
 
     try {
-      instance_session =
-          Scoped_instance(ipool->connect_unchecked_endpoint(i.first.endpoint));
+      instance_session = Scoped_instance(session.get());
     } catch (const shcore::Error &e) {
       if (on_connect_error) {
         if (!on_connect_error(e, i)) break;
@@ -3867,6 +3878,9 @@ mysqlshdk::mysql::Lock_scoped Cluster_impl::get_lock(
               m_cluster_server->descr().c_str());
     mysqlshdk::mysql::get_lock(*m_cluster_server, k_lock_ns, k_lock_name, mode,
                                timeout.count());
+
+    // metadata cached before the lock was held may be stale
+    MetadataStorage::revalidate_read_caches();
   } catch (const shcore::Error &err) {
     // Abort the operation in case the required lock cannot be acquired.
     log_info("Failed to get %s lock ('%s', '%s') on '%s': %s",
@@ -28,6 +28,7 @@
 #include <set>
 #include <utility>
 
+#include "modules/adminapi/common/instance_pool.h"
 #include "modules/adminapi/common/metadata_storage.h"
 #include "modules/adminapi/common/preconditions.h"
 #include "modules/adminapi/common/validations.h"
@@ -104,21 +105,35 @@ void Rescan::ensure_unavailable_instances_not_auto_rejoining(
   mysqlshdk::db::Connection_options group_conn_opt =
       m_cluster->get_cluster_server()->get_connection_options();
 
+  std::vector<mysqlshdk::db::Connection_options> instances_conn_opts;
+  instances_conn_opts.reserve(unavailable_instances.size());
+
+  for (const auto &i : unavailable_instances) {
+    auto instance_conn_opt = mysqlshdk::db::Connection_options(i.endpoint);
+    instance_conn_opt.set_login_options_from(group_conn_opt);
+    instances_conn_opts.emplace_back(std::move(instance_conn_opt));
+  }
+
+  // check all the instances at once
+  const auto rejoining = member_fan_out<bool>(
+      instances_conn_opts,
+      [](const mysqlshdk::db::Connection_options &instance_conn_opt) {
+        auto instance = Instance::connect_raw(instance_conn_opt);
+        return mysqlshdk::gr::is_running_gr_auto_rejoin(*instance);
+      });
+
   auto console = mysqlsh::current_console();
   auto it = unavailable_instances.begin();
+  std::size_t idx = 0;
+
   while (it != unavailable_instances.end()) {
-    auto instance_conn_opt = mysqlshdk::db::Connection_options(it->endpoint);
-    instance_conn_opt.set_login_options_from(group_conn_opt);
-    bool is_rejoining = false;
-    try {
-      auto instance = Instance::connect_raw(instance_conn_opt);
-      is_rejoining = mysqlshdk::gr::is_running_gr_auto_rejoin(*instance);
-    } catch (const std::exception &e) {
-      // if you cant connect to the instance then we assume it really is offline
-      // or unreachable and it is not auto-rejoining
-    }
+    const auto &instance_conn_opt = instances_conn_opts[idx];
+    const auto &result = rejoining[idx++];
 
-    if (is_rejoining) {
+    // if you cant connect to the instance (or it does not respond in time)
+    // then we assume it really is offline or unreachable and it is not
+    // auto-rejoining
+    if (result.value.value_or(false)) {
       console->print_warning(
           "The instance '" + instance_conn_opt.uri_endpoint() +
           "' is MISSING but currently trying to auto-rejoin.");
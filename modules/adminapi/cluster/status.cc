@@ -24,10 +24,12 @@
 #include "modules/adminapi/cluster/status.h"
 
 #include <algorithm>
+#include <map>
 
 #include "modules/adminapi/cluster_set/cluster_set_impl.h"
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/common_status.h"
+#include "modules/adminapi/common/instance_pool.h"
 #include "modules/adminapi/common/metadata_storage.h"
 #include "modules/adminapi/common/parallel_applier_options.h"
 #include "modules/adminapi/common/server_features.h"
@@ -117,14 +119,22 @@ Status::Status(const Cluster_impl &cluster, std::optional<uint64_t> extended)
 Status::~Status() = default;
 
 void Status::connect_to_members() {
-  auto ipool = current_ipool();
+  std::vector<std::string> endpoints;
+  endpoints.reserve(m_instances.size());
 
   for (const auto &inst : m_instances) {
+    endpoints.emplace_back(inst.endpoint);
+  }
+
+  const auto results = current_ipool()->connect_unchecked_endpoints(endpoints);
+
+  for (std::size_t i = 0; i < endpoints.size(); ++i) {
     try {
-      m_member_sessions[inst.endpoint] =
-          ipool->connect_unchecked_endpoint(inst.endpoint);
+      m_member_sessions[endpoints[i]] = results[i].get();
     } catch (const shcore::Error &e) {
-      m_member_connect_errors[inst.endpoint] = e.format();
+      m_member_connect_errors[endpoints[i]] = e.format();
+    } catch (const std::exception &e) {
+      m_member_connect_errors[endpoints[i]] = e.what();
     }
   }
 }
@@ -454,11 +464,13 @@ LIMIT
 
 /**
  * Similar to collect_local_status(), but only includes basic/important
- * stats that should be displayed in the default output.
+ * stats that should be displayed in the default output. primary_cluster is
+ * set if the cluster belongs to a ClusterSet, true if it's the primary one.
  */
 void Status::collect_basic_local_status(shcore::Dictionary_t dict,
                                         const mysqlsh::dba::Instance &instance,
-                                        bool is_primary) {
+                                        bool is_primary,
+                                        std::optional<bool> primary_cluster) {
   using mysqlshdk::utils::Version;
 
   auto version = instance.get_version();
@@ -472,14 +484,14 @@ void Status::collect_basic_local_status(shcore::Dictionary_t dict,
   std::string sql;
 
   if (version >= Version(8, 0, 0)) {
-    if (m_cluster.is_cluster_set_member()) {
+    if (primary_cluster.has_value()) {
       // PRIMARY of PC has no relevant replication lag info
       // PRIMARY of RC shows lag from clusterset_replication channel
       // SECONDARY members show replication from gr_applier channel
       std::string channel_name;
 
       if (is_primary) {
-        if (!m_cluster.is_primary_cluster()) {
+        if (!*primary_cluster) {
           channel_name = k_clusterset_async_channel_name;
         }
       } else {
@@ -1334,6 +1346,147 @@ shcore::Array_t validate_instance_recovery_user(
 }
 }  // namespace
 
+// What needs to be known about a member before it's probed, read in the
+// caller's thread.
+struct Status::Member_probe_request {
+  std::shared_ptr<Instance> instance;
+  // state and role reported by the group
+  mysqlshdk::gr::Member_state state = mysqlshdk::gr::Member_state::MISSING;
+  bool is_primary = false;
+  // set if the cluster belongs to a ClusterSet, true if it's the primary one
+  std::optional<bool> primary_cluster;
+  // time when the member joined the cluster, as stored in the metadata
+  std::string join_time;
+  std::optional<uint64_t> extended;
+};
+
+// State of a member which is read using only the member's own session, so
+// that all members can be queried concurrently.
+struct Status::Member_probe {
+  Parallel_applier_options parallel_applier_options;
+  std::optional<bool> super_read_only;
+  std::optional<bool> offline_mode;
+  std::optional<std::string> persisted_offline_mode;
+  bool auto_rejoin = false;
+  mysqlshdk::gr::Member_state self_state = mysqlshdk::gr::Member_state::MISSING;
+  std::string version;
+  std::vector<std::string> fence_sysvars;
+  mysqlshdk::mysql::Replication_channel recovery_channel;
+  mysqlshdk::mysql::Replication_channel applier_channel;
+  // replication stats and recovery progress, added to the member's status
+  shcore::Dictionary_t status = shcore::make_dict();
+};
+
+Status::Member_probe Status::probe_member(
+    const Member_probe_request &request) {
+  using mysqlshdk::gr::Member_state;
+  using mysqlshdk::mysql::Replication_channel;
+
+  const auto &instance = *request.instance;
+  const auto &extended = request.extended;
+  Member_probe probe;
+
+  // Get the current parallel-applier options
+  probe.parallel_applier_options = Parallel_applier_options(instance);
+
+  // Get super_read_only value of each instance to set the mode accurately.
+  probe.super_read_only = instance.get_sysvar_bool("super_read_only");
+
+  // Get offline_mode value of each instance to set the mode accurately.
+  probe.offline_mode = instance.get_sysvar_bool("offline_mode");
+
+  if (!probe.offline_mode.value_or(false) &&
+      instance.is_set_persist_supported()) {
+    probe.persisted_offline_mode = instance.get_persisted_value("offline_mode");
+  }
+
+  // Check if auto-rejoin is running.
+  probe.auto_rejoin = mysqlshdk::gr::is_running_gr_auto_rejoin(instance);
+
+  probe.self_state = mysqlshdk::gr::get_member_state(instance);
+
+  probe.version = instance.get_version().get_base();
+
+  if (!extended.has_value()) return probe;
+
+  if (*extended >= 1) {
+    probe.fence_sysvars = instance.get_fence_sysvars();
+  }
+
+  const auto has_recovery_channel = mysqlshdk::mysql::get_channel_status(
+      instance, mysqlshdk::gr::k_gr_recovery_channel, &probe.recovery_channel);
+
+  const auto has_applier_channel = mysqlshdk::mysql::get_channel_status(
+      instance, mysqlshdk::gr::k_gr_applier_channel, &probe.applier_channel);
+
+  if (*extended >= 3) {
+    collect_local_status(probe.status, instance,
+                         request.state == Member_state::RECOVERING);
+  }
+
+  if (request.state == Member_state::ONLINE) {
+    collect_basic_local_status(probe.status, instance, request.is_primary,
+                               request.primary_cluster);
+  }
+
+  shcore::Value recovery_info;
+
+  if (request.state == Member_state::RECOVERING) {
+    std::string status;
+    std::tie(status, recovery_info) =
+        recovery_status(instance, request.join_time);
+
+    if (!status.empty()) {
+      (*probe.status)["recoveryStatusText"] = shcore::Value(status);
+    }
+  }
+
+  // Include recovery channel info if RECOVERING or if there's an error
+  if (has_recovery_channel && *extended > 0) {
+    if (request.state == Member_state::RECOVERING ||
+        probe.recovery_channel.status() != Replication_channel::OFF) {
+      mysqlshdk::mysql::Replication_channel_master_info master_info;
+      mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
+
+      mysqlshdk::mysql::get_channel_info(instance,
+                                         mysqlshdk::gr::k_gr_recovery_channel,
+                                         &master_info, &relay_info);
+
+      if (!recovery_info) recovery_info = shcore::Value::new_map();
+
+      (*recovery_info.as_map())["recoveryChannel"] =
+          shcore::Value(channel_status(&probe.recovery_channel, &master_info,
+                                       &relay_info, "", *extended - 1, true,
+                                       false));
+    }
+  }
+
+  if (recovery_info) (*probe.status)["recovery"] = recovery_info;
+
+  // Include applier channel info ONLINE and channel not ON
+  // or != RECOVERING and channel not OFF
+  if (has_applier_channel && *extended > 0) {
+    if ((probe.self_state == Member_state::ONLINE &&
+         probe.applier_channel.status() != Replication_channel::ON) ||
+        (probe.self_state != Member_state::RECOVERING &&
+         probe.self_state != Member_state::ONLINE &&
+         probe.applier_channel.status() != Replication_channel::OFF)) {
+      mysqlshdk::mysql::Replication_channel_master_info master_info;
+      mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
+
+      mysqlshdk::mysql::get_channel_info(instance,
+                                         mysqlshdk::gr::k_gr_applier_channel,
+                                         &master_info, &relay_info);
+
+      (*probe.status)["applierChannel"] = shcore::Value(
+          channel_status(&probe.applier_channel, &master_info, &relay_info, "",
+                         *extended - 1, false, false));
+    }
+  }
+
+  return probe;
+}
+
 shcore::Dictionary_t Status::get_topology(
     const std::vector<mysqlshdk::gr::Member> &member_info) {
   using mysqlshdk::gr::Member_role;
@@ -1352,6 +1505,8 @@ shcore::Dictionary_t Status::get_topology(
   };
 
   std::vector<Instance_metadata_info> instances;
+  std::vector<std::pair<std::string, mysqlshdk::db::Connection_options>>
+      unmanaged;
 
   // add placeholders for unmanaged members
   for (const auto &m : member_info) {
@@ -1398,21 +1553,38 @@ shcore::Dictionary_t Status::get_topology(
       log_debug("Instance %s with uuid=%s found in group but not in MD",
                 mdi.md.address.c_str(), m.uuid.c_str());
 
-      auto group_instance = m_cluster.get_cluster_server();
-
       mysqlshdk::db::Connection_options opts(mdi.md.endpoint);
-      mysqlshdk::db::Connection_options group_session_copts(
-          group_instance->get_connection_options());
-      opts.set_login_options_from(group_session_copts);
-      try {
-        m_member_sessions[mdi.md.endpoint] = Instance::connect(opts);
-      } catch (const shcore::Error &e) {
-        m_member_connect_errors[mdi.md.endpoint] = e.format();
-      }
+      opts.set_login_options_from(
+          m_cluster.get_cluster_server()->get_connection_options());
+      unmanaged.emplace_back(mdi.md.endpoint, std::move(opts));
 
       instances.emplace_back(std::move(mdi));
     }
   }
+
+  // connect to the unmanaged members at once, using the credentials of the
+  // group session
+  const auto connected = member_fan_out<std::shared_ptr<Instance>>(
+      unmanaged, [](const auto &endpoint) {
+        return Instance::connect(endpoint.second);
+      });
+
+  for (std::size_t i = 0; i < connected.size(); ++i) {
+    const auto &endpoint = unmanaged[i].first;
+
+    if (connected[i].timed_out) {
+      log_warning("Timed out while connecting to '%s'", endpoint.c_str());
+      m_member_connect_errors[endpoint] =
+          "Timed out while connecting to the instance";
+      continue;
+    }
+
+    try {
+      m_member_sessions[endpoint] = connected[i].get();
+    } catch (const shcore::Error &e) {
+      m_member_connect_errors[endpoint] = e.format();
+    }
+  }
   // look for instances in MD but not in group
   for (const auto &i : m_instances) {
     bool found = false;
@@ -1454,6 +1626,67 @@ shcore::Dictionary_t Status::get_topology(
   auto mismatched_recovery_accounts =
       m_cluster.get_mismatched_recovery_accounts();
 
+  // query all the members at once, the rest of the status is collected in the
+  // same order as before
+  std::optional<bool> primary_cluster;
+
+  if (m_cluster.is_cluster_set_member()) {
+    primary_cluster = m_cluster.is_primary_cluster();
+  }
+
+  std::vector<Member_probe_request> requests;
+  std::vector<std::string> reachable_endpoints;
+
+  for (const auto &inst : instances) {
+    if (const auto &instance = m_member_sessions[inst.md.endpoint]) {
+      const auto minfo = get_member(inst.actual_server_uuid);
+      Member_probe_request request;
+
+      request.instance = instance;
+      request.state = minfo.state;
+      request.is_primary = minfo.role == Member_role::PRIMARY;
+      request.primary_cluster = primary_cluster;
+      request.extended = m_extended;
+
+      if (m_extended.has_value() && minfo.state == Member_state::RECOVERING) {
+        // Get the join timestamp from the Metadata
+        shcore::Value join_time;
+        m_cluster.get_metadata_storage()->query_instance_attribute(
+            instance->get_uuid(), k_instance_attribute_join_time, &join_time);
+
+        if (join_time.type == shcore::String) {
+          request.join_time = join_time.as_string();
+        }
+      }
+
+      requests.emplace_back(std::move(request));
+      reachable_endpoints.emplace_back(inst.md.endpoint);
+    }
+  }
+
+  const auto results = member_fan_out<Member_probe>(
+      requests, [](const Member_probe_request &request) {
+        return probe_member(request);
+      });
+
+  std::map<std::string, Member_probe> probes;
+
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const auto &endpoint = reachable_endpoints[i];
+
+    if (results[i].timed_out) {
+      // session is still in use by the abandoned thread, member is reported
+      // as unreachable
+      log_warning("Timed out while querying the status of '%s'",
+                  endpoint.c_str());
+      m_member_sessions[endpoint].reset();
+      m_member_connect_errors[endpoint] =
+          "Timed out while querying the status of the instance";
+    } else {
+      probes.emplace(endpoint, results[i].get());
+    }
+  }
+
   for (const auto &inst : instances) {
     shcore::Dictionary_t member = shcore::make_dict();
     mysqlshdk::gr::Member minfo(get_member(inst.actual_server_uuid));
@@ -1471,27 +1704,23 @@ shcore::Dictionary_t Status::get_topology(
     Replication_channel recovery_channel;
 
     Parallel_applier_options parallel_applier_options;
+    std::optional<std::string> persisted_offline_mode;
 
     if (instance) {
-      // Get the current parallel-applier options
-      parallel_applier_options = Parallel_applier_options(*instance);
-
-      // Get super_read_only value of each instance to set the mode accurately.
-      super_read_only = instance->get_sysvar_bool("super_read_only");
-
-      // Get offline_mode value of each instance to set the mode accurately.
-      offline_mode = instance->get_sysvar_bool("offline_mode");
-
-      // Check if auto-rejoin is running.
-      auto_rejoin = mysqlshdk::gr::is_running_gr_auto_rejoin(*instance);
+      auto &probe = probes.at(inst.md.endpoint);
 
-      self_state = mysqlshdk::gr::get_member_state(*instance);
-
-      minfo.version = instance->get_version().get_base();
+      parallel_applier_options = std::move(probe.parallel_applier_options);
+      super_read_only = probe.super_read_only;
+      offline_mode = probe.offline_mode;
+      auto_rejoin = probe.auto_rejoin;
+      self_state = probe.self_state;
+      minfo.version = std::move(probe.version);
+      applier_channel = std::move(probe.applier_channel);
+      recovery_channel = std::move(probe.recovery_channel);
 
       if (m_extended.has_value()) {
         if (*m_extended >= 1) {
-          fence_sysvars = instance->get_fence_sysvars();
+          fence_sysvars = std::move(probe.fence_sysvars);
 
           auto workers = parallel_applier_options.replica_parallel_workers;
 
@@ -1501,78 +1730,12 @@ shcore::Dictionary_t Status::get_topology(
           }
         }
 
-        if (*m_extended >= 3) {
-          collect_local_status(member, *instance,
-                               minfo.state == Member_state::RECOVERING);
-        }
-        if (minfo.state == Member_state::ONLINE)
-          collect_basic_local_status(member, *instance,
-                                     minfo.role == Member_role::PRIMARY);
-
-        shcore::Value recovery_info;
-        if (minfo.state == Member_state::RECOVERING) {
-          std::string status;
-          // Get the join timestamp from the Metadata
-          shcore::Value join_time;
-          m_cluster.get_metadata_storage()->query_instance_attribute(
-              instance->get_uuid(), k_instance_attribute_join_time, &join_time);
-
-          std::tie(status, recovery_info) = recovery_status(
-              *instance,
-              join_time.type == shcore::String ? join_time.as_string() : "");
-          if (!status.empty()) {
-            (*member)["recoveryStatusText"] = shcore::Value(status);
-          }
-        }
-
-        // Include recovery channel info if RECOVERING or if there's an error
-        if (mysqlshdk::mysql::get_channel_status(
-                *instance, mysqlshdk::gr::k_gr_recovery_channel,
-                &recovery_channel) &&
-            *m_extended > 0) {
-          if (minfo.state == Member_state::RECOVERING ||
-              recovery_channel.status() != Replication_channel::OFF) {
-            mysqlshdk::mysql::Replication_channel_master_info master_info;
-            mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
-
-            mysqlshdk::mysql::get_channel_info(
-                *instance, mysqlshdk::gr::k_gr_recovery_channel, &master_info,
-                &relay_info);
-
-            if (!recovery_info) recovery_info = shcore::Value::new_map();
-
-            (*recovery_info.as_map())["recoveryChannel"] = shcore::Value(
-                channel_status(&recovery_channel, &master_info, &relay_info, "",
-                               *m_extended - 1, true, false));
-          }
-        }
-        if (recovery_info) (*member)["recovery"] = recovery_info;
-
-        // Include applier channel info ONLINE and channel not ON
-        // or != RECOVERING and channel not OFF
-        if (mysqlshdk::mysql::get_channel_status(
-                *instance, mysqlshdk::gr::k_gr_applier_channel,
-                &applier_channel) &&
-            *m_extended > 0) {
-          if ((self_state == Member_state::ONLINE &&
-               applier_channel.status() != Replication_channel::ON) ||
-              (self_state != Member_state::RECOVERING &&
-               self_state != Member_state::ONLINE &&
-               applier_channel.status() != Replication_channel::OFF)) {
-            mysqlshdk::mysql::Replication_channel_master_info master_info;
-            mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
-
-            mysqlshdk::mysql::get_channel_info(
-                *instance, mysqlshdk::gr::k_gr_applier_channel, &master_info,
-                &relay_info);
-
-            (*member)["applierChannel"] = shcore::Value(
-                channel_status(&applier_channel, &master_info, &relay_info, "",
-                               *m_extended - 1, false, false));
-          }
+        for (auto &entry : *probe.status) {
+          (*member)[entry.first] = std::move(entry.second);
         }
       }
 
+      persisted_offline_mode = std::move(probe.persisted_offline_mode);
     } else {
       (*member)["shellConnectError"] =
           shcore::Value(m_member_connect_errors[inst.md.endpoint]);
@@ -1590,15 +1753,13 @@ shcore::Dictionary_t Status::get_topology(
       if (offline_mode.value_or(false)) {
         issues->push_back(
             shcore::Value("WARNING: Instance has 'offline_mode' enabled."));
-      } else if (instance && instance->is_set_persist_supported()) {
-        auto value = instance->get_persisted_value("offline_mode");
-        if (value.has_value() && shcore::str_caseeq(*value, "ON")) {
-          issues->push_back(shcore::Value(
-              "WARNING: Instance has 'offline_mode' enabled and persisted. In "
-              "the event that this instance becomes a primary, Shell or other "
-              "members will be prevented from connecting to it disrupting the "
-              "Cluster's normal functioning."));
-        }
+      } else if (persisted_offline_mode.has_value() &&
+                 shcore::str_caseeq(*persisted_offline_mode, "ON")) {
+        issues->push_back(shcore::Value(
+            "WARNING: Instance has 'offline_mode' enabled and persisted. In "
+            "the event that this instance becomes a primary, Shell or other "
+            "members will be prevented from connecting to it disrupting the "
+            "Cluster's normal functioning."));
       }
 
       if (instance) {
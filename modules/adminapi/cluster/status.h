@@ -129,19 +129,27 @@ class Status : public Command_interface {
       const mysqlshdk::db::Row_ref_by_name &row, const std::string &prefix,
       const std::string &what);
 
-  shcore::Value connection_status(const mysqlshdk::db::Row_ref_by_name &row);
+  static shcore::Value connection_status(
+      const mysqlshdk::db::Row_ref_by_name &row);
 
-  shcore::Value coordinator_status(const mysqlshdk::db::Row_ref_by_name &row);
+  static shcore::Value coordinator_status(
+      const mysqlshdk::db::Row_ref_by_name &row);
 
-  shcore::Value applier_status(const mysqlshdk::db::Row_ref_by_name &row);
+  static shcore::Value applier_status(
+      const mysqlshdk::db::Row_ref_by_name &row);
 
-  void collect_basic_local_status(shcore::Dictionary_t dict,
-                                  const mysqlsh::dba::Instance &instance,
-                                  bool is_primary);
+  static void collect_basic_local_status(
+      shcore::Dictionary_t dict, const mysqlsh::dba::Instance &instance,
+      bool is_primary, std::optional<bool> primary_cluster);
 
-  void collect_local_status(shcore::Dictionary_t dict,
-                            const mysqlsh::dba::Instance &instance,
-                            bool recovering);
+  static void collect_local_status(shcore::Dictionary_t dict,
+                                   const mysqlsh::dba::Instance &instance,
+                                   bool recovering);
+
+  struct Member_probe_request;
+  struct Member_probe;
+
+  static Member_probe probe_member(const Member_probe_request &request);
 
   void feed_metadata_info(shcore::Dictionary_t dict,
                           const Instance_metadata &info);
@@ -746,19 +746,18 @@ bool Cluster_set_impl::check_gtid_consistency(Cluster_impl *cluster) const {
           *cluster->get_cluster_server(), k_clusterset_async_channel_name);
 
   // exclude gtids from view changes
-  my_gtid_set.subtract(my_gtid_set.get_gtids_from(my_view_change_uuid),
-                       *cluster->get_cluster_server());
+  my_gtid_set.subtract(my_gtid_set.get_gtids_from(my_view_change_uuid));
 
   // exclude gtids that were received by the async channel, just in case we got
   // GTIDs that haven't been exposed to GTID_EXECUTED in the source yet
-  my_gtid_set.subtract(my_received_gtid_set, *cluster->get_cluster_server());
+  my_gtid_set.subtract(my_received_gtid_set);
 
   // always query GTID_EXECUTED from source after replica
   auto source_gtid_set =
       mysqlshdk::mysql::Gtid_set::from_gtid_executed(*get_primary_master());
 
   auto errants = my_gtid_set;
-  errants.subtract(source_gtid_set, *cluster->get_cluster_server());
+  errants.subtract(source_gtid_set);
 
   if (!errants.empty()) {
     log_warning(
@@ -2394,7 +2393,7 @@ void Cluster_set_impl::reconcile_view_change_gtids(
     gtid_set =
         Gtid_set::from_gtid_executed(*replica).get_gtids_from(view_change_uuid);
 
-    gtid_set.subtract(primary_gtid_set, *replica);
+    gtid_set.subtract(primary_gtid_set);
   }
 
   log_info(
@@ -2570,7 +2569,7 @@ void Cluster_set_impl::check_gtid_set_most_recent(
 
         auto view_changes = gtid_set.get_gtids_from(uuid);
         if (out_view_changes) *out_view_changes = view_changes;
-        return gtid_set.subtract(view_changes, *instance);
+        return gtid_set.subtract(view_changes);
       };
 
   mysqlshdk::mysql::Gtid_set promoted_view_changes;
@@ -2587,13 +2586,13 @@ void Cluster_set_impl::check_gtid_set_most_recent(
     if (primary->get_uuid() != promoted->get_uuid()) {
       auto gtid_set = get_filtered_gtid_set(primary.get(), nullptr);
 
-      gtid_set.subtract(promoted_view_changes, *promoted);
+      gtid_set.subtract(promoted_view_changes);
 
-      if (!promoted_gtid_set.contains(gtid_set, *promoted)) {
+      if (!promoted_gtid_set.contains(gtid_set)) {
         console->print_note("Cluster " + i->get_name() +
                             " has a more up-to-date GTID set");
 
-        promoted_gtid_set.subtract(gtid_set, *promoted);
+        promoted_gtid_set.subtract(gtid_set);
 
         console->print_info(
             "The following GTIDs are missing from the target cluster: " +
@@ -2847,7 +2846,7 @@ void Cluster_set_impl::ensure_transaction_set_consistent_and_recoverable(
   }
 
   mysqlshdk::mysql::compute_joining_replica_gtid_state(
-      *primary, mysqlshdk::mysql::Gtid_set::from_gtid_executed(*primary),
+      mysqlshdk::mysql::Gtid_set::from_gtid_executed(*primary),
       purged_gtids, mysqlshdk::mysql::Gtid_set::from_gtid_executed(*replica),
       allowed_errant_uuids, &missing_gtids, &unrecoverable_gtids, &errant_gtids,
       &missing_view_gtids);
@@ -3122,6 +3121,9 @@ mysqlshdk::mysql::Lock_scoped Cluster_set_impl::get_lock(
               m_primary_master->descr().c_str());
     mysqlshdk::mysql::get_lock(*m_primary_master, k_lock_ns, k_lock_name, mode,
                                timeout.count());
+
+    // metadata cached before the lock was held may be stale
+    MetadataStorage::revalidate_read_caches();
   } catch (const shcore::Error &err) {
     // Abort the operation in case the required lock cannot be acquired.
     log_info("Failed to get %s lock ('%s', '%s') on '%s': %s",
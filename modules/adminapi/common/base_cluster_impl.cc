@@ -104,7 +104,9 @@ void Base_cluster_impl::check_preconditions(
   log_debug("Checking '%s' preconditions.", function_name.c_str());
   bool primary_available = false;
 
-  // Makes sure the metadata state is re-loaded on each API call
+  // Makes sure the metadata state is re-loaded on each API call, cached
+  // metadata reads are revalidated
+  m_metadata_storage->enable_read_cache();
   m_metadata_storage->invalidate_cached();
 
   // Makes sure the primary master is reset before acquiring it on each API call
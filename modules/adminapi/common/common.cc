@@ -1746,7 +1746,6 @@ std::string resolve_gr_local_address(
 }
 
 std::vector<Instance_gtid_info> filter_primary_candidates(
-    const mysqlshdk::mysql::IInstance &server,
     const std::vector<Instance_gtid_info> &gtid_info,
     const std::function<bool(const Instance_gtid_info &,
                              const Instance_gtid_info &)> &on_conflit) {
@@ -1763,7 +1762,7 @@ std::vector<Instance_gtid_info> filter_primary_candidates(
     if (freshest_instance == &inst) continue;  // ignore the first
 
     auto rel = mysqlshdk::mysql::compare_gtid_sets(
-        server, freshest_instance->gtid_executed, inst.gtid_executed);
+        freshest_instance->gtid_executed, inst.gtid_executed);
 
     switch (rel) {
       // Conflicting GTID sets
@@ -1974,7 +1973,7 @@ bool wait_for_gtid_set_safe(const mysqlshdk::mysql::IInstance &target_instance,
     auto gtid_set_target =
         mysqlshdk::mysql::Gtid_set::from_gtid_executed(target_instance);
     missing_transactions = mysqlshdk::mysql::estimate_gtid_set_size(
-        gtid_set_primary.subtract(gtid_set_target, target_instance));
+        gtid_set_primary.subtract(gtid_set_target));
 
     update_progress(progress_bar.get(), total_transactions_primary,
                     missing_transactions);
@@ -1988,7 +1987,7 @@ bool wait_for_gtid_set_safe(const mysqlshdk::mysql::IInstance &target_instance,
           mysqlshdk::mysql::Gtid_set::from_gtid_executed(target_instance);
 
       missing_transactions = mysqlshdk::mysql::estimate_gtid_set_size(
-          gtid_set_primary.subtract(gtid_set_target, target_instance));
+          gtid_set_primary.subtract(gtid_set_target));
 
       switch (progress_reporting) {
         case Progress_reporting::PROGRESSBAR: {
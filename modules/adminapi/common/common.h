@@ -620,14 +620,11 @@ struct Instance_gtid_info {
  * An exception will be thrown if any instance with a conflicting transaction
  * set is found.
  *
- * @param server - a server in which GTID set operations will be evaluated.
- * The server doesn't need to be related to the candidates being checked.
  * @param gtid_info - a list of candidates instances with their
  * @@GTID_EXECUTED data.
  * @returns list of instances that could become a PRIMARY.
  */
 std::vector<Instance_gtid_info> filter_primary_candidates(
-    const mysqlshdk::mysql::IInstance &server,
     const std::vector<Instance_gtid_info> &gtid_info,
     const std::function<bool(const Instance_gtid_info &,
                              const Instance_gtid_info &)> &on_conflit);
@@ -26,10 +26,18 @@
 #include <mysql.h>
 #include <mysqld_error.h>
 
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "modules/adminapi/common/instance_monitoring.h"
+#include "modules/adminapi/common/instance_pool.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/mysql/async_replication.h"
 #include "mysqlshdk/libs/mysql/replication.h"
@@ -41,6 +49,10 @@ namespace dba {
 
 namespace {
 
+using detail::Channel_check;
+using detail::Check_account_holder;
+using detail::Check_lane;
+
 // replication errors that indicate the connection check succeeded
 constexpr const int k_successful_errors[] = {
 #ifdef ER_SLAVE_FATAL_ERROR
@@ -240,114 +252,324 @@ void downgrade_temp_account_to_issuer_only(
   instance.executef("ALTER USER ?@'%' REQUIRE ISSUER ?", username, cert_issuer);
 }
 
+// name of the replication channel used by the checks
+constexpr const char k_test_channel[] = "mysqlsh.test";
+
+// value of slave_net_timeout (seconds) while the checks are running, this is
+// also the connect timeout of the test channel
+constexpr int k_test_net_timeout = 5;
+
+// maximum time a single check can take, in case the receiver gets stuck while
+// connecting
+constexpr std::chrono::milliseconds k_check_timeout{
+    4 * k_test_net_timeout * 1000};
+
+// the state of the test channel is checked often at first, so that the
+// latency of fast connections is measured with good resolution
+constexpr std::chrono::milliseconds k_check_min_poll_interval{10};
+constexpr std::chrono::milliseconds k_check_max_poll_interval{200};
+
+bool is_successful_error(int code) {
+  return code == 0 ||
+         std::find(std::begin(k_successful_errors),
+                   std::end(k_successful_errors),
+                   code) != std::end(k_successful_errors);
+}
+
 mysqlshdk::mysql::Replication_channel::Error try_connect_channel(
     const mysqlshdk::mysql::IInstance &from_instance,
-    std::string_view to_address) {
-  mysqlshdk::mysql::start_replication_receiver(from_instance, "mysqlsh.test");
+    std::string_view to_address, std::chrono::milliseconds *latency) {
+  const auto start = std::chrono::steady_clock::now();
+  const auto deadline = start + k_check_timeout;
+
+  mysqlshdk::mysql::start_replication_receiver(from_instance, k_test_channel);
+
+  // same as mysqlshdk::mysql::wait_replication_done_connecting(), but bounded
+  Poll_interval interval{k_check_min_poll_interval, k_check_max_poll_interval};
+  mysqlshdk::mysql::Replication_channel channel;
+
+  while (true) {
+    if (!mysqlshdk::mysql::get_channel_status(from_instance, k_test_channel,
+                                              &channel)) {
+      throw std::runtime_error(
+          "Replication channel could not be found at the instance");
+    }
+
+    if (channel.receiver.state !=
+            mysqlshdk::mysql::Replication_channel::Receiver::CONNECTING ||
+        channel.receiver.last_error.code != 0)
+      break;
+
+    if (std::chrono::steady_clock::now() >= deadline) {
+      throw shcore::Exception::runtime_error(shcore::str_format(
+          "Timeout waiting for the connection check from '%s' to '%.*s'",
+          from_instance.descr().c_str(), static_cast<int>(to_address.size()),
+          to_address.data()));
+    }
+
+    shcore::sleep_ms(interval.next(false).count());
+  }
 
-  auto channel = mysqlshdk::mysql::wait_replication_done_connecting(
-      from_instance, "mysqlsh.test");
+  *latency = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
 
-  log_info("Connection check %s -> %.*s io_state=%s io_error=%s",
+  log_info("Connection check %s -> %.*s io_state=%s io_error=%s (%lims)",
            from_instance.descr().c_str(), static_cast<int>(to_address.size()),
            to_address.data(),
            mysqlshdk::mysql::to_string(channel.receiver.state).c_str(),
-           mysqlshdk::mysql::to_string(channel.receiver.last_error).c_str());
+           mysqlshdk::mysql::to_string(channel.receiver.last_error).c_str(),
+           static_cast<long>(latency->count()));
 
   return channel.receiver.last_error;
 }
 
+// settings shared by all the checks
+struct Check_settings {
+  Cluster_ssl_mode ssl_mode;
+  Replication_auth_type member_auth;
+  std::string cert_issuer;
+};
+
+struct Channel_check_outcome {
+  mysqlshdk::mysql::Replication_channel::Error io_error;
+  // auth type which is to be blamed if the check has failed
+  Replication_auth_type auth_type;
+  std::chrono::milliseconds latency{0};
+};
+
+struct Lane_outcome {
+  std::vector<Channel_check_outcome> checks;
+  // set if a check has thrown, outcomes of the next checks are not available
+  std::exception_ptr error;
+};
+
 /**
  * @brief Opens a connection to verify network and SSL
  *
- * Sets up a dummy replication channel to itself to verify network and SSL
- * settings between instances.
+ * Sets up a dummy replication channel to verify network and SSL settings
+ * between instances.
  *
  * This ensures hostname and port (or @@report_host and @@report_port) are
- * correctly configured and can be reached from itself. It also verifies that
- * SSL certificates (whether one instance recognizes the other's certificate)
- * and related options are valid if ssl_mode and member_auth_type expects
- * them. If errors are detected, it will attempt to narrow down the issue
- * before reporting them.
+ * correctly configured and can be reached from the source instance. It also
+ * verifies that SSL certificates (whether one instance recognizes the other's
+ * certificate) and related options are valid if ssl_mode and member_auth_type
+ * expects them. If authentication with the certificate subject fails, the
+ * account at account_instance is downgraded to check just the issuer, in order
+ * to narrow down the issue. Errors are diagnosed by diagnose_channel_check().
  *
  * If localAddress is being used with GR, then that address must be reachable as
  * well in addition to the regular address. It's not enough that localAddress
  * alone is reachable because recovery happens through the regular network
  * interface.
  */
-void test_async_channel_connection(
+Channel_check_outcome run_channel_check(
     const mysqlshdk::mysql::IInstance &from_instance,
-    const mysqlshdk::mysql::IInstance &to_instance, std::string_view to_address,
-    int to_address_port, std::string_view to_address_source,
-    Cluster_ssl_mode ssl_mode, Replication_auth_type member_auth_type,
-    const std::string &user, const std::string &password,
-    std::string_view cert_issuer, std::string_view cert_subject) {
-  assert(member_auth_type == Replication_auth_type::PASSWORD ||
-         ssl_mode != Cluster_ssl_mode::NONE);
+    const std::function<const mysqlshdk::mysql::IInstance &()>
+        &account_instance,
+    const Check_settings &settings, const Channel_check &check) {
+  assert(settings.member_auth == Replication_auth_type::PASSWORD ||
+         settings.ssl_mode != Cluster_ssl_mode::NONE);
 
   log_info(
-      "Checking connection from %s to %s@%.*s:%i (%.*s) ssl_mode=%s "
-      "auth_type=%s "
-      "cert_issuer=%.*s cert_subject=%.*s",
-      from_instance.descr().c_str(), user.c_str(),
-      static_cast<int>(to_address.size()), to_address.data(), to_address_port,
-      static_cast<int>(to_address_source.size()), to_address_source.data(),
-      to_string(ssl_mode).c_str(), to_string(member_auth_type).c_str(),
-      static_cast<int>(cert_issuer.size()), cert_issuer.data(),
-      static_cast<int>(cert_subject.size()), cert_subject.data());
+      "Checking connection from %s to %s@%s:%i (%s) ssl_mode=%s "
+      "auth_type=%s cert_issuer=%s cert_subject=%s",
+      from_instance.descr().c_str(), check.user.c_str(),
+      check.to_address.c_str(), check.to_port,
+      check.to_address_source.c_str(), to_string(settings.ssl_mode).c_str(),
+      to_string(settings.member_auth).c_str(), settings.cert_issuer.c_str(),
+      check.cert_subject.c_str());
 
   // setup channel
   mysqlshdk::mysql::Auth_options creds;
-  creds.user = user;
-  creds.password = password;
+  creds.user = check.user;
+  creds.password = check.password;
 
-  creds.ssl_options =
-      prepare_replica_ssl_options(from_instance, ssl_mode, member_auth_type);
+  creds.ssl_options = prepare_replica_ssl_options(
+      from_instance, settings.ssl_mode, settings.member_auth);
 
-  mysqlshdk::mysql::change_master(
-      from_instance, std::string{to_address.data(), to_address.size()},
-      to_address_port, "mysqlsh.test", creds, 0, 0, {}, 0, false);
+  mysqlshdk::mysql::change_master(from_instance, check.to_address,
+                                  check.to_port, k_test_channel, creds, 0, 0,
+                                  {}, 0, false);
 
   shcore::Scoped_callback cleanup_channel([&from_instance]() {
     try {
       mysqlshdk::mysql::stop_replication_receiver(from_instance,
-                                                  "mysqlsh.test");
+                                                  k_test_channel);
     } catch (...) {
     }
-    mysqlshdk::mysql::reset_slave(from_instance, "mysqlsh.test", true);
+    mysqlshdk::mysql::reset_slave(from_instance, k_test_channel, true);
   });
 
-  auto to_address_complete =
-      shcore::str_format("%.*s:%d", static_cast<int>(to_address.size()),
-                         to_address.data(), to_address_port);
+  const auto to_endpoint = check.to_endpoint();
 
-  auto io_error = try_connect_channel(from_instance, to_address_complete);
+  Channel_check_outcome outcome;
+  outcome.auth_type = settings.member_auth;
+  outcome.io_error =
+      try_connect_channel(from_instance, to_endpoint, &outcome.latency);
 
-  if (io_error.code == ER_ACCESS_DENIED_ERROR &&
-      (member_auth_type == Replication_auth_type::CERT_SUBJECT ||
-       member_auth_type == Replication_auth_type::CERT_SUBJECT_PASSWORD)) {
+  if (outcome.io_error.code == ER_ACCESS_DENIED_ERROR &&
+      (settings.member_auth == Replication_auth_type::CERT_SUBJECT ||
+       settings.member_auth == Replication_auth_type::CERT_SUBJECT_PASSWORD)) {
     log_debug(
-        "Authentication from %s to %.*s with REQUIRE SUBJECT failed, retrying "
+        "Authentication from %s to %s with REQUIRE SUBJECT failed, retrying "
         "with just issuer",
-        from_instance.descr().c_str(),
-        static_cast<int>(to_address_complete.size()),
-        to_address_complete.data());
-    downgrade_temp_account_to_issuer_only(to_instance, "mysqlsh.test",
-                                          cert_issuer);
-    mysqlshdk::mysql::stop_replication_receiver(from_instance, "mysqlsh.test");
-    auto io_error2 = try_connect_channel(from_instance, to_address_complete);
+        from_instance.descr().c_str(), to_endpoint.c_str());
+    downgrade_temp_account_to_issuer_only(account_instance(), check.user,
+                                          settings.cert_issuer);
+    mysqlshdk::mysql::stop_replication_receiver(from_instance, k_test_channel);
+    std::chrono::milliseconds latency{0};
+    auto io_error2 = try_connect_channel(from_instance, to_endpoint, &latency);
     // neither subject nor issuer succeeded
     if (io_error2.code == ER_ACCESS_DENIED_ERROR) {
       // If both REQUIRE SUBJECT and REQUIRE ISSUER fail, we complain first
       // about certIssuer
-      member_auth_type = Replication_auth_type::CERT_ISSUER;
+      outcome.auth_type = Replication_auth_type::CERT_ISSUER;
+    }
+  }
+
+  return outcome;
+}
+
+Lane_outcome run_lane(
+    const mysqlshdk::mysql::IInstance &from_instance,
+    const std::function<const mysqlshdk::mysql::IInstance &()> &to_instance,
+    const Check_settings &settings, const Check_lane &lane) {
+  Lane_outcome outcome;
+
+  try {
+    mysqlshdk::mysql::Set_variable slave_net_timeout(
+        from_instance, "slave_net_timeout", k_test_net_timeout, true);
+
+    for (const auto &check : lane.checks) {
+      outcome.checks.emplace_back(run_channel_check(
+          from_instance,
+          [&]() -> const mysqlshdk::mysql::IInstance & {
+            return detail::check_account_instance(check, from_instance,
+                                                  to_instance);
+          },
+          settings, check));
+    }
+  } catch (...) {
+    outcome.error = std::current_exception();
+  }
+
+  return outcome;
+}
+
+/**
+ * Executes the lanes concurrently, each one in its own thread, using its own
+ * sessions (Instance objects cannot be shared between threads). Each check is
+ * bounded by k_check_timeout, so there's no deadline for the whole lane.
+ */
+std::vector<Lane_outcome> run_lanes(const std::vector<Check_lane> &lanes,
+                                    const Check_settings &settings) {
+  const auto results = mysqlshdk::utils::fan_out<Lane_outcome>(
+      lanes,
+      [settings](const Check_lane &lane) {
+        mysqlsh::Mysql_thread thdinit;
+
+        const auto from = Instance::connect(lane.from);
+        std::shared_ptr<Instance> to;
+
+        auto outcome = run_lane(
+            *from,
+            [&to, &lane]() -> const mysqlshdk::mysql::IInstance & {
+              if (!to) to = Instance::connect(lane.to);
+              return *to;
+            },
+            settings, lane);
+
+        from->close_session();
+        if (to) to->close_session();
+
+        return outcome;
+      },
+      k_max_member_fan_out, std::chrono::milliseconds{0});
+
+  std::vector<Lane_outcome> outcomes;
+  outcomes.reserve(results.size());
+
+  for (const auto &result : results) {
+    if (result.error) {
+      // could not connect to the source of the lane
+      Lane_outcome outcome;
+      outcome.error = result.error;
+      outcomes.emplace_back(std::move(outcome));
+    } else {
+      outcomes.emplace_back(*result.value);
+    }
+  }
+
+  return outcomes;
+}
+
+Connectivity_report make_report(const std::vector<Check_lane> &lanes,
+                                const std::vector<Lane_outcome> &outcomes,
+                                Cluster_ssl_mode ssl_mode) {
+  Connectivity_report report;
+
+  for (std::size_t i = 0; i < lanes.size(); ++i) {
+    const auto &lane = lanes[i];
+    const auto &outcome = outcomes[i];
+
+    for (std::size_t j = 0; j < lane.checks.size(); ++j) {
+      const auto &check = lane.checks[j];
+      Connection_check_result result;
+
+      result.from = lane.from_address;
+      result.to = check.to_endpoint();
+      result.address_source = check.to_address_source;
+      result.ssl_mode = ssl_mode;
+
+      if (j < outcome.checks.size()) {
+        const auto &error = outcome.checks[j].io_error;
+
+        result.latency = outcome.checks[j].latency;
+        result.succeeded = is_successful_error(error.code);
+
+        if (!result.succeeded) {
+          result.error = shcore::str_format("error %i: %s", error.code,
+                                            error.message.c_str());
+        }
+      } else if (j == outcome.checks.size() && outcome.error) {
+        try {
+          std::rethrow_exception(outcome.error);
+        } catch (const std::exception &e) {
+          result.error = e.what();
+        }
+      } else {
+        result.error = "not executed";
+      }
+
+      report.emplace_back(std::move(result));
     }
   }
 
-  throw_connect_error_diagnostic(
-      io_error, from_instance.get_canonical_address(),
-      to_instance.get_canonical_address(), to_address_complete,
-      to_address_source, cert_issuer, cert_subject, ssl_mode, member_auth_type);
+  return report;
+}
+
+/**
+ * Reports the first failure, in the order in which the checks are specified.
+ */
+void diagnose_lanes(const std::vector<Check_lane> &lanes,
+                    const std::vector<Lane_outcome> &outcomes,
+                    const Check_settings &settings) {
+  for (std::size_t i = 0; i < lanes.size(); ++i) {
+    const auto &lane = lanes[i];
+    const auto &outcome = outcomes[i];
+
+    for (std::size_t j = 0; j < outcome.checks.size(); ++j) {
+      const auto &check = lane.checks[j];
+      const auto &result = outcome.checks[j];
+
+      throw_connect_error_diagnostic(
+          result.io_error, lane.from_address, check.to_instance_address,
+          check.to_endpoint(), check.to_address_source, settings.cert_issuer,
+          check.cert_subject, settings.ssl_mode, result.auth_type);
+    }
+
+    if (outcome.error) std::rethrow_exception(outcome.error);
+  }
 }
 
 /**
@@ -461,16 +683,129 @@ class Endpoint_info {
 
 }  // namespace
 
-void test_self_connection(const mysqlshdk::mysql::IInstance &instance,
-                          std::string_view local_address,
-                          Cluster_ssl_mode ssl_mode,
-                          Replication_auth_type member_auth,
-                          std::string_view cert_issuer,
-                          std::string_view cert_subject,
-                          std::string_view comm_stack) {
-  mysqlshdk::mysql::Set_variable slave_net_timeout(
-      instance, "slave_net_timeout", 5, true);
+namespace detail {
+
+std::string Channel_check::to_endpoint() const {
+  return shcore::str_format("%s:%d", to_address.c_str(), to_port);
+}
+
+std::vector<Check_lane> make_peer_check_lanes(
+    const mysqlshdk::mysql::IInstance &from_instance,
+    std::string_view from_local_address, std::string_view from_cert_subject,
+    const mysqlshdk::mysql::IInstance &to_instance,
+    std::string_view to_local_address, std::string_view to_cert_subject,
+    std::string_view comm_stack, bool skip_self_check,
+    const Peer_check_accounts &accounts) {
+  const auto from_address = from_instance.get_canonical_address();
+  const auto to_address = to_instance.get_canonical_address();
+
+  Endpoint_info from_local_endpoint_info(
+      from_instance, from_local_address,
+      comm_stack != kCommunicationStackMySQL);
+
+  // checks executed at from_instance, the test accounts are at to_instance,
+  // except for the loopback one
+  Check_lane from_lane;
+  from_lane.from_address = from_address;
+  from_lane.from = from_instance.get_connection_options();
+  from_lane.to = to_instance.get_connection_options();
+
+  if (!skip_self_check && accounts.loopback.has_value()) {
+    Channel_check check;
+    check.to_instance_address = from_address;
+    check.to_address = from_local_endpoint_info.ip();
+    check.to_port = from_local_endpoint_info.port();
+    check.to_address_source = "localAddress";
+    check.user = "mysqlsh-lo.test";
+    check.password = *accounts.loopback;
+    check.cert_subject = from_cert_subject;
+    check.account_holder = Check_account_holder::SOURCE;
+    from_lane.checks.emplace_back(std::move(check));
+  }
+
+  if (accounts.at_to.has_value()) {
+    Channel_check check;
+    check.to_instance_address = to_address;
+    check.to_address = to_instance.get_canonical_hostname();
+    check.to_port = to_instance.get_canonical_port();
+    check.to_address_source = "report_host";
+    check.user = "mysqlsh.test";
+    check.password = *accounts.at_to;
+    check.cert_subject = from_cert_subject;
+    from_lane.checks.emplace_back(check);
+
+    Endpoint_info local_endpoint_info(to_instance, to_local_address,
+                                      comm_stack != kCommunicationStackMySQL);
+
+    if (!local_endpoint_info.are_endpoints_equivalent()) {
+      check.to_address = local_endpoint_info.ip();
+      check.to_port = local_endpoint_info.port();
+      check.to_address_source = "localAddress";
+      from_lane.checks.emplace_back(std::move(check));
+    }
+  }
+
+  // checks executed at to_instance, the test accounts are at from_instance
+  Check_lane to_lane;
+  to_lane.from_address = to_address;
+  to_lane.from = to_instance.get_connection_options();
+  to_lane.to = from_instance.get_connection_options();
+
+  if (accounts.at_from.has_value()) {
+    Channel_check check;
+    check.to_instance_address = from_address;
+    check.to_address = from_instance.get_canonical_hostname();
+    check.to_port = from_instance.get_canonical_port();
+    check.to_address_source = "report_host";
+    check.user = "mysqlsh.test";
+    check.password = *accounts.at_from;
+    check.cert_subject = to_cert_subject;
+    to_lane.checks.emplace_back(check);
+
+    if (!from_local_endpoint_info.are_endpoints_equivalent()) {
+      check.to_address = from_local_endpoint_info.ip();
+      check.to_port = from_local_endpoint_info.port();
+      check.to_address_source = "localAddress";
+      to_lane.checks.emplace_back(std::move(check));
+    }
+  }
+
+  std::vector<Check_lane> lanes;
+  lanes.emplace_back(std::move(from_lane));
+  lanes.emplace_back(std::move(to_lane));
+
+  return lanes;
+}
+
+const mysqlshdk::mysql::IInstance &check_account_instance(
+    const Channel_check &check, const mysqlshdk::mysql::IInstance &source,
+    const std::function<const mysqlshdk::mysql::IInstance &()> &target) {
+  return Check_account_holder::SOURCE == check.account_holder ? source
+                                                              : target();
+}
+
+}  // namespace detail
+
+std::string format_connectivity_report(const Connectivity_report &report) {
+  std::string out;
+
+  for (const auto &check : report) {
+    out += shcore::str_format(
+        "%s -> %s (%s): %s, ssl_mode=%s, latency=%lims\n", check.from.c_str(),
+        check.to.c_str(), check.address_source.c_str(),
+        check.succeeded ? "OK" : ("FAILED (" + check.error + ")").c_str(),
+        to_string(check.ssl_mode).c_str(),
+        static_cast<long>(check.latency.count()));
+  }
 
+  return out;
+}
+
+Connectivity_report test_self_connection(
+    const mysqlshdk::mysql::IInstance &instance,
+    std::string_view local_address, Cluster_ssl_mode ssl_mode,
+    Replication_auth_type member_auth, std::string_view cert_issuer,
+    std::string_view cert_subject, std::string_view comm_stack) {
   // create a temporary user without any grants
   auto password = create_temp_account(instance, "mysqlsh.test", member_auth,
                                       cert_issuer, cert_subject);
@@ -480,32 +815,62 @@ void test_self_connection(const mysqlshdk::mysql::IInstance &instance,
     instance.execute("DROP USER IF EXISTS `mysqlsh.test`@'%'");
   });
 
-  test_async_channel_connection(
-      instance, instance, instance.get_canonical_hostname(),
-      instance.get_canonical_port(), "report_host", ssl_mode, member_auth,
-      "mysqlsh.test", password, cert_issuer, cert_subject);
+  const Check_settings settings{ssl_mode, member_auth,
+                                std::string{cert_issuer}};
+
+  Check_lane lane;
+  lane.from_address = instance.get_canonical_address();
+
+  Channel_check check;
+  check.to_instance_address = lane.from_address;
+  check.to_address_source = "report_host";
+  check.user = "mysqlsh.test";
+  check.password = password;
+  check.cert_subject = cert_subject;
+
+  check.to_address = instance.get_canonical_hostname();
+  check.to_port = instance.get_canonical_port();
+  lane.checks.emplace_back(check);
 
   Endpoint_info local_endpoint_info(instance, local_address,
                                     comm_stack != kCommunicationStackMySQL);
 
   if (!local_endpoint_info.are_endpoints_equivalent()) {
-    test_async_channel_connection(instance, instance, local_endpoint_info.ip(),
-                                  local_endpoint_info.port(), "localAddress",
-                                  ssl_mode, member_auth, "mysqlsh.test",
-                                  password, cert_issuer, cert_subject);
+    check.to_address_source = "localAddress";
+    check.to_address = local_endpoint_info.ip();
+    check.to_port = local_endpoint_info.port();
+    lane.checks.emplace_back(std::move(check));
   }
+
+  // a single instance is involved, checks are executed using its session
+  std::vector<Lane_outcome> outcomes;
+  outcomes.emplace_back(run_lane(
+      instance,
+      [&instance]() -> const mysqlshdk::mysql::IInstance & {
+        return instance;
+      },
+      settings, lane));
+
+  std::vector<Check_lane> lanes;
+  lanes.emplace_back(std::move(lane));
+
+  auto report = make_report(lanes, outcomes, ssl_mode);
+  log_info("Connectivity check results:\n%s",
+           format_connectivity_report(report).c_str());
+
+  diagnose_lanes(lanes, outcomes, settings);
+
+  return report;
 }
 
-void test_peer_connection(const mysqlshdk::mysql::IInstance &from_instance,
-                          std::string_view from_local_address,
-                          std::string_view from_cert_subject,
-                          const mysqlshdk::mysql::IInstance &to_instance,
-                          std::string_view to_local_address,
-                          std::string_view to_cert_subject,
-                          Cluster_ssl_mode ssl_mode,
-                          Replication_auth_type member_auth,
-                          std::string_view cert_issuer,
-                          std::string_view comm_stack, bool skip_self_check) {
+Connectivity_report test_peer_connection(
+    const mysqlshdk::mysql::IInstance &from_instance,
+    std::string_view from_local_address, std::string_view from_cert_subject,
+    const mysqlshdk::mysql::IInstance &to_instance,
+    std::string_view to_local_address, std::string_view to_cert_subject,
+    Cluster_ssl_mode ssl_mode, Replication_auth_type member_auth,
+    std::string_view cert_issuer, std::string_view comm_stack,
+    bool skip_self_check) {
   // We perform full tests from from to to, but only connectivity checks the
   // other way around
 
@@ -526,91 +891,77 @@ void test_peer_connection(const mysqlshdk::mysql::IInstance &from_instance,
   // create a temporary user without any grants
   // Note: this will fail at the primary of a replica cluster, in that case
   // we just skip the tests
-  bool has_to_account = true;
-  bool has_from_account = true;
-  std::string to_password;
-  std::string from_password;
-  std::string from_local_password;
+  detail::Peer_check_accounts accounts;
 
   log_debug("Creating test account at %s", to_instance.descr().c_str());
   try {
-    from_password =
-        create_temp_account(to_instance, "mysqlsh.test", member_auth,
-                            cert_issuer, from_cert_subject);
+    accounts.at_to = create_temp_account(to_instance, "mysqlsh.test",
+                                         member_auth, cert_issuer,
+                                         from_cert_subject);
   } catch (const shcore::Error &e) {
     if (e.code() != ER_OPTION_PREVENTS_STATEMENT) throw;
     log_info("Cannot create test account at %s: %s",
              to_instance.descr().c_str(), e.format().c_str());
-    has_to_account = false;
   }
   log_debug("Creating test account at %s", from_instance.descr().c_str());
   try {
-    to_password =
-        create_temp_account(from_instance, "mysqlsh.test", member_auth,
-                            cert_issuer, to_cert_subject);
+    auto at_from = create_temp_account(from_instance, "mysqlsh.test",
+                                       member_auth, cert_issuer,
+                                       to_cert_subject);
 
-    from_local_password =
+    accounts.loopback =
         create_temp_account(from_instance, "mysqlsh-lo.test", member_auth,
                             cert_issuer, from_cert_subject);
+    accounts.at_from = std::move(at_from);
   } catch (const shcore::Error &e) {
     if (e.code() != ER_OPTION_PREVENTS_STATEMENT) throw;
     log_info("Cannot create test account at %s: %s",
              from_instance.descr().c_str(), e.format().c_str());
-    has_from_account = false;
   }
 
-  Endpoint_info from_local_endpoint_info(
-      from_instance, from_local_address,
-      comm_stack != kCommunicationStackMySQL);
-
-  {
-    mysqlshdk::mysql::Set_variable slave_net_timeout1(
-        from_instance, "slave_net_timeout", 5, true);
-
-    if (!skip_self_check && has_from_account) {
-      test_async_channel_connection(
-          from_instance, from_instance, from_local_endpoint_info.ip(),
-          from_local_endpoint_info.port(), "localAddress", ssl_mode,
-          member_auth, "mysqlsh-lo.test", from_local_password, cert_issuer,
-          from_cert_subject);
-    }
-
-    if (has_to_account) {
-      test_async_channel_connection(
-          from_instance, to_instance, to_instance.get_canonical_hostname(),
-          to_instance.get_canonical_port(), "report_host", ssl_mode,
-          member_auth, "mysqlsh.test", from_password, cert_issuer,
-          from_cert_subject);
-
-      Endpoint_info local_endpoint_info(to_instance, to_local_address,
-                                        comm_stack != kCommunicationStackMySQL);
-
-      if (!local_endpoint_info.are_endpoints_equivalent()) {
-        test_async_channel_connection(
-            from_instance, to_instance, local_endpoint_info.ip(),
-            local_endpoint_info.port(), "localAddress", ssl_mode, member_auth,
-            "mysqlsh.test", from_password, cert_issuer, from_cert_subject);
-      }
-    }
+  const Check_settings settings{ssl_mode, member_auth,
+                                std::string{cert_issuer}};
+
+  auto peer_lanes = detail::make_peer_check_lanes(
+      from_instance, from_local_address, from_cert_subject, to_instance,
+      to_local_address, to_cert_subject, comm_stack, skip_self_check,
+      accounts);
+  auto &from_lane = peer_lanes[0];
+  auto &to_lane = peer_lanes[1];
+
+  std::vector<Check_lane> lanes;
+  std::vector<Lane_outcome> outcomes;
+
+  if (!from_lane.checks.empty() && !to_lane.checks.empty()) {
+    lanes.emplace_back(std::move(from_lane));
+    lanes.emplace_back(std::move(to_lane));
+
+    outcomes = run_lanes(lanes, settings);
+  } else if (!from_lane.checks.empty()) {
+    outcomes.emplace_back(run_lane(
+        from_instance,
+        [&to_instance]() -> const mysqlshdk::mysql::IInstance & {
+          return to_instance;
+        },
+        settings, from_lane));
+    lanes.emplace_back(std::move(from_lane));
+  } else if (!to_lane.checks.empty()) {
+    outcomes.emplace_back(run_lane(
+        to_instance,
+        [&from_instance]() -> const mysqlshdk::mysql::IInstance & {
+          return from_instance;
+        },
+        settings, to_lane));
+    lanes.emplace_back(std::move(to_lane));
   }
 
-  if (has_from_account) {
-    mysqlshdk::mysql::Set_variable slave_net_timeout2(
-        to_instance, "slave_net_timeout", 5, true);
+  auto report = make_report(lanes, outcomes, ssl_mode);
+  log_info("Connectivity check results:\n%s",
+           format_connectivity_report(report).c_str());
 
-    test_async_channel_connection(
-        to_instance, from_instance, from_instance.get_canonical_hostname(),
-        from_instance.get_canonical_port(), "report_host", ssl_mode,
-        member_auth, "mysqlsh.test", to_password, cert_issuer, to_cert_subject);
+  diagnose_lanes(lanes, outcomes, settings);
 
-    if (!from_local_endpoint_info.are_endpoints_equivalent()) {
-      test_async_channel_connection(
-          to_instance, from_instance, from_local_endpoint_info.ip(),
-          from_local_endpoint_info.port(), "localAddress", ssl_mode,
-          member_auth, "mysqlsh.test", to_password, cert_issuer,
-          to_cert_subject);
-    }
-  }
+  return report;
 }
 
 }  // namespace dba
@@ -24,23 +24,57 @@
 #ifndef MODULES_ADMINAPI_COMMON_CONNECTIVITY_CHECK_H_
 #define MODULES_ADMINAPI_COMMON_CONNECTIVITY_CHECK_H_
 
+#include <chrono>
+#include <functional>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "modules/adminapi/common/common.h"
+#include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 
 namespace mysqlsh {
 namespace dba {
 
-void test_self_connection(const mysqlshdk::mysql::IInstance &instance,
-                          std::string_view local_address,
-                          Cluster_ssl_mode ssl_mode,
-                          Replication_auth_type member_auth_type,
-                          std::string_view cert_issuer,
-                          std::string_view cert_subject,
-                          std::string_view comm_stack);
+/**
+ * Outcome of a single connectivity check: a test replication channel opened
+ * from one instance to an endpoint of another one (or of itself).
+ */
+struct Connection_check_result {
+  std::string from;
+  std::string to;
+  // which setting the target endpoint comes from: report_host or localAddress
+  std::string address_source;
+  Cluster_ssl_mode ssl_mode = Cluster_ssl_mode::NONE;
+  // time taken to establish the connection (or to fail)
+  std::chrono::milliseconds latency{0};
+  bool succeeded = false;
+  // set if the check was not successful
+  std::string error;
+};
+
+using Connectivity_report = std::vector<Connection_check_result>;
+
+/**
+ * Formats the report as a list of "from -> to" pairs, one per line, with the
+ * outcome, SSL mode and latency of each check.
+ */
+std::string format_connectivity_report(const Connectivity_report &report);
 
-void test_peer_connection(
+Connectivity_report test_self_connection(
+    const mysqlshdk::mysql::IInstance &instance,
+    std::string_view local_address, Cluster_ssl_mode ssl_mode,
+    Replication_auth_type member_auth_type, std::string_view cert_issuer,
+    std::string_view cert_subject, std::string_view comm_stack);
+
+/**
+ * Checks connectivity between two instances, in both directions. Checks
+ * which originate from different instances are executed concurrently, each
+ * one on its own session, failures are reported in the same order as if the
+ * checks were executed one after another.
+ */
+Connectivity_report test_peer_connection(
     const mysqlshdk::mysql::IInstance &from_instance,
     std::string_view from_local_address, std::string_view from_cert_subject,
     const mysqlshdk::mysql::IInstance &to_instance,
@@ -49,6 +83,81 @@ void test_peer_connection(
     std::string_view cert_issuer, std::string_view comm_stack,
     bool skip_self_check = false);
 
+namespace detail {
+
+/**
+ * Instance which holds the test account used by a check: the source of the
+ * check or its target.
+ */
+enum class Check_account_holder { SOURCE, TARGET };
+
+/**
+ * Connection from the source of a lane to an endpoint.
+ */
+struct Channel_check {
+  // canonical address of the instance which owns the endpoint
+  std::string to_instance_address;
+  std::string to_address;
+  int to_port = 0;
+  std::string to_address_source;
+  // test account used to connect
+  std::string user;
+  std::string password;
+  std::string cert_subject;
+  Check_account_holder account_holder = Check_account_holder::TARGET;
+
+  std::string to_endpoint() const;
+};
+
+/**
+ * Checks which originate from the same instance. These need to be executed
+ * one after another, as they all use the same replication channel, while
+ * different lanes can be executed concurrently.
+ */
+struct Check_lane {
+  std::string from_address;
+  // source of the checks
+  mysqlshdk::db::Connection_options from;
+  // target of the checks
+  mysqlshdk::db::Connection_options to;
+  std::vector<Channel_check> checks;
+};
+
+/**
+ * Passwords of the test accounts used by test_peer_connection(), not set if
+ * the account could not be created.
+ */
+struct Peer_check_accounts {
+  // mysqlsh.test at to_instance
+  std::optional<std::string> at_to;
+  // mysqlsh.test at from_instance
+  std::optional<std::string> at_from;
+  // mysqlsh-lo.test at from_instance
+  std::optional<std::string> loopback;
+};
+
+/**
+ * Creates the lanes of test_peer_connection(): checks executed at
+ * from_instance followed by checks executed at to_instance.
+ */
+std::vector<Check_lane> make_peer_check_lanes(
+    const mysqlshdk::mysql::IInstance &from_instance,
+    std::string_view from_local_address, std::string_view from_cert_subject,
+    const mysqlshdk::mysql::IInstance &to_instance,
+    std::string_view to_local_address, std::string_view to_cert_subject,
+    std::string_view comm_stack, bool skip_self_check,
+    const Peer_check_accounts &accounts);
+
+/**
+ * Selects the instance which holds the test account of the given check, the
+ * target instance is obtained only if it's needed.
+ */
+const mysqlshdk::mysql::IInstance &check_account_instance(
+    const Channel_check &check, const mysqlshdk::mysql::IInstance &source,
+    const std::function<const mysqlshdk::mysql::IInstance &()> &target);
+
+}  // namespace detail
+
 }  // namespace dba
 }  // namespace mysqlsh
 
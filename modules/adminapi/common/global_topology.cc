@@ -591,20 +591,49 @@ void Server_global_topology::remove_server(const Server &server) {
  * If deep is true, then the state of each individual member will be checked,
  * in addition to the state of the group as a whole.
  */
-void Server_global_topology::check_server(Instance_id id, bool /*deep*/) {
+void Server_global_topology::check_server(Instance_id id, bool deep) {
   Server *server = this->server(id);
+  auto sessions = connect_members({server});
 
-  log_debug("Scanning state of replicaset %s", server->label.c_str());
+  check_server(server, deep, &sessions);
+}
+
+/**
+ * Connects to all members of the given servers concurrently.
+ */
+Server_global_topology::Member_sessions
+Server_global_topology::connect_members(
+    const std::list<Server *> &servers) const {
+  std::vector<const Instance *> members;
+  std::vector<std::string> endpoints;
+
+  for (const auto server : servers) {
+    for (const auto &member : server->m_members) {
+      log_debug("Connecting to %s", member.label.c_str());
+      members.emplace_back(&member);
+      endpoints.emplace_back(member.endpoint);
+    }
+  }
 
   // Note: ipool methods that require metadata should not be called here
-  auto ipool = current_ipool();
+  auto results = current_ipool()->connect_unchecked_endpoints(endpoints);
+  Member_sessions sessions;
+
+  for (std::size_t i = 0; i < members.size(); ++i) {
+    sessions.emplace(members[i], std::move(results[i]));
+  }
+
+  return sessions;
+}
+
+void Server_global_topology::check_server(Server *server, bool /*deep*/,
+                                          Member_sessions *sessions) {
+  log_debug("Scanning state of replicaset %s", server->label.c_str());
 
   for (auto &member : server->m_members) {
-    log_debug("Connecting to %s", member.label.c_str());
     Scoped_instance minstance;
     try {
-      minstance =
-          Scoped_instance(ipool->connect_unchecked_endpoint(member.endpoint));
+      minstance = Scoped_instance(sessions->at(&member).get());
     } catch (shcore::Exception &e) {
       log_warning("Could not connect to %s: %s", member.label.c_str(),
                   e.format().c_str());
@@ -630,8 +659,17 @@ void Server_global_topology::check_server(Instance_id id, bool /*deep*/) {
 }
 
 void Server_global_topology::check_servers(bool deep) {
+  std::list<Server *> servers;
+
+  for (Server &g : m_servers) {
+    servers.emplace_back(&g);
+  }
+
+  // connect to all the servers at once, their state is loaded one by one
+  auto sessions = connect_members(servers);
+
   for (Server &g : m_servers) {
-    check_server(g.instance_id, deep);
+    check_server(&g, deep, &sessions);
   }
 
   // resolve cross-references across groups
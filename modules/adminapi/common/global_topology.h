@@ -271,6 +271,13 @@ class Server_global_topology : public Global_topology {
       const std::list<std::shared_ptr<dba::Instance>> &candidates) const;
 
  private:
+  using Member_session =
+      mysqlshdk::utils::Fan_out_result<std::shared_ptr<mysqlsh::dba::Instance>>;
+  using Member_sessions = std::map<const Instance *, Member_session>;
+
+  Member_sessions connect_members(const std::list<Server *> &servers) const;
+  void check_server(Server *server, bool deep, Member_sessions *sessions);
+
   void load_server_state(Server *server, mysqlsh::dba::Instance *conn,
                          bool deep);
 
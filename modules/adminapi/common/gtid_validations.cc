@@ -573,12 +573,11 @@ std::string get_only_view_change_gtids(
       replica.get_sysvar_string("group_replication_view_change_uuid", "");
 
   auto orig_gtids = Gtid_set::from_string(gtids);
-  orig_gtids.normalize(source);
 
   auto s_gtids = orig_gtids.get_gtids_from(s_vc);
   auto r_gtids = orig_gtids.get_gtids_from(r_vc);
 
-  return s_gtids.add(r_gtids).normalize(source).str();
+  return s_gtids.add(r_gtids).str();
 }
 
 mysqlshdk::mysql::Replica_gtid_state check_replica_group_gtid_state(
@@ -591,9 +590,8 @@ mysqlshdk::mysql::Replica_gtid_state check_replica_group_gtid_state(
   auto r_vc =
       replica.get_sysvar_string("group_replication_view_change_uuid", "");
 
-  auto filter_vcle = [&replica](Gtid_set gtid,
-                                const std::string &view_change_uuid) {
-    return gtid.subtract(gtid.get_gtids_from(view_change_uuid), replica);
+  auto filter_vcle = [](Gtid_set gtid, const std::string &view_change_uuid) {
+    return gtid.subtract(gtid.get_gtids_from(view_change_uuid));
   };
 
   // Note: always query GTID_EXECUTED from the replica first to avoid races
@@ -605,9 +603,9 @@ mysqlshdk::mysql::Replica_gtid_state check_replica_group_gtid_state(
   auto s_purged =
       filter_vcle(filter_vcle(Gtid_set::from_gtid_purged(source), s_vc), r_vc);
 
-  return check_replica_gtid_state(source, s_gtid.str(), s_purged.str(),
-                                  r_gtid.str(), out_missing_gtids,
-                                  out_errant_gtids);
+  return mysqlshdk::mysql::check_replica_gtid_state(
+      s_gtid.str(), s_purged.str(), r_gtid.str(), out_missing_gtids,
+      out_errant_gtids);
 }
 
 }  // namespace dba
@@ -22,6 +22,10 @@
  */
 
 #include "modules/adminapi/common/instance_monitoring.h"
+
+#include <algorithm>
+#include <utility>
+
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/dba_errors.h"
 #include "mysqlshdk/include/shellcore/interrupt_handler.h"
@@ -33,6 +37,267 @@
 namespace mysqlsh {
 namespace dba {
 
+namespace {
+
+// longest uninterrupted sleep, so that ^C is handled promptly
+constexpr std::chrono::milliseconds k_max_sleep_slice{100};
+
+// all the values are fetched by a single round trip, clone state is only
+// available in 8.0.17+, if the clone plugin is installed
+constexpr const char *k_recovery_state_query =
+    "SELECT"
+    " (SELECT member_state"
+    "   FROM performance_schema.replication_group_members"
+    "   WHERE member_id = @@server_uuid"
+    "     OR (member_id = '' AND member_state = 'OFFLINE')"
+    "   LIMIT 1) member_state,"
+    " (SELECT service_state"
+    "   FROM performance_schema.replication_connection_status"
+    "   WHERE channel_name = 'group_replication_recovery') receiver_state,"
+    " (SELECT service_state"
+    "   FROM performance_schema.replication_applier_status"
+    "   WHERE channel_name = 'group_replication_recovery') applier_state,"
+    " (SELECT CAST(last_error_timestamp AS CHAR)"
+    "   FROM performance_schema.replication_connection_status"
+    "   WHERE channel_name = 'group_replication_recovery'"
+    "     AND last_error_number <> 0) receiver_error_time,"
+    " (SELECT CAST(MAX(last_error_timestamp) AS CHAR)"
+    "   FROM performance_schema.replication_applier_status_by_worker"
+    "   WHERE channel_name = 'group_replication_recovery'"
+    "     AND last_error_number <> 0) applier_error_time";
+
+constexpr const char *k_recovery_state_clone_columns =
+    ", (SELECT state"
+    "   FROM performance_schema.clone_status"
+    "   WHERE begin_time >= ?"
+    "   ORDER BY id DESC LIMIT 1) clone_state,"
+    " (SELECT stage"
+    "   FROM performance_schema.clone_progress"
+    "   WHERE state <> 'Not Started'"
+    "   ORDER BY begin_time DESC LIMIT 1) clone_stage";
+
+}  // namespace
+
+bool is_connection_lost(const shcore::Error &e) {
+  return e.code() == ER_SERVER_SHUTDOWN ||
+         mysqlshdk::db::is_mysql_client_error(e.code());
+}
+
+Poll_interval::Poll_interval(std::chrono::milliseconds min,
+                             std::chrono::milliseconds max)
+    : m_min(min), m_max(std::max(min, max)), m_current(min) {}
+
+std::chrono::milliseconds Poll_interval::next(bool changed) {
+  if (changed) m_current = m_min;
+
+  const auto result = m_current;
+  m_current = std::min(m_current * 2, m_max);
+
+  return result;
+}
+
+bool sleep_unless_stopped(std::chrono::milliseconds time, const bool &stop) {
+  while (time.count() > 0 && !stop) {
+    const auto slice = std::min(time, k_max_sleep_slice);
+    shcore::sleep_ms(slice.count());
+    time -= slice;
+  }
+
+  return !stop;
+}
+
+mysqlshdk::gr::Member_state Recovery_state::get_member_state() const {
+  return mysqlshdk::gr::to_member_state(member_state);
+}
+
+bool Recovery_state::operator==(const Recovery_state &other) const {
+  return reachable == other.reachable && member_state == other.member_state &&
+         receiver_state == other.receiver_state &&
+         applier_state == other.applier_state &&
+         receiver_error_time == other.receiver_error_time &&
+         applier_error_time == other.applier_error_time &&
+         clone_state == other.clone_state && clone_stage == other.clone_stage;
+}
+
+Recovery_state get_recovery_state(const mysqlshdk::mysql::IInstance &instance,
+                                  const std::string &begin_time,
+                                  bool with_clone) {
+  with_clone = with_clone &&
+               instance.get_version() >= mysqlshdk::utils::Version(8, 0, 17);
+
+  const auto result =
+      with_clone
+          ? instance.queryf(std::string{k_recovery_state_query} +
+                                k_recovery_state_clone_columns,
+                            begin_time.empty() ? "0000-00-00 00:00:00"
+                                               : begin_time)
+          : instance.query(k_recovery_state_query);
+  const auto row = result->fetch_one_or_throw();
+
+  Recovery_state state;
+
+  state.reachable = true;
+  state.member_state = row->get_string(0, "");
+  state.receiver_state = row->get_string(1, "");
+  state.applier_state = row->get_string(2, "");
+  state.receiver_error_time = row->get_string(3, "");
+  state.applier_error_time = row->get_string(4, "");
+
+  if (with_clone) {
+    state.clone_state = row->get_string(5, "");
+
+    // stage of an older clone is not interesting
+    if (!state.clone_state.empty()) {
+      state.clone_stage = row->get_string(6, "");
+    }
+  }
+
+  return state;
+}
+
+struct Recovery_monitor::Target {
+  mysqlshdk::db::Connection_options coptions;
+  std::shared_ptr<Instance> instance;
+  bool with_clone = true;
+  Recovery_state state;
+};
+
+Recovery_monitor::Recovery_monitor(const std::string &begin_time,
+                                   Poll_interval interval)
+    : m_begin_time(begin_time), m_interval(std::move(interval)) {}
+
+std::size_t Recovery_monitor::add_target(
+    const mysqlshdk::db::Connection_options &coptions) {
+  auto target = std::make_shared<Target>();
+  target->coptions = coptions;
+
+  m_targets.emplace_back(std::move(target));
+  return m_targets.size() - 1;
+}
+
+std::size_t Recovery_monitor::add_target(
+    const std::shared_ptr<Instance> &instance) {
+  const auto index = add_target(instance->get_connection_options());
+  m_targets[index]->instance = instance;
+
+  return index;
+}
+
+const Recovery_state &Recovery_monitor::state(std::size_t target) const {
+  return m_targets.at(target)->state;
+}
+
+std::shared_ptr<Instance> Recovery_monitor::instance(
+    std::size_t target) const {
+  return m_targets.at(target)->instance;
+}
+
+Recovery_state Recovery_monitor::poll_target(Target *target,
+                                             const std::string &begin_time) {
+  try {
+    if (!target->instance) {
+      target->instance = Instance::connect(target->coptions);
+    }
+
+    try {
+      return get_recovery_state(*target->instance, begin_time,
+                                target->with_clone);
+    } catch (const shcore::Error &e) {
+      if (ER_NO_SUCH_TABLE != e.code() || !target->with_clone) throw;
+
+      // clone plugin is not installed
+      target->with_clone = false;
+      return get_recovery_state(*target->instance, begin_time, false);
+    }
+  } catch (const shcore::Error &e) {
+    if (!is_connection_lost(e)) throw;
+
+    log_debug2("Recovery monitor lost connection to %s: %s",
+               target->coptions.uri_endpoint().c_str(), e.format().c_str());
+
+    // instance is probably restarting, reconnect during the next check
+    target->instance.reset();
+    return {};
+  }
+}
+
+bool Recovery_monitor::poll() {
+  bool changed = false;
+
+  const auto update = [&changed](Target *target, Recovery_state state) {
+    if (target->state != state) {
+      changed = true;
+      target->state = std::move(state);
+    }
+  };
+
+  if (1 == m_targets.size()) {
+    const auto target = m_targets.front().get();
+    update(target, poll_target(target, m_begin_time));
+  } else {
+    // workers operate on their own copies of targets, so that a worker which
+    // misses its deadline cannot interfere with the next check
+    std::vector<std::shared_ptr<Target>> copies;
+    copies.reserve(m_targets.size());
+
+    for (const auto &target : m_targets) {
+      copies.emplace_back(std::make_shared<Target>(*target));
+    }
+
+    const auto results = member_fan_out<Recovery_state>(
+        copies, [begin_time = m_begin_time](
+                    const std::shared_ptr<Target> &target) {
+          return poll_target(target.get(), begin_time);
+        });
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      if (results[i].timed_out) {
+        log_debug2("Recovery monitor timed out checking %s",
+                   m_targets[i]->coptions.uri_endpoint().c_str());
+
+        m_targets[i]->instance.reset();
+        update(m_targets[i].get(), {});
+      } else {
+        Recovery_state state = results[i].get();
+
+        m_targets[i]->instance = copies[i]->instance;
+        m_targets[i]->with_clone = copies[i]->with_clone;
+        update(m_targets[i].get(), std::move(state));
+      }
+    }
+  }
+
+  return changed;
+}
+
+bool Recovery_monitor::wait(const std::function<bool(bool changed)> &done,
+                            std::chrono::milliseconds timeout,
+                            const bool &stop) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+  while (!stop) {
+    const auto changed = poll();
+
+    if (done(changed)) return true;
+
+    auto interval = m_interval.next(changed);
+
+    if (timeout.count() > 0) {
+      const auto now = std::chrono::steady_clock::now();
+
+      if (now >= deadline) break;
+
+      interval = std::min(
+          interval, std::chrono::duration_cast<std::chrono::milliseconds>(
+                        deadline - now));
+    }
+
+    if (!sleep_unless_stopped(interval, stop)) break;
+  }
+
+  return false;
+}
+
 std::shared_ptr<mysqlsh::dba::Instance> wait_server_startup(
     const mysqlshdk::db::Connection_options &instance_def, int timeout,
     Recovery_progress_style progress_style) {
@@ -47,8 +312,15 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_server_startup(
     stick.done("");
   }
 
-  timeout = adjust_timeout(timeout, k_server_restart_poll_interval_ms);
-  while (timeout > 0) {
+  // server is checked often right after the restart was requested, as it may
+  // be quick, the interval is extended if it's not the case
+  Poll_interval interval{
+      std::chrono::milliseconds{k_server_restart_min_poll_interval_ms},
+      std::chrono::milliseconds{k_server_restart_poll_interval_ms}};
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds{timeout};
+
+  while (std::chrono::steady_clock::now() < deadline) {
     try {
       out_instance = Instance::connect(instance_def);
 
@@ -62,8 +334,7 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_server_startup(
     } catch (const shcore::Error &e) {
       log_debug2("While waiting for server to start: %s", e.format().c_str());
 
-      if (e.code() == ER_SERVER_SHUTDOWN ||
-          mysqlshdk::db::is_mysql_client_error(e.code())) {
+      if (is_connection_lost(e)) {
         // still not started
       } else {
         if (progress_style != Recovery_progress_style::NOWAIT &&
@@ -77,8 +348,7 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_server_startup(
         progress_style != Recovery_progress_style::NOINFO) {
       stick.update();
     }
-    timeout--;
-    shcore::sleep_ms(k_server_restart_poll_interval_ms);
+    shcore::sleep_ms(interval.next(false).count());
   }
 
   if (progress_style != Recovery_progress_style::NOWAIT &&
@@ -24,16 +24,199 @@
 #ifndef MODULES_ADMINAPI_COMMON_INSTANCE_MONITORING_H_
 #define MODULES_ADMINAPI_COMMON_INSTANCE_MONITORING_H_
 
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/instance_pool.h"
+#include "mysqlshdk/libs/mysql/group_replication.h"
 
 namespace mysqlsh {
 namespace dba {
 
 constexpr const int k_server_restart_poll_interval_ms = 1000;
+constexpr const int k_server_restart_min_poll_interval_ms = 100;
 
 class stop_wait {};
 
+/**
+ * Checks if the error means that connection to the server was lost or could
+ * not be established, i.e. because it is restarting.
+ */
+bool is_connection_lost(const shcore::Error &e);
+
+/**
+ * Adaptive interval between the consecutive checks of a state which is
+ * expected to change. The interval doubles each time a check does not observe
+ * any change, up to the maximum value, and goes back to the minimum as soon as
+ * a transition is seen, as the next one usually follows shortly.
+ */
+class Poll_interval final {
+ public:
+  Poll_interval(std::chrono::milliseconds min, std::chrono::milliseconds max);
+
+  Poll_interval(const Poll_interval &) = default;
+  Poll_interval(Poll_interval &&) = default;
+
+  Poll_interval &operator=(const Poll_interval &) = default;
+  Poll_interval &operator=(Poll_interval &&) = default;
+
+  ~Poll_interval() = default;
+
+  /**
+   * Provides the time to wait before the next check.
+   *
+   * @param changed whether the last check has observed a state transition
+   */
+  std::chrono::milliseconds next(bool changed);
+
+  std::chrono::milliseconds current() const { return m_current; }
+
+  void reset() { m_current = m_min; }
+
+ private:
+  std::chrono::milliseconds m_min;
+  std::chrono::milliseconds m_max;
+  std::chrono::milliseconds m_current;
+};
+
+/**
+ * Sleeps for the given time, wakes up early if stop is set.
+ *
+ * @returns false if the wait was interrupted
+ */
+bool sleep_unless_stopped(std::chrono::milliseconds time, const bool &stop);
+
+/**
+ * Recovery related state of an instance, fetched with a single query.
+ */
+struct Recovery_state {
+  // false if instance could not be contacted, i.e. it is restarting
+  bool reachable = false;
+  // GR member_state, empty if instance is not a member of a group
+  std::string member_state;
+  // service state of the recovery channel, empty if channel does not exist
+  std::string receiver_state;
+  std::string applier_state;
+  // timestamps of the last errors of the recovery channel, empty if none
+  std::string receiver_error_time;
+  std::string applier_error_time;
+  // state of the last clone which began after the monitored operation was
+  // started and the name of its most recently started stage, empty if none
+  std::string clone_state;
+  std::string clone_stage;
+
+  mysqlshdk::gr::Member_state get_member_state() const;
+
+  bool operator==(const Recovery_state &other) const;
+  bool operator!=(const Recovery_state &other) const {
+    return !(*this == other);
+  }
+};
+
+/**
+ * Fetches the recovery state of the given instance.
+ *
+ * @param instance instance to be checked
+ * @param begin_time timestamp of the instance taken before the monitored
+ *        operation has started, older clone operations are ignored
+ * @param with_clone whether the clone state is to be fetched, it's ignored if
+ *        instance does not support clone
+ *
+ * @throws shcore::Error if the query fails, ER_NO_SUCH_TABLE means that clone
+ *         plugin is not installed and clone state needs to be skipped
+ */
+Recovery_state get_recovery_state(const mysqlshdk::mysql::IInstance &instance,
+                                  const std::string &begin_time,
+                                  bool with_clone);
+
+/**
+ * Watches the recovery of one or more instances, so that operations which
+ * handle multiple instances can wait for all of them at once.
+ *
+ * Each target is queried using a persistent session, which is reestablished if
+ * the connection is lost, i.e. when instance restarts after clone. When there
+ * are multiple targets, they are checked concurrently. Between the checks,
+ * monitor waits for an adaptive interval, which is shortened whenever a state
+ * transition is observed in any of the targets.
+ */
+class Recovery_monitor final {
+ public:
+  /**
+   * @param begin_time timestamp taken before the monitored operation has
+   *        started, see get_recovery_state()
+   * @param interval interval between the checks
+   */
+  Recovery_monitor(const std::string &begin_time, Poll_interval interval);
+
+  Recovery_monitor(const Recovery_monitor &) = delete;
+  Recovery_monitor(Recovery_monitor &&) = delete;
+
+  Recovery_monitor &operator=(const Recovery_monitor &) = delete;
+  Recovery_monitor &operator=(Recovery_monitor &&) = delete;
+
+  ~Recovery_monitor() = default;
+
+  /**
+   * Adds a target, connection is established by the first call to poll().
+   *
+   * @returns index of the target
+   */
+  std::size_t add_target(const mysqlshdk::db::Connection_options &coptions);
+
+  /**
+   * Adds a target which is already connected, if the connection is lost, it's
+   * reestablished using the connection options of this instance.
+   *
+   * @returns index of the target
+   */
+  std::size_t add_target(const std::shared_ptr<Instance> &instance);
+
+  std::size_t size() const { return m_targets.size(); }
+
+  const Recovery_state &state(std::size_t target) const;
+
+  /**
+   * Session to the given target, null if it's not reachable.
+   */
+  std::shared_ptr<Instance> instance(std::size_t target) const;
+
+  /**
+   * Checks all the targets once. Connection errors mark the target as not
+   * reachable, any other errors are thrown.
+   *
+   * @returns true if state of any of the targets has changed
+   */
+  bool poll();
+
+  /**
+   * Checks the targets until the given predicate is satisfied.
+   *
+   * @param done called after each check with information whether any state
+   *        has changed
+   * @param timeout maximum time to wait, zero to wait indefinitely
+   * @param stop waiting stops when this is set, i.e. by an interrupt handler
+   *
+   * @returns true if predicate was satisfied, false on timeout or when stopped
+   */
+  bool wait(const std::function<bool(bool changed)> &done,
+            std::chrono::milliseconds timeout, const bool &stop);
+
+ private:
+  struct Target;
+
+  static Recovery_state poll_target(Target *target,
+                                    const std::string &begin_time);
+
+  std::string m_begin_time;
+  Poll_interval m_interval;
+  std::vector<std::shared_ptr<Target>> m_targets;
+};
+
 /**
  * Wait for the target MySQL instance to start
  *
@@ -328,6 +328,9 @@ mysqlshdk::mysql::Lock_scoped Instance::get_lock(
               k_lock, descr().c_str());
     mysqlshdk::mysql::get_lock(*this, k_lock_name_instance, k_lock, mode,
                                timeout.count());
+
+    // metadata cached before the lock was held may be stale
+    MetadataStorage::revalidate_read_caches();
   } catch (const shcore::Error &err) {
     // Abort the operation in case the required lock cannot be acquired.
     log_info("Failed to get %s lock ('%s', '%s') on '%s': %s",
@@ -601,6 +604,45 @@ std::shared_ptr<Instance> Instance_pool::connect_unchecked_endpoint(
   CATCH_AND_THROW_CONNECTION_ERROR(endpoint)
 }
 
+std::vector<mysqlshdk::utils::Fan_out_result<std::shared_ptr<Instance>>>
+Instance_pool::connect_unchecked_endpoints(
+    const std::vector<std::string> &endpoints) {
+  DBUG_TRACE;
+  std::vector<std::pair<std::string, mysqlshdk::db::Connection_options>> opts;
+  opts.reserve(endpoints.size());
+
+  for (const auto &endpoint : endpoints) {
+    mysqlshdk::db::Connection_options o(endpoint);
+    m_default_auth_opts.set(&o);
+    opts.emplace_back(endpoint, std::move(o));
+  }
+
+  auto results = member_fan_out<std::shared_ptr<Instance>>(
+      opts, [](const auto &endpoint) -> std::shared_ptr<Instance> {
+        try {
+          return Instance::connect(endpoint.second);
+        }
+        CATCH_AND_THROW_CONNECTION_ERROR(endpoint.first)
+      });
+
+  // report timeouts in the same way as the other connection errors
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    if (results[i].timed_out) {
+      try {
+        std::rethrow_exception(results[i].error);
+      } catch (const std::exception &e) {
+        log_warning("Timed out while connecting to '%s'", endpoints[i].c_str());
+        results[i].error =
+            std::make_exception_ptr(shcore::Exception::mysql_error_with_code(
+                mysqlsh::dba::detail::connection_error_msg(e, endpoints[i]),
+                CR_CONN_HOST_ERROR));
+      }
+    }
+  }
+
+  return results;
+}
+
 std::shared_ptr<Instance> Instance_pool::connect_unchecked_uuid(
     const std::string &uuid) {
   DBUG_TRACE;
@@ -1178,6 +1220,12 @@ Scoped_instance_pool::~Scoped_instance_pool() noexcept {
   g_ipool_storage.pop(m_pool);
 }
 
+std::chrono::milliseconds member_fan_out_deadline() {
+  // connecting may need to try multiple addresses, a couple of queries are
+  // executed once the connection is established
+  return std::chrono::milliseconds(3 * default_adminapi_connect_timeout());
+}
+
 std::shared_ptr<Instance_pool> current_ipool() {
   DBUG_TRACE;
   return g_ipool_storage.get();
@@ -24,6 +24,7 @@
 #ifndef MODULES_ADMINAPI_COMMON_INSTANCE_POOL_H_
 #define MODULES_ADMINAPI_COMMON_INSTANCE_POOL_H_
 
+#include <chrono>
 #include <list>
 #include <memory>
 #include <set>
@@ -262,6 +263,13 @@ class Instance_pool final {
   std::shared_ptr<Instance> connect_unchecked_endpoint(
       const std::string &endpoint, bool allow_url = false);
 
+  // Connects to all the endpoints concurrently, see member_fan_out(). Pool is
+  // bypassed, each instance can be used by a different thread. Results are in
+  // the same order as the endpoints, timeouts are reported as connection
+  // errors.
+  std::vector<mysqlshdk::utils::Fan_out_result<std::shared_ptr<Instance>>>
+  connect_unchecked_endpoints(const std::vector<std::string> &endpoints);
+
   // Connect to the node. If node is a group, picks any member from it.
   std::shared_ptr<Instance> connect_unchecked(const topology::Node *node);
 
@@ -372,6 +380,39 @@ class Scoped_instance_pool final {
 
 std::shared_ptr<Instance_pool> current_ipool();
 
+// maximum number of members which are contacted at once by member_fan_out()
+inline constexpr std::size_t k_max_member_fan_out = 8;
+
+/**
+ * Time given to each member contacted by member_fan_out(), derived from the
+ * dba.connectTimeout shell option, zero if there's no timeout.
+ */
+std::chrono::milliseconds member_fan_out_deadline();
+
+/**
+ * Calls fn for each of the members concurrently, using a bounded number of
+ * threads. Members which do not respond before member_fan_out_deadline()
+ * expires are reported as timed out, so the total time is close to the time
+ * taken by the slowest member, instead of the sum of all of them. Results are
+ * in the same order as members.
+ *
+ * fn is called in a worker thread (MySQL client is initialized there) and
+ * must not refer to the state of the caller, as it may outlive the call. A
+ * member which timed out keeps its session busy until the call returns, the
+ * number of such calls is bounded, see fan_out().
+ */
+template <class R, class T, class F>
+std::vector<mysqlshdk::utils::Fan_out_result<R>> member_fan_out(
+    const std::vector<T> &members, F fn) {
+  return mysqlshdk::utils::fan_out<R>(
+      members,
+      [fn = std::move(fn)](const T &member) {
+        mysqlsh::Mysql_thread thdinit;
+        return fn(member);
+      },
+      k_max_member_fan_out, member_fan_out_deadline());
+}
+
 template <class InputIter>
 std::list<shcore::Dictionary_t> execute_in_parallel(
     InputIter begin, InputIter end,
@@ -22,6 +22,10 @@
  */
 
 #include "modules/adminapi/common/member_recovery_monitoring.h"
+
+#include <chrono>
+#include <utility>
+
 #include "modules/adminapi/common/clone_progress.h"
 #include "modules/adminapi/common/dba_errors.h"
 #include "modules/adminapi/common/instance_monitoring.h"
@@ -45,6 +49,21 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
 
 namespace {
 
+Poll_interval recovery_poll_interval() {
+  return {std::chrono::milliseconds{k_recovery_status_min_poll_interval_ms},
+          std::chrono::milliseconds{k_recovery_status_poll_interval_ms}};
+}
+
+Poll_interval clone_poll_interval() {
+  std::chrono::milliseconds min{k_clone_status_min_poll_interval_ms};
+  std::chrono::milliseconds max{k_clone_status_poll_interval_ms};
+
+  DBUG_EXECUTE_IF("clone_rig_poll_interval",
+                  { min = max = std::chrono::milliseconds{10}; });
+
+  return {min, max};
+}
+
 void throw_clone_recovery_error(const mysqlshdk::mysql::IInstance &instance,
                                 const std::string &start_time) {
   mysqlshdk::mysql::Clone_status status;
@@ -235,122 +254,78 @@ mysqlshdk::gr::Group_member_recovery_status wait_recovery_start(
   // It's also possible that the target instance restarts during our checks.
   // In that case, the instance may or may not come back.
 
-  timeout_sec = adjust_timeout(timeout_sec, k_recovery_status_poll_interval_ms);
-  bool reconnect = true;
-
-  Scoped_instance instance;
-
   bool stop = false;
   shcore::Interrupt_handler intr([&stop]() {
     stop = true;
     return true;
   });
 
-  while (timeout_sec > 0 && !stop) {
-    if (reconnect) {
-      try {
-        instance = Scoped_instance(wait_server_startup(
-            instance_def, timeout_sec, Recovery_progress_style::NOWAIT));
-        reconnect = false;
-      } catch (const shcore::Exception &e) {
-        if (e.code() == SHERR_DBA_SERVER_RESTART_TIMEOUT) break;
-        throw;
-      }
-    }
+  auto rm = mysqlshdk::gr::Group_member_recovery_status::UNKNOWN;
 
-    if (!reconnect) {
-      try {
-        mysqlshdk::gr::Group_member_recovery_status rm =
-            mysqlshdk::gr::detect_recovery_status(*instance, begin_time);
-        if (rm != mysqlshdk::gr::Group_member_recovery_status::UNKNOWN) {
+  if (timeout_sec <= 0) return rm;
+
+  Recovery_monitor monitor(begin_time, recovery_poll_interval());
+  monitor.add_target(instance_def);
+
+  bool recheck = false;
+
+  const auto detected = monitor.wait(
+      [&](bool changed) {
+        const auto instance = monitor.instance(0);
+
+        // the recovery method can only be different if the state has changed
+        if (!instance || !(changed || recheck)) return false;
+
+        recheck = false;
+
+        try {
+          rm = mysqlshdk::gr::detect_recovery_status(*instance, begin_time);
           // We keep trying until we can detect which method is in use
-          return rm;
-        }
-        reconnect = false;
-      } catch (const shcore::Error &err) {
-        log_warning("During recovery start check: %s", err.what());
+          return rm != mysqlshdk::gr::Group_member_recovery_status::UNKNOWN;
+        } catch (const shcore::Error &err) {
+          log_warning("During recovery start check: %s", err.what());
 
-        if (mysqlshdk::db::is_mysql_client_error(err.code()) ||
-            err.code() == ER_SERVER_SHUTDOWN) {
           // client errors are probably a lost connection, which may mean the
-          // instance is restarting
-          reconnect = true;
-        } else {
-          throw;
+          // instance is restarting, monitor is going to reconnect
+          if (!is_connection_lost(err)) throw;
+
+          recheck = true;
         }
-      }
-    }
-    shcore::sleep_ms(k_recovery_status_poll_interval_ms);
-    timeout_sec--;
-  }
+
+        return false;
+      },
+      std::chrono::seconds{timeout_sec}, stop);
 
   if (stop) throw stop_monitoring();
 
-  return mysqlshdk::gr::Group_member_recovery_status::UNKNOWN;
+  return detected ? rm : mysqlshdk::gr::Group_member_recovery_status::UNKNOWN;
 }
 
 std::shared_ptr<mysqlsh::dba::Instance> wait_clone_start(
     const mysqlshdk::db::Connection_options &instance_def,
     const std::string &begin_time, int timeout_sec) {
-  // We wait in this loop until something shows up in PFS.clone_status
-  timeout_sec = adjust_timeout(timeout_sec, k_recovery_status_poll_interval_ms);
-
-  std::shared_ptr<mysqlsh::dba::Instance> out_instance;
-
-  bool reconnect = true;
-
+  // We wait until something shows up in PFS.clone_status
   bool stop = false;
   shcore::Interrupt_handler intr([&stop]() {
     stop = true;
     return true;
   });
 
-  auto poll_interval_ms = k_recovery_status_poll_interval_ms;
-  DBUG_EXECUTE_IF("clone_rig_poll_interval", { poll_interval_ms = 10; });
+  if (timeout_sec <= 0) return {};
 
-  while (timeout_sec > 0 && !stop) {
-    if (reconnect) {
-      try {
-        out_instance = wait_server_startup(instance_def, timeout_sec,
-                                           Recovery_progress_style::NOWAIT);
-        reconnect = false;
-      } catch (const shcore::Exception &e) {
-        if (e.code() == SHERR_DBA_SERVER_RESTART_TIMEOUT) break;
-        throw;
-      }
-    }
+  Recovery_monitor monitor(begin_time, clone_poll_interval());
+  monitor.add_target(instance_def);
 
-    if (!reconnect) {
-      try {
-        mysqlshdk::mysql::Clone_status status =
-            mysqlshdk::mysql::check_clone_status(*out_instance, begin_time);
-
-        if (!status.state.empty() && !status.stages.empty()) {
-          // We keep trying until we can detect clone has started
-          break;
-        }
-        reconnect = false;
-      } catch (const shcore::Error &err) {
-        log_warning("Error during clone start check: %s", err.format().c_str());
-
-        if (mysqlshdk::db::is_mysql_client_error(err.code()) ||
-            err.code() == ER_SERVER_SHUTDOWN) {
-          // client errors are probably a lost connection, which may mean the
-          // instance is restarting
-          reconnect = true;
-        } else {
-          throw;
-        }
-      }
-    }
-
-    shcore::sleep_ms(poll_interval_ms);
-    timeout_sec--;
-  }
+  monitor.wait(
+      [&monitor](bool) {
+        // We keep trying until we can detect clone has started
+        return !monitor.state(0).clone_state.empty();
+      },
+      std::chrono::seconds{timeout_sec}, stop);
 
   if (stop) throw stop_monitoring();
 
-  return out_instance;
+  return monitor.instance(0);
 }
 
 void monitor_distributed_recovery(const mysqlshdk::mysql::IInstance &instance,
@@ -369,10 +344,14 @@ void monitor_distributed_recovery(const mysqlshdk::mysql::IInstance &instance,
   console->print_info("* Waiting for distributed recovery to finish...");
   bool first = true;
 
+  // channel details are only fetched if something has changed
+  Poll_interval interval = recovery_poll_interval();
+  Recovery_state last_state;
   std::string last_error_time;
   while (!stop) {
-    mysqlshdk::gr::Member_state state =
-        mysqlshdk::gr::get_member_state(instance);
+    Recovery_state recovery_state = get_recovery_state(instance, "", false);
+    const bool changed = first || recovery_state != last_state;
+    mysqlshdk::gr::Member_state state = recovery_state.get_member_state();
 
     if (state == mysqlshdk::gr::Member_state::ONLINE) {
       log_debug("State of %s became ONLINE", instance.descr().c_str());
@@ -386,7 +365,7 @@ void monitor_distributed_recovery(const mysqlshdk::mysql::IInstance &instance,
       // not supposed to happen
       log_debug("State of %s became OFFLINE", instance.descr().c_str());
       break;
-    } else {
+    } else if (changed) {
       mysqlshdk::mysql::Replication_channel channel;
 
       last_error_time =
@@ -402,7 +381,8 @@ void monitor_distributed_recovery(const mysqlshdk::mysql::IInstance &instance,
     }
     assert(state == mysqlshdk::gr::Member_state::RECOVERING);
 
-    shcore::sleep_ms(k_recovery_status_poll_interval_ms);
+    sleep_unless_stopped(interval.next(changed), stop);
+    last_state = std::move(recovery_state);
   }
 
   if (stop) throw stop_monitoring();
@@ -448,8 +428,17 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
     return true;
   });
 
-  auto poll_interval_ms = k_clone_status_poll_interval_ms;
-  DBUG_EXECUTE_IF("clone_rig_poll_interval", { poll_interval_ms = 10; });
+  // clone goes through several stages, check quickly after each transition
+  Poll_interval interval = clone_poll_interval();
+  std::pair<std::string, int> last_stage;
+
+  const auto stage_changed = [&last_stage](
+                                 const mysqlshdk::mysql::Clone_status &status) {
+    auto stage = std::make_pair(status.state, status.current_stage());
+    if (stage == last_stage) return false;
+    last_stage = std::move(stage);
+    return true;
+  };
 
   bool first = true;
   console->print_info("* Waiting for clone to finish...");
@@ -501,7 +490,7 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
       break;
     }
 
-    shcore::sleep_ms(poll_interval_ms);
+    sleep_unless_stopped(interval.next(stage_changed(status)), stop);
   }
   if (stop && !ignore_cancel) throw stop_monitoring();
 
@@ -582,7 +571,7 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
       console->print_info();
       break;
     }
-    shcore::sleep_ms(k_clone_status_poll_interval_ms);
+    sleep_unless_stopped(interval.next(stage_changed(status)), stop);
   }
   if (stop && !ignore_cancel) throw stop_monitoring();
 
@@ -607,10 +596,11 @@ void monitor_post_clone_gr_recovery_status(
   mysqlshdk::gr::Group_member_recovery_status rm =
       mysqlshdk::gr::Group_member_recovery_status::UNKNOWN;
 
-  int startup_timeout_iters =
-      adjust_timeout(startup_timeout_sec, k_recovery_status_poll_interval_ms);
+  Poll_interval interval = recovery_poll_interval();
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::seconds{startup_timeout_sec};
 
-  while (startup_timeout_iters > 0 && !stop) {
+  while (std::chrono::steady_clock::now() < deadline && !stop) {
     try {
       rm = mysqlshdk::gr::detect_recovery_status(*instance, begin_time);
       if (rm != mysqlshdk::gr::Group_member_recovery_status::CLONE) {
@@ -623,8 +613,7 @@ void monitor_post_clone_gr_recovery_status(
       log_warning("During post-clone recovery start check: %s", err.what());
       throw;
     }
-    shcore::sleep_ms(k_recovery_status_poll_interval_ms);
-    startup_timeout_iters--;
+    sleep_unless_stopped(interval.next(false), stop);
   }
 
   if (stop) throw stop_monitoring();
@@ -34,8 +34,12 @@
 namespace mysqlsh {
 namespace dba {
 
+// checks are done with an adaptive interval, which starts with the minimum
+// value after each state transition and grows up to the maximum one
 constexpr const int k_recovery_status_poll_interval_ms = 1000;
+constexpr const int k_recovery_status_min_poll_interval_ms = 100;
 constexpr const int k_clone_status_poll_interval_ms = 500;
+constexpr const int k_clone_status_min_poll_interval_ms = 100;
 
 class stop_monitoring {};
 class restart_timeout {};
@@ -47,6 +47,7 @@
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -672,6 +673,10 @@ State check_installed_schema_version(
 }
 
 void install(const std::shared_ptr<Instance> &group_server) {
+  // schema is modified directly, cached reads are no longer valid
+  const auto invalidate = shcore::on_leave_scope(
+      []() { MetadataStorage::invalidate_read_caches(); });
+
   try {
     execute_script(group_server,
                    scripts::get_metadata_script(
@@ -696,6 +701,7 @@ void install(const std::shared_ptr<Instance> &group_server) {
 
 void uninstall(const std::shared_ptr<Instance> &group_server) {
   group_server->executef("DROP SCHEMA IF EXISTS !", kMetadataSchemaName);
+  MetadataStorage::invalidate_read_caches();
 }
 
 std::vector<const upgrade::Step *> get_upgrade_path(
@@ -928,6 +934,9 @@ void upgrade_schema(const std::shared_ptr<Instance> &group_server,
 void upgrade_or_restore_schema(const std::shared_ptr<Instance> &group_server,
                                bool dry_run) {
   auto console = mysqlsh::current_console();
+  // schema is modified directly, cached reads are no longer valid
+  const auto invalidate = shcore::on_leave_scope(
+      []() { MetadataStorage::invalidate_read_caches(); });
 
   upgrade::Stage stage = upgrade::detect_failed_stage(group_server);
 
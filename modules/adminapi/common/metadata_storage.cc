@@ -26,6 +26,8 @@
 #include <mysql.h>
 #include <mysqld_error.h>
 
+#include <atomic>
+#include <cinttypes>
 #include <list>
 
 #include "modules/adminapi/cluster/cluster_impl.h"
@@ -36,6 +38,7 @@
 #include "modules/adminapi/common/sql.h"
 #include "modules/adminapi/replica_set/replica_set_impl.h"
 #include "mysql/group_replication.h"
+#include "mysqlshdk/libs/db/row_copy.h"
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/shellcore/shell_console.h"
 
@@ -290,6 +293,98 @@ constexpr const int k_lock_timeout = 60;
 const mysqlshdk::utils::Version k_json_merge_deprecated_version =
     mysqlshdk::utils::Version(5, 7, 22);
 
+// Maximum number of results held by the read cache, it's cleared if that
+// number is exceeded.
+constexpr std::size_t k_max_cached_results = 512;
+
+// Number of statements which could have modified the metadata, executed by
+// all MetadataStorage objects, used to invalidate the read caches.
+std::atomic<uint64_t> g_metadata_write_generation{0};
+
+// Number of locks acquired by this process, used to revalidate the read caches.
+std::atomic<uint64_t> g_metadata_lock_generation{0};
+
+bool is_select(const std::string &sql) {
+  const auto pos = sql.find_first_not_of(" \t\r\n(");
+  return pos != std::string::npos &&
+         shcore::str_ibeginswith(std::string_view{sql}.substr(pos), "SELECT");
+}
+
+bool is_cacheable(const std::string &sql) {
+  if (!is_select(sql)) return false;
+
+  // only deterministic reads of the metadata schema are cached
+  const auto stmt = shcore::str_lower(sql);
+
+  return stmt.find("mysql_innodb_cluster_metadata") != std::string::npos &&
+         stmt.find("uuid()") == std::string::npos &&
+         stmt.find(" for update") == std::string::npos &&
+         stmt.find(" for share") == std::string::npos;
+}
+
+}  // namespace
+
+struct MetadataStorage::Cached_rows {
+  std::vector<mysqlshdk::db::Column> metadata;
+  std::shared_ptr<mysqlshdk::db::Field_names> field_names;
+  std::vector<std::unique_ptr<mysqlshdk::db::Row_copy>> rows;
+};
+
+namespace {
+
+// Result served from the read cache, rows are shared with the cache. Type of
+// rows is a parameter, because it's private to MetadataStorage.
+template <class Rows>
+class Cached_result final : public mysqlshdk::db::IResult {
+ public:
+  explicit Cached_result(std::shared_ptr<const Rows> rows)
+      : m_rows(std::move(rows)) {}
+
+  const mysqlshdk::db::IRow *fetch_one() override {
+    return m_next < m_rows->rows.size() ? m_rows->rows[m_next++].get()
+                                        : nullptr;
+  }
+
+  bool next_resultset() override { return false; }
+
+  std::unique_ptr<mysqlshdk::db::Warning> fetch_one_warning() override {
+    return {};
+  }
+
+  int64_t get_auto_increment_value() const override { return 0; }
+
+  bool has_resultset() override { return true; }
+
+  uint64_t get_affected_row_count() const override { return 0; }
+
+  uint64_t get_fetched_row_count() const override { return m_next; }
+
+  uint64_t get_warning_count() const override { return 0; }
+
+  std::string get_info() const override { return {}; }
+
+  const std::vector<std::string> &get_gtids() const override {
+    return m_gtids;
+  }
+
+  const std::vector<mysqlshdk::db::Column> &get_metadata() const override {
+    return m_rows->metadata;
+  }
+
+  std::shared_ptr<mysqlshdk::db::Field_names> field_names() const override {
+    return m_rows->field_names;
+  }
+
+  void buffer() override {}
+
+  void rewind() override { m_next = 0; }
+
+ private:
+  std::shared_ptr<const Rows> m_rows;
+  std::size_t m_next = 0;
+  std::vector<std::string> m_gtids;
+};
+
 }  // namespace
 
 MetadataStorage::MetadataStorage(const std::shared_ptr<Instance> &instance)
@@ -305,6 +400,16 @@ MetadataStorage::MetadataStorage(const Instance &instance)
 }
 
 MetadataStorage::~MetadataStorage() {
+  if (m_cache_stats.hits + m_cache_stats.misses > 0) {
+    log_debug(
+        "Metadata read cache: %" PRIu64 " hits, %" PRIu64 " misses, %" PRIu64
+        " validations, %" PRIu64 " invalidations, %.1f%% hit rate, %" PRIu64
+        " queries avoided",
+        m_cache_stats.hits, m_cache_stats.misses, m_cache_stats.validations,
+        m_cache_stats.invalidations, m_cache_stats.hit_rate() * 100,
+        m_cache_stats.queries_avoided());
+  }
+
   if (m_md_server && m_owns_md_server) m_md_server->release();
 }
 
@@ -458,9 +563,20 @@ bool MetadataStorage::check_all_members_online() const {
 std::shared_ptr<mysqlshdk::db::IResult> MetadataStorage::execute_sql(
     const std::string &sql) const {
   std::shared_ptr<mysqlshdk::db::IResult> ret_val;
+  const bool cacheable = m_cache_enabled && is_cacheable(sql);
+
+  if (cacheable) {
+    if ((ret_val = get_cached_result(sql))) return ret_val;
+  } else if (!is_select(sql)) {
+    // anything else than a query may modify the metadata (or end the
+    // transaction which did that)
+    ++g_metadata_write_generation;
+  }
 
   try {
     ret_val = m_md_server->query(sql);
+
+    if (cacheable) ret_val = cache_result(sql, ret_val);
   } catch (const shcore::Error &err) {
     log_warning("While querying metadata: %s\n\t%s", err.format().c_str(),
                 sql.c_str());
@@ -486,6 +602,127 @@ std::shared_ptr<mysqlshdk::db::IResult> MetadataStorage::execute_sql(
   return ret_val;
 }
 
+void MetadataStorage::enable_read_cache() {
+  m_cache_enabled = true;
+  // cache is empty, writes executed so far do not affect it
+  m_cache_write_generation = g_metadata_write_generation;
+}
+
+void MetadataStorage::invalidate_cached() {
+  m_md_state = mysqlsh::dba::metadata::State::NONEXISTING;
+
+  // drop the reads cached before the last write
+  if (m_cache_write_generation != g_metadata_write_generation) {
+    clear_read_cache();
+  }
+
+  // cached reads need to be revalidated before they are used again
+  m_cache_validated = false;
+  m_cache_suspended = false;
+}
+
+std::shared_ptr<mysqlshdk::db::IResult> MetadataStorage::get_cached_result(
+    const std::string &sql) const {
+  if (m_cache_write_generation != g_metadata_write_generation) {
+    // the metadata was modified, do not cache the reads until the next API call
+    // or lock, otherwise each read following a write would need an additional
+    // round trip to be revalidated
+    clear_read_cache();
+    m_cache_suspended = true;
+  }
+
+  if (m_cache_lock_generation != g_metadata_lock_generation) {
+    m_cache_validated = false;
+    m_cache_suspended = false;
+  }
+
+  if (m_cache_suspended) {
+    ++m_cache_stats.misses;
+    return {};
+  }
+
+  if (!m_cache_validated) {
+    ++m_cache_stats.validations;
+    m_cache_lock_generation = g_metadata_lock_generation;
+
+    // the generation needs to be checked before the data is read, so that a
+    // write committed in between is detected by the next validation
+    std::string gtid_executed;
+
+    try {
+      gtid_executed = m_md_server->query("SELECT @@GLOBAL.gtid_executed")
+                          ->fetch_one_or_throw()
+                          ->get_string(0, "");
+    } catch (const shcore::Error &e) {
+      log_debug("Could not validate the metadata read cache: %s",
+                e.format().c_str());
+      clear_read_cache();
+      return {};
+    }
+
+    if (gtid_executed != m_cache_gtid_executed) {
+      clear_read_cache();
+      m_cache_gtid_executed = std::move(gtid_executed);
+    }
+
+    m_cache_validated = true;
+  }
+
+  const auto it = m_cache.find(sql);
+
+  if (m_cache.end() == it) {
+    ++m_cache_stats.misses;
+    return {};
+  }
+
+  ++m_cache_stats.hits;
+  return std::make_shared<Cached_result<Cached_rows>>(it->second);
+}
+
+std::shared_ptr<mysqlshdk::db::IResult> MetadataStorage::cache_result(
+    const std::string &sql,
+    const std::shared_ptr<mysqlshdk::db::IResult> &result) const {
+  if (!m_cache_validated) {
+    // validation has failed, cannot tell if data is up to date
+    return result;
+  }
+
+  auto rows = std::make_shared<Cached_rows>();
+
+  rows->metadata = result->get_metadata();
+  rows->field_names =
+      std::make_shared<mysqlshdk::db::Field_names>(rows->metadata);
+
+  while (const auto row = result->fetch_one()) {
+    rows->rows.emplace_back(std::make_unique<mysqlshdk::db::Row_copy>(*row));
+  }
+
+  if (m_cache.size() >= k_max_cached_results) {
+    ++m_cache_stats.invalidations;
+    m_cache.clear();
+  }
+
+  m_cache.emplace(sql, rows);
+
+  return std::make_shared<Cached_result<Cached_rows>>(std::move(rows));
+}
+
+void MetadataStorage::invalidate_read_caches() {
+  ++g_metadata_write_generation;
+}
+
+void MetadataStorage::revalidate_read_caches() { ++g_metadata_lock_generation; }
+
+void MetadataStorage::clear_read_cache() const {
+  if (!m_cache.empty()) {
+    ++m_cache_stats.invalidations;
+    m_cache.clear();
+  }
+
+  m_cache_validated = false;
+  m_cache_write_generation = g_metadata_write_generation;
+}
+
 Cluster_metadata MetadataStorage::unserialize_cluster_metadata(
     const mysqlshdk::db::Row_ref_by_name &row,
     const mysqlshdk::utils::Version &version) const {
@@ -1712,6 +1949,8 @@ void MetadataStorage::get_lock_exclusive() const {
                 k_lock, m_md_server->descr().c_str());
       mysqlshdk::mysql::get_lock(*m_md_server, k_lock_name_metadata, k_lock,
                                  mode, timeout);
+      // metadata cached before the lock was held may be stale
+      revalidate_read_caches();
     } catch (const shcore::Error &err) {
       // Abort the operation in case the required lock cannot be acquired.
       log_debug("Failed to get %s lock ('%s', '%s'): %s",
@@ -522,9 +522,67 @@ class MetadataStorage {
  public:
   mysqlsh::dba::metadata::State get_state() { return m_md_state; }
 
-  void invalidate_cached() {
-    m_md_state = mysqlsh::dba::metadata::State::NONEXISTING;
-  }
+  void invalidate_cached();
+
+  /**
+   * Counters of the metadata read cache.
+   */
+  struct Cache_stats {
+    // queries answered from the cache
+    uint64_t hits = 0;
+    // cacheable queries which were sent to the server
+    uint64_t misses = 0;
+    // generation checks sent to the server
+    uint64_t validations = 0;
+    // number of times the cached results were discarded
+    uint64_t invalidations = 0;
+
+    double hit_rate() const {
+      return hits + misses > 0 ? static_cast<double>(hits) / (hits + misses)
+                               : 0.0;
+    }
+
+    // generation checks are round trips too
+    uint64_t queries_avoided() const {
+      return hits > validations ? hits - validations : 0;
+    }
+  };
+
+  /**
+   * Enables the cache of the metadata reads made by this object.
+   *
+   * Results of the metadata queries are kept until any statement which can
+   * modify the metadata is executed by any MetadataStorage object of this
+   * process, every statement other than a SELECT is treated as such. Reads
+   * are not cached after such statement until invalidate_cached() is called
+   * (at the beginning of each API call) or a lock is acquired, as this would
+   * require each read following a write to be revalidated. After either of
+   * these, cached results are used only if no transactions were committed in
+   * the metadata server since they were fetched, which is checked by
+   * comparing its GTID_EXECUTED.
+   */
+  void enable_read_cache();
+
+  /**
+   * Discards the cached reads of all MetadataStorage objects of this process.
+   *
+   * Statements executed by MetadataStorage do this automatically, this needs
+   * to be called when the metadata is modified by other means, i.e. when the
+   * schema is installed, upgraded or restored.
+   */
+  static void invalidate_read_caches();
+
+  /**
+   * Makes the cached reads of all MetadataStorage objects of this process to be
+   * revalidated before they are used again.
+   *
+   * Needs to be called once a metadata, cluster or instance lock is acquired,
+   * rows cached before the lock was held may have been modified by another
+   * process which was holding it.
+   */
+  static void revalidate_read_caches();
+
+  const Cache_stats &cache_stats() const { return m_cache_stats; }
 
   /**
    * This function returns the current installed version of the MD schema
@@ -668,9 +726,34 @@ class MetadataStorage {
   mutable mysqlsh::dba::metadata::State m_md_state =
       mysqlsh::dba::metadata::State::NONEXISTING;
 
+  // read cache, see enable_read_cache()
+  struct Cached_rows;
+
+  bool m_cache_enabled = false;
+  mutable bool m_cache_validated = false;
+  // set when the metadata was modified, until the next API call or lock
+  mutable bool m_cache_suspended = false;
+  // GTID_EXECUTED of the metadata server when the cache was validated
+  mutable std::string m_cache_gtid_executed;
+  // number of metadata writes in this process when the cache was validated
+  mutable uint64_t m_cache_write_generation = 0;
+  // number of acquired locks in this process when the cache was validated
+  mutable uint64_t m_cache_lock_generation = 0;
+  mutable std::map<std::string, std::shared_ptr<const Cached_rows>> m_cache;
+  mutable Cache_stats m_cache_stats;
+
   std::shared_ptr<mysqlshdk::db::IResult> execute_sql(
       const std::string &sql) const;
 
+  std::shared_ptr<mysqlshdk::db::IResult> get_cached_result(
+      const std::string &sql) const;
+
+  std::shared_ptr<mysqlshdk::db::IResult> cache_result(
+      const std::string &sql,
+      const std::shared_ptr<mysqlshdk::db::IResult> &result) const;
+
+  void clear_read_cache() const;
+
   template <typename... Args>
   inline std::shared_ptr<mysqlshdk::db::IResult> execute_sqlf(
       const std::string &sql, const Args &... args) const {
@@ -402,14 +402,13 @@ Reboot_cluster_from_complete_outage::pick_best_instance_gtid(
   }
 
   std::set<std::string> conflits;
-  auto primary_candidates =
-      filter_primary_candidates(*m_target_instance, instance_gtids,
-                                [&conflits](const Instance_gtid_info &instA,
-                                            const Instance_gtid_info &instB) {
-                                  conflits.insert(instA.server);
-                                  conflits.insert(instB.server);
-                                  return true;
-                                });
+  auto primary_candidates = filter_primary_candidates(
+      instance_gtids, [&conflits](const Instance_gtid_info &instA,
+                                  const Instance_gtid_info &instB) {
+        conflits.insert(instA.server);
+        conflits.insert(instB.server);
+        return true;
+      });
 
   assert(!conflits.empty() || !primary_candidates.empty());
 
@@ -298,12 +298,14 @@ void Upgrade_metadata::prepare_rolling_upgrade() {
               m_target_instance->execute(
                   "DELETE FROM mysql_innodb_cluster_metadata.routers WHERE "
                   "router_id = 2");
+              MetadataStorage::invalidate_read_caches();
             });
             DBUG_EXECUTE_IF("dba_EMULATE_ROUTER_UPGRADE", {
               m_target_instance->execute(
                   "UPDATE mysql_innodb_cluster_metadata.routers SET "
                   "attributes=JSON_OBJECT('version','8.0.19') WHERE "
                   "router_id = 2");
+              MetadataStorage::invalidate_read_caches();
             });
 
             routers = get_outdated_routers();
@@ -457,6 +459,7 @@ void Upgrade_metadata::upgrade_router_users() {
         m_target_instance->execute(
             "CREATE OR REPLACE VIEW mysql_innodb_cluster_metadata.v2_routers "
             "AS SELECT 1");
+        MetadataStorage::invalidate_read_caches();
       }
 
       log_debug("Metadata upgrade for version %s, upgraded Router accounts:",
@@ -27,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "modules/devapi/base_constants.h"
 #include "modules/mod_utils.h"
@@ -96,7 +97,7 @@ std::unique_ptr<mysqlsh::Row> ShellBaseResult::fetch_one_row() const {
   if (result && columns) {
     const mysqlshdk::db::IRow *row = result->fetch_one();
     if (row) {
-      ret_val = std::make_unique<mysqlsh::Row>(columns, *row);
+      ret_val = std::make_unique<mysqlsh::Row>(get_row_schema(), *row);
     }
   }
 
@@ -115,9 +116,20 @@ std::shared_ptr<std::vector<std::string>> ShellBaseResult::get_column_names()
   return m_column_names;
 }
 
+std::shared_ptr<Row_schema> ShellBaseResult::get_row_schema() const {
+  update_column_cache();
+
+  if (!m_row_schema && m_column_names) {
+    m_row_schema = std::make_shared<Row_schema>(*m_column_names);
+  }
+
+  return m_row_schema;
+}
+
 void ShellBaseResult::reset_column_cache() const {
   m_columns.reset();
   m_column_names.reset();
+  m_row_schema.reset();
 }
 
 void ShellBaseResult::update_column_cache() const {
@@ -255,45 +267,103 @@ object if two conditions are met:
 In the case a field does not met these conditions, it must be retrieved through
 the Row.<<<getField>>>(@<field_name@>) function.
 )*");
-Row::Row() {
+namespace {
+
+bool is_row_member(const std::string &name) {
+  // members of the Row object take precedence over the fields
+  static const Row s_row;
+  return s_row.has_member(name);
+}
+
+}  // namespace
+
+Row_schema::Row_schema(const std::vector<std::string> &names) {
+  m_names.reserve(names.size());
+  m_fields.reserve(names.size());
+
+  for (const auto &name : names) {
+    add(name);
+  }
+}
+
+void Row_schema::add(const std::string &name) {
+  const auto index = m_names.size();
+  m_names.emplace_back(name);
+
+  // in case of duplicates, the first field is the one available by name
+  if (m_fields.find(name) != m_fields.end()) return;
+
+  // Values are available as properties if they are valid identifiers and not
+  // base members like length and getField, i.e. row.property
+  // Properties for Row Fields are exposed exactly as the field name in both
+  // JavaScript and Python, the naming style is not applied to them, i.e. a
+  // property like NAME is not turned into n_a_m_e for Python
+  const bool property =
+      shcore::is_valid_identifier(name) && !is_row_member(name);
+
+  m_fields.emplace(name, Field{index, property});
+
+  if (property) m_properties.emplace_back(name);
+}
+
+size_t Row_schema::index_of(const std::string &name) const {
+  const auto it = m_fields.find(name);
+  return m_fields.end() == it ? std::string::npos : it->second.index;
+}
+
+bool Row_schema::is_property(const std::string &name) const {
+  const auto it = m_fields.find(name);
+  return m_fields.end() != it && it->second.property;
+}
+
+Row::Row() : m_schema(std::make_shared<Row_schema>()) {
   add_property("length", "getLength");
   expose("getField", &Row::get_field, "fieldName");
-  names.reset(new std::vector<std::string>());
 }
 
-Row::Row(std::shared_ptr<std::vector<std::string>> names_,
-         const mysqlshdk::db::IRow &row)
-    : names(names_) {
-  assert(names);
+Row::Row(std::shared_ptr<Row_schema> schema, const mysqlshdk::db::IRow &row)
+    : m_schema(std::move(schema)) {
+  assert(m_schema);
 
   add_property("length", "getLength");
   expose("getField", &Row::get_field, "fieldName");
 
-  assert(row.num_fields() == names_->size());
-  for (uint32_t i = 0, c = row.num_fields(); i < c; i++) {
-    const std::string &key = names_->at(i);
-    // Values would be available as properties if they are valid identifier
-    // and not base members like length and getField
-    // O on this case the values would be available as
-    // row.property
-    // Properties for Row Fields are exposed exactly as the field name in both
-    // JavaScript and Python, hence the property is registered as
-    // <jsname> | <pyname> to avoid the naming enforcement logic to mess with
-    // the property name.
-    // i.e. without this a property like NAME would be turned into n_a_m_e for
-    // Python
-    if (shcore::is_valid_identifier(key) && !has_member(key))
-      add_property(key + "|" + key);
+  assert(row.num_fields() == m_schema->size());
+
+  const auto size = row.num_fields();
+
+  if (size > 0) {
+    m_values.resize(size);
+    m_converted.resize(size, false);
+    m_row = std::make_unique<mysqlshdk::db::Row_copy>(row);
   }
+}
+
+const shcore::Value &Row::value(size_t index) const {
+  assert(index < m_values.size());
+
+  if (!m_converted[index]) {
+    assert(m_row);
 
-  value_array = get_row_values(row);
+    m_values[index] = get_row_value(*m_row, static_cast<uint32_t>(index));
+    m_converted[index] = true;
+
+    if (++m_converted_count == m_values.size()) {
+      // all fields are converted, copy of the row is no longer needed
+      m_row.reset();
+    }
+  }
+
+  return m_values[index];
 }
 
 shcore::Dictionary_t Row::as_object() {
   auto ret_val = shcore::make_dict();
 
-  for (size_t index = 0; index < names->size(); index++) {
-    ret_val->emplace(names->at(index), value_array.at(index));
+  const auto &names = m_schema->names();
+
+  for (size_t index = 0; index < names.size(); index++) {
+    ret_val->emplace(names[index], value(index));
   }
 
   return ret_val;
@@ -303,15 +373,14 @@ std::string &Row::append_descr(std::string &s_out, int indent,
                                int UNUSED(quote_strings)) const {
   std::string nl = (indent >= 0) ? "\n" : "";
   s_out += "[";
-  for (size_t index = 0; index < value_array.size(); index++) {
+  for (size_t index = 0; index < m_values.size(); index++) {
     if (index > 0) s_out += ", ";
 
     s_out += nl;
 
     if (indent >= 0) s_out.append((indent + 1) * 4, ' ');
 
-    value_array[index].append_descr(s_out, indent < 0 ? indent : indent + 1,
-                                    '"');
+    value(index).append_descr(s_out, indent < 0 ? indent : indent + 1, '"');
   }
 
   s_out += nl;
@@ -325,8 +394,10 @@ std::string &Row::append_descr(std::string &s_out, int indent,
 void Row::append_json(shcore::JSON_dumper &dumper) const {
   dumper.start_object();
 
-  for (size_t index = 0; index < value_array.size(); index++)
-    dumper.append_value(names->at(index), value_array[index]);
+  const auto &names = m_schema->names();
+
+  for (size_t index = 0; index < m_values.size(); index++)
+    dumper.append_value(names[index], value(index));
 
   dumper.end_object();
 }
@@ -354,9 +425,9 @@ Object Row::getField(String name) {}
 object Row::get_field(str name) {}
 #endif
 shcore::Value Row::get_field(const std::string &name) const {
-  auto iter = std::find(names->begin(), names->end(), name);
-  if (iter != names->end())
-    return value_array[iter - names->begin()];
+  const auto index = m_schema->index_of(name);
+  if (std::string::npos != index)
+    return value(index);
   else
     throw shcore::Exception::argument_error("Field " + name +
                                             " does not exist");
@@ -374,12 +445,40 @@ Integer Row::getLength() {}
 #elif DOXYGEN_PY
 int Row::get_length() {}
 #endif
+std::vector<std::string> Row::get_members() const {
+  auto members = Cpp_object_bridge::get_members();
+  const auto &properties = m_schema->properties();
+
+  // fields follow the properties of this object
+  members.insert(members.begin() + _properties.size(), properties.begin(),
+                 properties.end());
+
+  return members;
+}
+
+bool Row::has_member(const std::string &prop) const {
+  return m_schema->is_property(prop) || Cpp_object_bridge::has_member(prop);
+}
+
+bool Row::has_member_advanced(const std::string &prop) const {
+  return m_schema->is_property(prop) ||
+         Cpp_object_bridge::has_member_advanced(prop);
+}
+
+shcore::Value Row::get_member_advanced(const std::string &prop) const {
+  if (!lookup_function(prop) && m_schema->is_property(prop)) {
+    return value(m_schema->index_of(prop));
+  }
+
+  return Cpp_object_bridge::get_member_advanced(prop);
+}
+
 shcore::Value Row::get_member(const std::string &prop) const {
   if (prop == "length") {
-    return shcore::Value((int)value_array.size());
+    return shcore::Value((int)m_values.size());
   } else {
-    auto it = std::find(names->begin(), names->end(), prop);
-    if (it != names->end()) return value_array[it - names->begin()];
+    const auto index = m_schema->index_of(prop);
+    if (std::string::npos != index) return value(index);
   }
 
   return shcore::Cpp_object_bridge::get_member(prop);
@@ -391,20 +490,21 @@ shcore::Value Row::get_member(const std::string &prop) const {
  */
 #endif
 shcore::Value Row::get_member(size_t index) const {
-  if (index < value_array.size())
-    return value_array[index];
+  if (index < m_values.size())
+    return value(index);
   else
     return shcore::Value();
 }
 
 void Row::add_item(const std::string &key, shcore::Value value) {
+  // schema may be shared with other rows
+  if (m_schema.use_count() > 1) {
+    m_schema = std::make_shared<Row_schema>(*m_schema);
+  }
+
   // All the values are available through index
-  value_array.push_back(value);
-  names->push_back(key);
-
-  // Values would be available as properties if they are valid identifier
-  // and not base members like lenght and getField
-  // O on this case the values would be available as
-  // row.property
-  if (shcore::is_valid_identifier(key) && !has_member(key)) add_property(key);
+  m_values.push_back(value);
+  m_converted.push_back(true);
+  ++m_converted_count;
+  m_schema->add(key);
 }
@@ -30,16 +30,76 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "db/column.h"
 #include "db/row.h"
 #include "modules/mod_common.h"
 #include "mysqlshdk/libs/db/result.h"
+#include "mysqlshdk/libs/db/row_copy.h"
 #include "scripting/types.h"
 #include "scripting/types_cpp.h"
 
 namespace mysqlsh {
 class Row;
+
+/**
+ * Describes the fields of the Row objects: their names, position of each name
+ * and which of them are exposed as properties of a Row.
+ *
+ * A single instance is shared by all the rows fetched from a result, so the
+ * rows do not need to register their fields as members one by one.
+ */
+class Row_schema final {
+ public:
+  Row_schema() = default;
+  explicit Row_schema(const std::vector<std::string> &names);
+
+  Row_schema(const Row_schema &other) = default;
+  Row_schema(Row_schema &&other) = default;
+
+  Row_schema &operator=(const Row_schema &other) = default;
+  Row_schema &operator=(Row_schema &&other) = default;
+
+  ~Row_schema() = default;
+
+  /**
+   * Appends a field.
+   */
+  void add(const std::string &name);
+
+  const std::vector<std::string> &names() const { return m_names; }
+
+  size_t size() const { return m_names.size(); }
+
+  /**
+   * Position of the first field with the given name.
+   *
+   * @returns position of the field, or std::string::npos if there's none.
+   */
+  size_t index_of(const std::string &name) const;
+
+  /**
+   * Whether the given field is exposed as a property of a Row.
+   */
+  bool is_property(const std::string &name) const;
+
+  /**
+   * Names of the fields which are exposed as properties, in order.
+   */
+  const std::vector<std::string> &properties() const { return m_properties; }
+
+ private:
+  struct Field {
+    size_t index;
+    bool property;
+  };
+
+  std::vector<std::string> m_names;
+  std::unordered_map<std::string, Field> m_fields;
+  std::vector<std::string> m_properties;
+};
+
 // This is the Shell Common Base Class for all the resultset classes
 class ShellBaseResult : public shcore::Cpp_object_bridge {
  public:
@@ -52,6 +112,7 @@ class ShellBaseResult : public shcore::Cpp_object_bridge {
   virtual mysqlshdk::db::IResult *get_result() const = 0;
   // shcore::Value::Array_type_ref get_columns() const { return m_columns; }
   std::shared_ptr<std::vector<std::string>> get_column_names() const;
+  std::shared_ptr<Row_schema> get_row_schema() const;
 
   std::vector<std::string> get_members() const override;
 
@@ -76,6 +137,7 @@ class ShellBaseResult : public shcore::Cpp_object_bridge {
 
   mutable shcore::Value::Array_type_ref m_columns;
   mutable std::shared_ptr<std::vector<std::string>> m_column_names;
+  mutable std::shared_ptr<Row_schema> m_row_schema;
 };
 
 /**
@@ -300,14 +362,10 @@ class SHCORE_PUBLIC Row : public shcore::Cpp_object_bridge {
 #endif
 
   Row();
-  Row(std::shared_ptr<std::vector<std::string>> names,
-      const mysqlshdk::db::IRow &row);
+  Row(std::shared_ptr<Row_schema> schema, const mysqlshdk::db::IRow &row);
 
   virtual std::string class_name() const { return "Row"; }
 
-  std::shared_ptr<std::vector<std::string>> names;
-  std::vector<shcore::Value> value_array;
-
   virtual std::string &append_descr(std::string &s_out, int indent = -1,
                                     int quote_strings = 0) const;
   virtual std::string &append_repr(std::string &s_out) const;
@@ -317,15 +375,37 @@ class SHCORE_PUBLIC Row : public shcore::Cpp_object_bridge {
 
   virtual bool operator==(const Object_bridge &other) const;
 
+  std::vector<std::string> get_members() const override;
+  bool has_member(const std::string &prop) const override;
+  bool has_member_advanced(const std::string &prop) const override;
+  shcore::Value get_member_advanced(const std::string &prop) const override;
+
   virtual shcore::Value get_member(const std::string &prop) const;
   shcore::Value get_member(size_t index) const;
 
-  size_t get_length() { return value_array.size(); }
+  size_t get_length() { return m_values.size(); }
   virtual bool is_indexed() const { return true; }
 
   void add_item(const std::string &key, shcore::Value value);
 
   shcore::Dictionary_t as_object();
+
+ private:
+  // fields are resolved through the schema, they are not registered as
+  // properties of this object
+  std::shared_ptr<Row_schema> m_schema;
+
+  /**
+   * Returns the value of the given field, converting it on first access.
+   */
+  const shcore::Value &value(size_t index) const;
+
+  // copy of the fetched row, fields are converted to shcore::Values only when
+  // they are accessed, the copy is released once all of them are converted
+  mutable std::unique_ptr<mysqlshdk::db::Row_copy> m_row;
+  mutable std::vector<shcore::Value> m_values;
+  mutable std::vector<bool> m_converted;
+  mutable size_t m_converted_count = 0;
 };
 }  // namespace mysqlsh
 
@@ -596,75 +596,65 @@ Connection_options get_classic_connection_options(
   return co;
 }
 
-std::vector<shcore::Value> get_row_values(const mysqlshdk::db::IRow &row) {
+shcore::Value get_row_value(const mysqlshdk::db::IRow &row, uint32_t index) {
   using mysqlshdk::db::Type;
   using shcore::Date;
   using shcore::Value;
-  std::vector<Value> value_array;
 
-  for (uint32_t i = 0, c = row.num_fields(); i < c; i++) {
-    Value v;
+  if (row.is_null(index)) return Value::Null();
 
-    if (row.is_null(i)) {
-      v = Value::Null();
-    } else {
-      switch (row.get_type(i)) {
-        case Type::Null:
-          v = Value::Null();
-          break;
-
-        case Type::String:
-          v = Value(row.get_string(i));
-          break;
-
-        case Type::Integer:
-          v = Value(row.get_int(i));
-          break;
-
-        case Type::UInteger:
-          v = Value(row.get_uint(i));
-          break;
-
-        case Type::Float:
-          v = Value(row.get_float(i));
-          break;
-
-        case Type::Double:
-          v = Value(row.get_double(i));
-          break;
-
-        case Type::Decimal:
-          v = Value(row.get_as_string(i));
-          break;
-
-        case Type::Date:
-        case Type::DateTime:
-          v = Value::wrap(
-              std::make_shared<Date>(Date::unrepr(row.get_string(i))));
-          break;
-
-        case Type::Time:
-          v = Value::wrap(
-              std::make_shared<Date>(Date::unrepr(row.get_string(i))));
-          break;
-
-        case Type::Bit:
-          v = Value(std::get<0>(row.get_bit(i)));
-          break;
-
-        case Type::Bytes:
-          v = Value(row.get_string(i), true);
-          break;
-        case Type::Geometry:
-        case Type::Json:
-        case Type::Enum:
-        case Type::Set:
-          v = Value(row.get_string(i));
-          break;
-      }
-    }
+  switch (row.get_type(index)) {
+    case Type::Null:
+      return Value::Null();
+
+    case Type::String:
+      return Value(row.get_string(index));
+
+    case Type::Integer:
+      return Value(row.get_int(index));
+
+    case Type::UInteger:
+      return Value(row.get_uint(index));
+
+    case Type::Float:
+      return Value(row.get_float(index));
+
+    case Type::Double:
+      return Value(row.get_double(index));
+
+    case Type::Decimal:
+      return Value(row.get_as_string(index));
 
-    value_array.emplace_back(std::move(v));
+    case Type::Date:
+    case Type::DateTime:
+      return Value::wrap(
+          std::make_shared<Date>(Date::unrepr(row.get_string(index))));
+
+    case Type::Time:
+      return Value::wrap(
+          std::make_shared<Date>(Date::unrepr(row.get_string(index))));
+
+    case Type::Bit:
+      return Value(std::get<0>(row.get_bit(index)));
+
+    case Type::Bytes:
+      return Value(row.get_string(index), true);
+
+    case Type::Geometry:
+    case Type::Json:
+    case Type::Enum:
+    case Type::Set:
+      return Value(row.get_string(index));
+  }
+
+  return Value();
+}
+
+std::vector<shcore::Value> get_row_values(const mysqlshdk::db::IRow &row) {
+  std::vector<shcore::Value> value_array;
+
+  for (uint32_t i = 0, c = row.num_fields(); i < c; i++) {
+    value_array.emplace_back(get_row_value(row, i));
   }
 
   return value_array;
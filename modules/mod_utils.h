@@ -170,6 +170,16 @@ establish_mysql_session(const Connection_options &options,
 Connection_options SHCORE_PUBLIC get_classic_connection_options(
     const std::shared_ptr<mysqlshdk::db::ISession> &session);
 
+/**
+ * Converts an SQL value from a row into a shcore::Value.
+ *
+ * @param row Row which holds the value.
+ * @param index Position of the value in the row.
+ *
+ * @return Converted value.
+ */
+shcore::Value get_row_value(const mysqlshdk::db::IRow &row, uint32_t index);
+
 /**
  * Converts SQL values from a row into shcore::Values.
  *
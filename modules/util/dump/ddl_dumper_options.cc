@@ -64,6 +64,9 @@ const shcore::Option_pack_def<Ddl_dumper_options>
           .optional("chunking", &Ddl_dumper_options::m_split)
           .optional("bytesPerChunk", &Ddl_dumper_options::set_bytes_per_chunk)
           .optional("threads", &Ddl_dumper_options::m_threads)
+          .optional("compressionThreads",
+                    &Ddl_dumper_options::m_compression_threads)
+          .optional("metricsFormat", &Ddl_dumper_options::set_metrics_format)
           .optional("triggers", &Ddl_dumper_options::m_dump_triggers)
           .optional("tzUtc", &Ddl_dumper_options::m_timezone_utc)
           .optional("ddlOnly", &Ddl_dumper_options::m_ddl_only)
@@ -101,6 +104,21 @@ void Ddl_dumper_options::set_compatibility_options(
   }
 }
 
+void Ddl_dumper_options::set_metrics_format(const std::string &format) {
+  if (format.empty()) {
+    throw std::invalid_argument(
+        "The option 'metricsFormat' cannot be set to an empty string.");
+  }
+
+  try {
+    m_metrics_format = to_metrics_format(format);
+  } catch (const std::invalid_argument &) {
+    throw std::invalid_argument(
+        "The option 'metricsFormat' must be set to either 'json' or "
+        "'prometheus'.");
+  }
+}
+
 void Ddl_dumper_options::on_unpacked_options() {
   m_s3_bucket_options.throw_on_conflict(m_dump_manifest_options);
   m_s3_bucket_options.throw_on_conflict(m_blob_storage_options);
@@ -130,6 +148,13 @@ void Ddl_dumper_options::on_unpacked_options() {
         "The value of 'threads' option must be greater than 0.");
   }
 
+  if (m_compression_threads > 0 &&
+      mysqlshdk::storage::Compression::ZSTD != compression()) {
+    throw std::invalid_argument(
+        "The 'compressionThreads' option can only be used if the "
+        "'compression' option is set to 'zstd'.");
+  }
+
   if (m_ddl_only && m_data_only) {
     throw std::invalid_argument(
         "The 'ddlOnly' and 'dataOnly' options cannot be both set to true.");
@@ -24,6 +24,7 @@
 #ifndef MODULES_UTIL_DUMP_DDL_DUMPER_OPTIONS_H_
 #define MODULES_UTIL_DUMP_DDL_DUMPER_OPTIONS_H_
 
+#include <optional>
 #include <string>
 
 #include "mysqlshdk/libs/aws/s3_bucket_options.h"
@@ -53,6 +54,12 @@ class Ddl_dumper_options : public Dump_options {
 
   std::size_t threads() const override { return m_threads; }
 
+  uint64_t compression_threads() const override {
+    return m_compression_threads;
+  }
+
+  uint64_t compression_frame_size() const override { return 0; }
+
   bool is_export_only() const override { return false; }
 
   bool use_single_file() const override { return false; }
@@ -79,6 +86,10 @@ class Ddl_dumper_options : public Dump_options {
     return m_dump_manifest_options.par_manifest();
   }
 
+  std::optional<Metrics_format> metrics_format() const override {
+    return m_metrics_format;
+  }
+
  protected:
   Ddl_dumper_options();
 
@@ -91,6 +102,7 @@ class Ddl_dumper_options : public Dump_options {
   void set_bytes_per_chunk(const std::string &value);
   void set_ocimds(bool value);
   void set_compatibility_options(const std::vector<std::string> &options);
+  void set_metrics_format(const std::string &format);
 
   Dump_manifest_options m_dump_manifest_options;
   // this should be in the Dump_options class, but storing it at the same level
@@ -101,6 +113,8 @@ class Ddl_dumper_options : public Dump_options {
   bool m_split = true;
   uint64_t m_bytes_per_chunk;
   uint64_t m_threads = 4;
+  uint64_t m_compression_threads = 0;
+  std::optional<Metrics_format> m_metrics_format;
 
   bool m_dump_triggers = true;
   bool m_timezone_utc = true;
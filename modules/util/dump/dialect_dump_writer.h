@@ -33,6 +33,7 @@
 #include "mysqlshdk/libs/utils/utils_general.h"
 
 #include "modules/util/dump/dump_writer.h"
+#include "modules/util/dump/encoder.h"
 
 namespace mysqlsh {
 namespace dump {
@@ -170,6 +171,10 @@ class Dialect_dump_writer : public Dump_writer {
           m_needs_escape[i] = Escape_type::BASE64;
         else if (pre_encoded_columns[i] == Encoding_type::HEX)
           m_needs_escape[i] = Escape_type::NONE;
+        else if (pre_encoded_columns[i] == Encoding_type::ENCODE_BASE64)
+          m_needs_escape[i] = Escape_type::ENCODE_BASE64;
+        else if (pre_encoded_columns[i] == Encoding_type::ENCODE_HEX)
+          m_needs_escape[i] = Escape_type::ENCODE_HEX;
       }
 
       if (!T::fields_optionally_enclosed || is_string) {
@@ -217,6 +222,13 @@ class Dialect_dump_writer : public Dump_writer {
         case Escape_type::NONE:
           store_field<0>(data, length);
           break;
+        case Escape_type::ENCODE_BASE64:
+          // encoded data never contains characters which need to be escaped
+          buffer()->write_base64(data, length);
+          break;
+        case Escape_type::ENCODE_HEX:
+          buffer()->write_hex(data, length);
+          break;
       }
       quote_field(idx);
     }
@@ -244,6 +256,17 @@ class Dialect_dump_writer : public Dump_writer {
     const auto end = data + length;
 
     for (auto p = data; p != end; ++p) {
+      // copy the bytes which don't need to be escaped in one go
+      const auto next =
+          encoder::find_escape_candidate(p, end, s_escaped_characters);
+      buffer()->append(p, next - p);
+
+      if (next == end) {
+        break;
+      }
+
+      p = next;
+
       const auto c = *p;
       char to_write = 0;
 
@@ -373,6 +396,11 @@ class Dialect_dump_writer : public Dump_writer {
   static constexpr size_t s_fields_enclosed_by_length =
       shcore::array_size(T::fields_enclosed_by) - 1;
 
+  // characters which are escaped in addition to the control characters
+  static constexpr char s_escaped_characters[encoder::k_escaped_characters] =
+      {T::fields_escaped_by[0], T::fields_terminated_by[0],
+       T::lines_terminated_by[0], T::fields_enclosed_by[0]};
+
   uint32_t m_num_fields;
 
   // not using vectors of bool here, as they are not very efficient on access
@@ -385,7 +413,7 @@ class Dialect_dump_writer : public Dump_writer {
 
 }  // namespace detail
 
-class Default_dump_writer
+class Default_dump_writer final
     : public detail::Dialect_dump_writer<detail::default_traits> {
  public:
   using Dialect_dump_writer::Dialect_dump_writer;
@@ -399,7 +427,7 @@ class Default_dump_writer
   ~Default_dump_writer() override = default;
 };
 
-class Json_dump_writer
+class Json_dump_writer final
     : public detail::Dialect_dump_writer<detail::json_traits> {
  public:
   using Dialect_dump_writer::Dialect_dump_writer;
@@ -413,7 +441,8 @@ class Json_dump_writer
   ~Json_dump_writer() override = default;
 };
 
-class Csv_dump_writer : public detail::Dialect_dump_writer<detail::csv_traits> {
+class Csv_dump_writer final
+    : public detail::Dialect_dump_writer<detail::csv_traits> {
  public:
   using Dialect_dump_writer::Dialect_dump_writer;
 
@@ -426,7 +455,8 @@ class Csv_dump_writer : public detail::Dialect_dump_writer<detail::csv_traits> {
   ~Csv_dump_writer() override = default;
 };
 
-class Tsv_dump_writer : public detail::Dialect_dump_writer<detail::tsv_traits> {
+class Tsv_dump_writer final
+    : public detail::Dialect_dump_writer<detail::tsv_traits> {
  public:
   using Dialect_dump_writer::Dialect_dump_writer;
 
@@ -439,7 +469,7 @@ class Tsv_dump_writer : public detail::Dialect_dump_writer<detail::tsv_traits> {
   ~Tsv_dump_writer() override = default;
 };
 
-class Csv_unix_dump_writer
+class Csv_unix_dump_writer final
     : public detail::Dialect_dump_writer<detail::csv_unix_traits> {
  public:
   using Dialect_dump_writer::Dialect_dump_writer;
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/dump_metrics.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/utils_json.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "mysqlshdk/libs/utils/utils_time.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+struct Counter {
+  const char *json;
+  const char *prometheus;
+  const char *help;
+  uint64_t Table_data_metrics::*value;
+};
+
+struct Timer {
+  const char *json;
+  const char *prometheus;
+  const char *help;
+  std::chrono::nanoseconds Table_data_metrics::*value;
+};
+
+constexpr Counter k_counters[] = {
+    {"chunks", "mysqlsh_dump_table_chunks_total",
+     "Number of data chunks of a table which were dumped.",
+     &Table_data_metrics::chunks},
+    {"rows", "mysqlsh_dump_table_rows_total",
+     "Number of rows of a table which were dumped.", &Table_data_metrics::rows},
+    {"dataBytes", "mysqlsh_dump_table_data_bytes_total",
+     "Number of uncompressed bytes of a table which were dumped.",
+     &Table_data_metrics::data_bytes},
+    {"fileBytes", "mysqlsh_dump_table_file_bytes_total",
+     "Number of bytes written to the data files of a table.",
+     &Table_data_metrics::file_bytes},
+};
+
+constexpr Timer k_timers[] = {
+    {"seconds", "mysqlsh_dump_table_seconds_total",
+     "Wall time of the data chunks of a table which were dumped.",
+     &Table_data_metrics::time},
+    {"firstRowSeconds", "mysqlsh_dump_table_first_row_seconds_total",
+     "Time spent executing the queries and waiting for the first rows.",
+     &Table_data_metrics::first_row_time},
+    {"fetchSeconds", "mysqlsh_dump_table_fetch_seconds_total",
+     "Time spent fetching the rows from the server.",
+     &Table_data_metrics::fetch_time},
+    {"encodeSeconds", "mysqlsh_dump_table_encode_seconds_total",
+     "Time spent formatting and escaping the rows.",
+     &Table_data_metrics::encode_time},
+    {"writeSeconds", "mysqlsh_dump_table_write_seconds_total",
+     "Time spent compressing and writing the data files.",
+     &Table_data_metrics::write_time},
+    {"throttleSeconds", "mysqlsh_dump_table_throttle_seconds_total",
+     "Time spent waiting due to the maxRate option.",
+     &Table_data_metrics::throttle_time},
+};
+
+double seconds(std::chrono::nanoseconds ns) {
+  return std::chrono::duration<double>(ns).count();
+}
+
+std::string prometheus_label(const std::string &value) {
+  std::string result;
+  result.reserve(value.length());
+
+  for (const auto c : value) {
+    switch (c) {
+      case '\\':
+        result += "\\\\";
+        break;
+
+      case '"':
+        result += "\\\"";
+        break;
+
+      case '\n':
+        result += "\\n";
+        break;
+
+      default:
+        result += c;
+        break;
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
+Metrics_format to_metrics_format(const std::string &format) {
+  if ("json" == format) return Metrics_format::JSON;
+  if ("prometheus" == format) return Metrics_format::PROMETHEUS;
+
+  throw std::invalid_argument("Unknown metrics format: " + format);
+}
+
+std::string to_string(Metrics_format format) {
+  switch (format) {
+    case Metrics_format::JSON:
+      return "json";
+
+    case Metrics_format::PROMETHEUS:
+      return "prometheus";
+  }
+
+  throw std::logic_error("Unknown metrics format");
+}
+
+Table_data_metrics &Table_data_metrics::operator+=(
+    const Table_data_metrics &rhs) {
+  for (const auto &counter : k_counters) {
+    this->*counter.value += rhs.*counter.value;
+  }
+
+  for (const auto &timer : k_timers) {
+    this->*timer.value += rhs.*timer.value;
+  }
+
+  return *this;
+}
+
+Dump_metrics::Dump_metrics(Metrics_format format, Clock::duration interval)
+    : m_format(format),
+      m_interval(interval),
+      m_next_write((Clock::now() + interval).time_since_epoch().count()) {}
+
+const char *Dump_metrics::filename() const {
+  switch (m_format) {
+    case Metrics_format::JSON:
+      return "@.metrics.json";
+
+    case Metrics_format::PROMETHEUS:
+      return "@.metrics.prom";
+  }
+
+  throw std::logic_error("Unknown metrics format");
+}
+
+void Dump_metrics::update(const std::string &schema, const std::string &table,
+                          const std::string &chunk,
+                          const Table_data_metrics &metrics) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto &entry = m_tables[{schema, table}];
+  entry.total += metrics;
+  entry.chunks[chunk] += metrics;
+}
+
+bool Dump_metrics::write_due() {
+  const auto now = Clock::now().time_since_epoch().count();
+  auto next = m_next_write.load();
+
+  return now >= next && m_next_write.compare_exchange_strong(
+                            next, now + m_interval.count());
+}
+
+std::string Dump_metrics::format(bool finished) const {
+  switch (m_format) {
+    case Metrics_format::JSON:
+      return format_json(finished);
+
+    case Metrics_format::PROMETHEUS:
+      return format_prometheus(finished);
+  }
+
+  throw std::logic_error("Unknown metrics format");
+}
+
+std::string Dump_metrics::format_json(bool finished) const {
+  shcore::JSON_dumper json{true};
+
+  json.start_object();
+  json.append_string("timestamp", shcore::current_time_rfc3339());
+  json.append_bool("finished", finished);
+  json.append_string("tables");
+  json.start_array();
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto &table : m_tables) {
+      json.start_object();
+      json.append_string("schema", table.first.first);
+      json.append_string("table", table.first.second);
+
+      for (const auto &counter : k_counters) {
+        json.append_uint64(counter.json, table.second.total.*counter.value);
+      }
+
+      for (const auto &timer : k_timers) {
+        json.append_float(timer.json,
+                          seconds(table.second.total.*timer.value));
+      }
+
+      json.append_string("chunkMetrics");
+      json.start_array();
+
+      for (const auto &chunk : table.second.chunks) {
+        json.start_object();
+        json.append_string("id", chunk.first);
+
+        for (const auto &counter : k_counters) {
+          // number of chunks is meaningless here
+          if (&Table_data_metrics::chunks == counter.value) continue;
+
+          json.append_uint64(counter.json, chunk.second.*counter.value);
+        }
+
+        for (const auto &timer : k_timers) {
+          json.append_float(timer.json, seconds(chunk.second.*timer.value));
+        }
+
+        json.end_object();
+      }
+
+      json.end_array();
+      json.end_object();
+    }
+  }
+
+  json.end_array();
+  json.end_object();
+
+  return json.str() + "\n";
+}
+
+std::string Dump_metrics::format_prometheus(bool finished) const {
+  std::string result;
+
+  result += "# HELP mysqlsh_dump_finished Whether all the data was dumped.\n";
+  result += "# TYPE mysqlsh_dump_finished gauge\n";
+  result += "mysqlsh_dump_finished ";
+  result += finished ? "1" : "0";
+  result += "\n";
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  std::vector<std::string> labels;
+  labels.reserve(m_tables.size());
+
+  for (const auto &table : m_tables) {
+    labels.emplace_back("{schema=\"" + prometheus_label(table.first.first) +
+                        "\",table=\"" + prometheus_label(table.first.second) +
+                        "\"} ");
+  }
+
+  const auto write_header = [&result](const char *name, const char *help) {
+    result += "# HELP ";
+    result += name;
+    result += ' ';
+    result += help;
+    result += "\n# TYPE ";
+    result += name;
+    result += " counter\n";
+  };
+
+  for (const auto &counter : k_counters) {
+    write_header(counter.prometheus, counter.help);
+
+    auto label = labels.begin();
+
+    for (const auto &table : m_tables) {
+      result += counter.prometheus;
+      result += *label++;
+      result += std::to_string(table.second.total.*counter.value);
+      result += '\n';
+    }
+  }
+
+  for (const auto &timer : k_timers) {
+    write_header(timer.prometheus, timer.help);
+
+    auto label = labels.begin();
+
+    for (const auto &table : m_tables) {
+      result += timer.prometheus;
+      result += *label++;
+      result += shcore::str_format("%.6f",
+                                   seconds(table.second.total.*timer.value));
+      result += '\n';
+    }
+  }
+
+  return result;
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
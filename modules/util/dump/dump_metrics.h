@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_DUMP_METRICS_H_
+#define MODULES_UTIL_DUMP_DUMP_METRICS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace mysqlsh {
+namespace dump {
+
+enum class Metrics_format { JSON, PROMETHEUS };
+
+Metrics_format to_metrics_format(const std::string &format);
+
+std::string to_string(Metrics_format format);
+
+/**
+ * Time spent and amount of data processed while dumping the data of a table.
+ */
+struct Table_data_metrics {
+  // number of finished data tasks (chunks)
+  uint64_t chunks = 0;
+  uint64_t rows = 0;
+  // uncompressed bytes, an approximation of the data read from the server
+  uint64_t data_bytes = 0;
+  // bytes written to the data files
+  uint64_t file_bytes = 0;
+  // wall time of the finished data tasks
+  std::chrono::nanoseconds time{0};
+  // executing the query and waiting for the first row
+  std::chrono::nanoseconds first_row_time{0};
+  // fetching the remaining rows from the server
+  std::chrono::nanoseconds fetch_time{0};
+  // formatting and escaping the rows
+  std::chrono::nanoseconds encode_time{0};
+  // compressing and writing the data, opening and closing the files
+  std::chrono::nanoseconds write_time{0};
+  // waiting due to the 'maxRate' option
+  std::chrono::nanoseconds throttle_time{0};
+
+  Table_data_metrics &operator+=(const Table_data_metrics &rhs);
+};
+
+/**
+ * Per-table and per-chunk metrics of a dump, updated concurrently by the
+ * worker threads and periodically written to a file in the dump directory.
+ *
+ * Chunk-level metrics are only written in the JSON format, in Prometheus each
+ * chunk would be a separate time series.
+ */
+class Dump_metrics final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  Dump_metrics() = delete;
+
+  /**
+   * Creates the metrics.
+   *
+   * @param format Format of the output.
+   * @param interval How often the output should be written.
+   */
+  Dump_metrics(Metrics_format format, Clock::duration interval);
+
+  Dump_metrics(const Dump_metrics &) = delete;
+  Dump_metrics(Dump_metrics &&) = delete;
+
+  Dump_metrics &operator=(const Dump_metrics &) = delete;
+  Dump_metrics &operator=(Dump_metrics &&) = delete;
+
+  ~Dump_metrics() = default;
+
+  /**
+   * Name of the file the metrics are written to.
+   */
+  const char *filename() const;
+
+  /**
+   * Adds the given values to the metrics of a table and of its chunk.
+   *
+   * @param schema Schema of the table.
+   * @param table Name of the table.
+   * @param chunk ID of the chunk.
+   * @param metrics Values to be added.
+   */
+  void update(const std::string &schema, const std::string &table,
+              const std::string &chunk, const Table_data_metrics &metrics);
+
+  /**
+   * Checks if the output should be written now. If it's due, only the first
+   * caller gets true, the next one is going to get it once the interval
+   * elapses again.
+   */
+  bool write_due();
+
+  /**
+   * Formats the current metrics.
+   *
+   * @param finished Whether all the data was dumped.
+   */
+  std::string format(bool finished) const;
+
+ private:
+  std::string format_json(bool finished) const;
+
+  std::string format_prometheus(bool finished) const;
+
+  Metrics_format m_format;
+  Clock::duration m_interval;
+  std::atomic<Clock::rep> m_next_write;
+
+  struct Table_entry {
+    Table_data_metrics total;
+    // chunk ID -> metrics
+    std::map<std::string, Table_data_metrics> chunks;
+  };
+
+  mutable std::mutex m_mutex;
+  // (schema, table) -> metrics
+  std::map<std::pair<std::string, std::string>, Table_entry> m_tables;
+};
+
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_DUMP_METRICS_H_
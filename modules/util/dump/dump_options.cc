@@ -36,6 +36,7 @@
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/libs/storage/backend/object_storage_config.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
@@ -57,6 +58,10 @@ const shcore::Option_pack_def<Dump_options> &Dump_options::options() {
           .optional("showProgress", &Dump_options::m_show_progress)
           .optional("compression", &Dump_options::set_string_option)
           .optional("defaultCharacterSet", &Dump_options::m_character_set)
+          .optional("encodeBinaryOnClient",
+                    &Dump_options::m_encode_binary_on_client)
+          .optional("parallelUploads", &Dump_options::m_parallel_uploads)
+          .optional("uploadMemoryLimit", &Dump_options::set_string_option)
           .include(&Dump_options::m_dialect_unpacker)
           .on_done(&Dump_options::on_unpacked_options)
           .on_log(&Dump_options::on_log_options);
@@ -81,6 +86,13 @@ void Dump_options::set_string_option(const std::string &option,
     }
 
     m_compression = mysqlshdk::storage::to_compression(value);
+  } else if (option == "uploadMemoryLimit") {
+    if (value.empty()) {
+      throw std::invalid_argument(
+          "The option 'uploadMemoryLimit' cannot be set to an empty string.");
+    }
+
+    m_upload_memory_limit = mysqlshdk::utils::expand_to_bytes(value);
   } else {
     // This function should only be called with the options above.
     assert(false);
@@ -89,6 +101,13 @@ void Dump_options::set_string_option(const std::string &option,
 
 void Dump_options::set_storage_config(
     const std::shared_ptr<mysqlshdk::storage::Config> &storage_config) {
+  if (const auto config = std::dynamic_pointer_cast<
+          mysqlshdk::storage::backend::object_storage::Config>(
+          storage_config)) {
+    config->set_parallel_uploads(m_parallel_uploads);
+    config->set_upload_memory_limit(m_upload_memory_limit);
+  }
+
   m_storage_config = storage_config;
 }
 
@@ -125,6 +144,16 @@ void Dump_options::validate() const {
 
   validate_partitions();
 
+  if (m_parallel_uploads > 0 || m_upload_memory_limit > 0) {
+    if (!std::dynamic_pointer_cast<
+            const mysqlshdk::storage::backend::object_storage::Config>(
+            m_storage_config)) {
+      throw std::invalid_argument(shcore::str_format(
+          "The '%s' option can only be used when dumping to an object storage.",
+          m_parallel_uploads > 0 ? "parallelUploads" : "uploadMemoryLimit"));
+    }
+  }
+
   validate_options();
 }
 
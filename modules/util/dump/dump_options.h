@@ -43,6 +43,7 @@
 
 #include "modules/util/common/dump/filtering_options.h"
 #include "modules/util/dump/compatibility_option.h"
+#include "modules/util/dump/dump_metrics.h"
 #include "modules/util/dump/instance_cache.h"
 #include "modules/util/import_table/dialect.h"
 
@@ -93,8 +94,14 @@ class Dump_options {
     return m_storage_config;
   }
 
+  uint64_t parallel_uploads() const { return m_parallel_uploads; }
+
+  uint64_t upload_memory_limit() const { return m_upload_memory_limit; }
+
   const std::string &character_set() const { return m_character_set; }
 
+  bool encode_binary_on_client() const { return m_encode_binary_on_client; }
+
   const std::optional<mysqlshdk::utils::Version> &mds_compatibility() const {
     return m_mds;
   }
@@ -121,6 +128,10 @@ class Dump_options {
 
   virtual std::size_t threads() const = 0;
 
+  virtual uint64_t compression_threads() const = 0;
+
+  virtual uint64_t compression_frame_size() const = 0;
+
   virtual bool is_export_only() const = 0;
 
   virtual bool use_single_file() const = 0;
@@ -149,6 +160,8 @@ class Dump_options {
 
   virtual bool par_manifest() const = 0;
 
+  virtual std::optional<Metrics_format> metrics_format() const = 0;
+
  protected:
   void set_compression(mysqlshdk::storage::Compression compression) {
     m_compression = compression;
@@ -233,6 +246,11 @@ class Dump_options {
   mysqlshdk::storage::Config_ptr m_storage_config;
 
   std::string m_character_set = "utf8mb4";
+  bool m_encode_binary_on_client = false;
+
+  // object storage
+  uint64_t m_parallel_uploads = 0;
+  uint64_t m_upload_memory_limit = 0;
 
   import_table::Dialect m_dialect;
   import_table::Dialect m_dialect_unpacker;
@@ -31,6 +31,7 @@
 #include "mysqlshdk/libs/utils/utils_net.h"
 
 #include "modules/util/dump/dump_errors.h"
+#include "modules/util/dump/encoder.h"
 
 namespace mysqlsh {
 namespace dump {
@@ -48,6 +49,8 @@ Dump_write_result &Dump_write_result::operator+=(const Dump_write_result &rhs) {
   m_data_bytes += rhs.m_data_bytes;
   m_bytes_written += rhs.m_bytes_written;
   m_rows_written += rhs.m_rows_written;
+  m_encode_time += rhs.m_encode_time;
+  m_write_time += rhs.m_write_time;
 
   return *this;
 }
@@ -130,6 +133,22 @@ void Dump_writer::Buffer::write_base64_data(const char *data,
   }
 }
 
+void Dump_writer::Buffer::write_base64(const char *data, std::size_t length) {
+  will_write(encoder::base64_length(length));
+
+  const auto end = encoder::base64(data, length, m_ptr);
+  m_length += end - m_ptr;
+  m_ptr = end;
+}
+
+void Dump_writer::Buffer::write_hex(const char *data, std::size_t length) {
+  will_write(encoder::hex_length(length));
+
+  const auto end = encoder::hex(data, length, m_ptr);
+  m_length += end - m_ptr;
+  m_ptr = end;
+}
+
 Dump_writer::Dump_writer() : m_buffer(std::make_unique<Buffer>()) {}
 
 Dump_writer::~Dump_writer() {
@@ -173,10 +192,25 @@ Dump_write_result Dump_writer::write_preamble(
 }
 
 Dump_write_result Dump_writer::write_row(const mysqlshdk::db::IRow *row) {
+  using Clock = std::chrono::steady_clock;
+  Clock::time_point started;
+  Clock::time_point encoded;
+
+  if (m_measure_time) started = Clock::now();
+
   buffer()->clear();
   store_row(row);
+
+  if (m_measure_time) encoded = Clock::now();
+
   auto result = write_buffer("row", true);
 
+  if (m_measure_time) {
+    const auto written = Clock::now();
+    result.add_encode_time(encoded - started);
+    result.add_write_time(written - encoded);
+  }
+
   m_bytes_written += result.data_bytes();
   m_bytes_written_per_idx += result.data_bytes();
 
@@ -25,6 +25,7 @@
 #define MODULES_UTIL_DUMP_DUMP_WRITER_H_
 
 #include <cassert>
+#include <chrono>
 #include <cstring>
 #include <memory>
 #include <string>
@@ -38,7 +39,7 @@
 namespace mysqlsh {
 namespace dump {
 
-enum class Escape_type { NONE, FULL, BASE64 };
+enum class Escape_type { NONE, FULL, BASE64, ENCODE_BASE64, ENCODE_HEX };
 
 class Dump_write_result final {
  public:
@@ -54,7 +55,10 @@ class Dump_write_result final {
 
   Dump_write_result &operator+=(const Dump_write_result &rhs);
 
-  void reset() noexcept { m_data_bytes = m_bytes_written = m_rows_written = 0; }
+  void reset() noexcept {
+    m_data_bytes = m_bytes_written = m_rows_written = 0;
+    m_encode_time = m_write_time = std::chrono::nanoseconds::zero();
+  }
 
   void write_data(uint64_t bytes) noexcept { m_data_bytes += bytes; }
 
@@ -68,15 +72,38 @@ class Dump_write_result final {
 
   uint64_t rows_written() const noexcept { return m_rows_written; }
 
+  void add_encode_time(std::chrono::nanoseconds time) noexcept {
+    m_encode_time += time;
+  }
+
+  std::chrono::nanoseconds encode_time() const noexcept {
+    return m_encode_time;
+  }
+
+  void add_write_time(std::chrono::nanoseconds time) noexcept {
+    m_write_time += time;
+  }
+
+  std::chrono::nanoseconds write_time() const noexcept { return m_write_time; }
+
  private:
   uint64_t m_data_bytes = 0;
   uint64_t m_bytes_written = 0;
   uint64_t m_rows_written = 0;
+  // see Dump_writer::set_measure_time()
+  std::chrono::nanoseconds m_encode_time{0};
+  std::chrono::nanoseconds m_write_time{0};
 };
 
 class Dump_writer {
  public:
-  enum class Encoding_type { NONE, BASE64, HEX };
+  /**
+   * How the values of a column were encoded:
+   *  - NONE - not encoded,
+   *  - BASE64, HEX - encoded by the server using TO_BASE64() or HEX(),
+   *  - ENCODE_BASE64, ENCODE_HEX - raw binary data, encoded by the writer.
+   */
+  enum class Encoding_type { NONE, BASE64, HEX, ENCODE_BASE64, ENCODE_HEX };
 
   Dump_writer();
 
@@ -92,6 +119,12 @@ class Dump_writer {
 
   void set_index_file(std::unique_ptr<mysqlshdk::storage::IFile> index);
 
+  /**
+   * Whether write_row() should measure the time spent on encoding and writing
+   * the rows.
+   */
+  void set_measure_time(bool measure) { m_measure_time = measure; }
+
   void open();
 
   void close();
@@ -144,6 +177,16 @@ class Dump_writer {
 
     void write_base64_data(const char *data, std::size_t length);
 
+    /**
+     * Encodes the given binary data using base64, without line breaks.
+     */
+    void write_base64(const char *data, std::size_t length);
+
+    /**
+     * Encodes the given binary data using upper case hexadecimal digits.
+     */
+    void write_hex(const char *data, std::size_t length);
+
     void clear() noexcept;
 
     void set_fixed_length(std::size_t fixed_length);
@@ -187,6 +230,8 @@ class Dump_writer {
   uint64_t m_bytes_written = 0;
 
   uint64_t m_bytes_written_per_idx = 0;
+
+  bool m_measure_time = false;
 };
 
 }  // namespace dump
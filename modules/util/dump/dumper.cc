@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
 #include <cstdint>
 #include <functional>
@@ -47,6 +48,7 @@
 #include "mysqlshdk/libs/mysql/binlog_utils.h"
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/utils.h"
 #include "mysqlshdk/libs/textui/textui.h"
@@ -62,6 +64,7 @@
 #include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
+#include "mysqlshdk/libs/utils/utils_time.h"
 
 #include "modules/mod_utils.h"
 #include "modules/util/common/dump/utils.h"
@@ -89,6 +92,12 @@ namespace {
 static constexpr const int k_mysql_server_net_write_timeout = 30 * 60;
 static constexpr const int k_mysql_server_wait_timeout = 365 * 24 * 60 * 60;
 
+// how often the metrics file is rewritten while data is being dumped
+constexpr auto k_metrics_interval = std::chrono::seconds(5);
+
+// maximum number of sessions used to fetch the metadata, including the main one
+constexpr std::size_t k_max_metadata_sessions = 4;
+
 FI_DEFINE(dumper, [](const mysqlshdk::utils::FI::Args &args) {
   throw std::runtime_error(args.get_string("msg"));
 });
@@ -402,6 +411,8 @@ class Dumper::Dump_writer_controller {
       const std::vector<Dump_writer::Encoding_type> &pre_encoded_columns) {
     assert(m_output);
 
+    const auto started = std::chrono::steady_clock::now();
+
     m_writer->set_output_file(m_output);
 
     if (m_create_index) {
@@ -414,8 +425,10 @@ class Dumper::Dump_writer_controller {
 
     m_writer->open();
 
-    return update_stats(
-        m_writer->write_preamble(metadata, pre_encoded_columns));
+    auto result = m_writer->write_preamble(metadata, pre_encoded_columns);
+    result.add_write_time(std::chrono::steady_clock::now() - started);
+
+    return update_stats(result);
   }
 
   virtual Dump_write_result write_row(const mysqlshdk::db::IRow *row) {
@@ -426,6 +439,8 @@ class Dumper::Dump_writer_controller {
   virtual Dump_write_result finish_writing() {
     assert(m_output);
 
+    const auto started = std::chrono::steady_clock::now();
+
     auto result = m_writer->write_postamble();
     m_writer->close();
 
@@ -440,6 +455,8 @@ class Dumper::Dump_writer_controller {
                          result.bytes_written());
     }
 
+    result.add_write_time(std::chrono::steady_clock::now() - started);
+
     return update_stats(result);
   }
 
@@ -781,10 +798,21 @@ class Dumper::Table_worker final {
       const Table_data_task &table,
       std::vector<Dump_writer::Encoding_type> *out_pre_encoded_columns) const {
     const auto base64 = m_dumper->m_options.use_base64();
+    const auto encode_on_client =
+        m_dumper->m_options.encode_binary_on_client();
     std::string query = "SELECT SQL_NO_CACHE ";
 
     for (const auto &column : table.info->columns) {
-      if (column->csv_unsafe) {
+      // HEX() of a BIT value is its numeric value, not the binary data, these
+      // columns are always encoded by the server
+      if (column->csv_unsafe && encode_on_client &&
+          mysqlshdk::db::Type::Bit != column->type) {
+        query += column->quoted_name;
+
+        out_pre_encoded_columns->push_back(
+            base64 ? Dump_writer::Encoding_type::ENCODE_BASE64
+                   : Dump_writer::Encoding_type::ENCODE_HEX);
+      } else if (column->csv_unsafe) {
         query += (base64 ? "TO_BASE64(" : "HEX(") + column->quoted_name + ")";
 
         out_pre_encoded_columns->push_back(
@@ -834,12 +862,32 @@ class Dumper::Table_worker final {
     const auto full_query = prepare_query(table, &pre_encoded_columns);
     const auto controller = table.controller.get();
 
+    using Clock = std::chrono::steady_clock;
+    // metrics are collected since the last progress update
+    const bool measure = !!m_dumper->m_metrics;
+    Table_data_metrics metrics;
+    Clock::time_point started;
+    Clock::time_point fetch_started;
+    bool first_row = true;
+
     try {
+      if (measure) started = Clock::now();
+
       const auto result = query(full_query);
 
+      if (measure) metrics.first_row_time = Clock::now() - started;
+
       controller->start_writing(result->get_metadata(), pre_encoded_columns);
 
+      if (measure) fetch_started = Clock::now();
+
       while (const auto row = result->fetch_one()) {
+        if (measure) {
+          (first_row ? metrics.first_row_time : metrics.fetch_time) +=
+              Clock::now() - fetch_started;
+          first_row = false;
+        }
+
         if (m_dumper->m_worker_interrupt) {
           return;
         }
@@ -853,11 +901,18 @@ class Dumper::Table_worker final {
           // we don't know how much data was read from the server, number of
           // bytes written to the dump file is a good approximation
           if (m_rate_limit.enabled()) {
-            m_rate_limit.throttle(controller->progress_stats().data_bytes());
+            metrics.throttle_time += m_rate_limit.throttle(
+                controller->progress_stats().data_bytes());
+          }
+
+          if (measure) {
+            update_metrics(table, controller->progress_stats(), &metrics);
           }
 
           controller->reset_progress();
         }
+
+        if (measure) fetch_started = Clock::now();
       }
     } catch (const mysqlshdk::db::Error &e) {
       log_error("%sFailed to dump %s (%s) using query: %s, error: %s",
@@ -878,9 +933,30 @@ class Dumper::Table_worker final {
              controller->total_stats().data_bytes(), controller->longest_row());
 
     m_dumper->update_progress(controller->progress_stats());
+
+    if (measure) {
+      metrics.chunks = 1;
+      metrics.time = Clock::now() - started;
+      update_metrics(table, controller->progress_stats(), &metrics);
+    }
+
     m_dumper->finish_writing(table.schema, table.name, controller);
   }
 
+  void update_metrics(const Table_data_task &table,
+                      const Dump_write_result &progress,
+                      Table_data_metrics *metrics) const {
+    metrics->rows = progress.rows_written();
+    metrics->data_bytes = progress.data_bytes();
+    metrics->file_bytes = progress.bytes_written();
+    metrics->encode_time = progress.encode_time();
+    metrics->write_time = progress.write_time();
+
+    m_dumper->update_metrics(table.schema, table.name, table.id, *metrics);
+
+    *metrics = {};
+  }
+
   void push_table_data_task(Table_data_task &&task) {
     std::string info = "dumping " + task.task_name;
 
@@ -890,6 +966,8 @@ class Dumper::Table_worker final {
     // copy constructor
     auto t = std::make_shared<Table_data_task>(std::move(task));
 
+    ++m_dumper->m_data_tasks_left;
+
     m_dumper->m_worker_tasks.push({std::move(info),
                                    [task = std::move(t)](Table_worker *worker) {
                                      ++worker->m_dumper->m_num_threads_dumping;
@@ -897,6 +975,7 @@ class Dumper::Table_worker final {
                                      worker->dump_table_data(*task);
 
                                      --worker->m_dumper->m_num_threads_dumping;
+                                     --worker->m_dumper->m_data_tasks_left;
                                    }},
                                   shcore::Queue_priority::LOW);
   }
@@ -1030,8 +1109,6 @@ class Dumper::Table_worker final {
     const Table_task *table;
     uint64_t row_count;
     uint64_t rows_per_chunk;
-    uint64_t accuracy;
-    int explain_rows_idx;
     std::string partition;
     std::string where;
     std::string order_by;
@@ -1157,118 +1234,10 @@ class Dumper::Table_worker final {
                : std::numeric_limits<T>::max();
   }
 
-  template <typename T>
-  static T sum(const T &value, const T &addend) {
-    // if sum is greater than max, use max instead
-    return std::numeric_limits<T>::max() - addend <= value
-               ? std::numeric_limits<T>::max()
-               : value + addend;
-  }
-
-  template <typename T>
-  static T constant_step(const T & /* from */, const T &step) {
-    return step;
-  }
-
-  template <typename T>
-  T adaptive_step(const T &from, const T &step, const T &max,
-                  const Chunking_info &info, const std::string &chunk_id) {
-    static constexpr int k_chunker_retries = 10;
-    static constexpr int k_chunker_iterations = 20;
-
-    const auto double_step = 2 * step;
-    auto middle = from;
-
-    auto rows = info.rows_per_chunk;
-    const auto comment = this->get_query_comment(*info.table, chunk_id);
-
-    int retry = 0;
-    uint64_t delta = info.accuracy + 1;
-
-    const auto row_count = [&info, &comment, this](const auto begin,
-                                                   const auto end) {
-      return to_uint64_t(query("EXPLAIN SELECT COUNT(*) FROM " +
-                               info.table->quoted_name + info.partition +
-                               where(between(info, begin, end)) +
-                               info.order_by + comment)
-                             ->fetch_one_or_throw()
-                             ->get_as_string(info.explain_rows_idx));
-    };
-
-    while (delta > info.accuracy && retry < k_chunker_retries) {
-      if (max - retry * double_step <= from) {
-        // if left boundary is greater than max, stop here
-        middle = max;
-        break;
-      }
-
-      // each time search in a different range, we didn't find the answer in the
-      // previous one
-      auto left = from + retry * double_step;
-      auto right = sum(left, double_step);
-
-      assert(left < right);
-
-      for (int i = 0; i < k_chunker_iterations; ++i) {
-        middle = left + (right - left) / 2;
-
-        if (middle >= right || middle <= left) {
-          break;
-        }
-
-        rows = row_count(from, middle);
-
-        if (0 == i && rows < info.rows_per_chunk) {
-          // if in the first iteration there's not enough rows, check the whole
-          // range, if there's still not enough rows we can skip this range
-          const auto total_rows = row_count(from, right);
-
-          if (total_rows < info.rows_per_chunk) {
-            middle = right;
-            delta = info.rows_per_chunk - total_rows;
-            break;
-          }
-        }
-
-        if (rows > info.rows_per_chunk) {
-          right = middle;
-          delta = rows - info.rows_per_chunk;
-        } else {
-          left = middle;
-          delta = info.rows_per_chunk - rows;
-        }
-
-        if (delta <= info.accuracy) {
-          // we're close enough
-          break;
-        }
-      }
-
-      if (delta > info.accuracy) {
-        if (rows >= info.rows_per_chunk) {
-          // we have too many rows, but that's OK...
-          retry = k_chunker_retries;
-        } else {
-          if (middle >= max) {
-            // we've reached the upper boundary, stop here
-            retry = k_chunker_retries;
-          } else {
-            // we didn't find enough rows here, move farther to
-            // the right
-            ++retry;
-          }
-        }
-      }
-    }
-
-    return ensure_not_zero(middle - from);
-  }
-
   template <typename T>
   std::size_t chunk_integer_column(const Chunking_info &info, const T &min,
-                                   const T &max) {
-    std::size_t ranges_count = 0;
-
+                                   const T &max, const Row &begin,
+                                   const Row &end) {
     // if rows_per_chunk <= 1 it may mean that the rows are bigger than chunk
     // size, which means we # chunks ~= # rows
     const auto estimated_chunks =
@@ -1279,35 +1248,24 @@ class Dumper::Table_worker final {
     using step_t = std20::remove_cvref_t<decltype(min)>;
     const auto index_range = distance(min, max);
     const auto row_count_accuracy = std::max(info.row_count / 10, UINT64_C(1));
-    const auto estimated_step =
-        cast<step_t>(ensure_not_zero(index_range / estimated_chunks));
-    // use constant step if number of chunks is small or index range is close to
-    // the number of rows
-    const bool use_constant_step =
-        estimated_chunks < 2 ||
-        (index_range > info.row_count
-             ? index_range - info.row_count
-             : info.row_count - index_range) <= row_count_accuracy;
-
-    std::string chunk_id;
-    const auto next_step =
-        use_constant_step
-            ? std::function<step_t(const step_t &, const step_t &)>(
-                  constant_step<T>)
-            // using the default capture [&] below results in problems with
-            // GCC 5.4.0 (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=80543)
-            : [&info, &max, &chunk_id, this](const auto &from,
-                                             const auto &step) {
-                return this->adaptive_step(from, step, max, info, chunk_id);
-              };
 
-    auto current = min;
-    const auto step = estimated_step;
+    // use constant step if number of chunks is small or index range is close to
+    // the number of rows, otherwise values are sparse or skewed and a constant
+    // step would produce chunks of very different sizes, walk the index instead
+    if (estimated_chunks >= 2 &&
+        (index_range > info.row_count ? index_range - info.row_count
+                                      : info.row_count - index_range) >
+            row_count_accuracy) {
+      return chunk_index_walk(info, begin, end);
+    }
 
-    log_info("%sChunking %s using integer algorithm with %s step",
-             m_log_id.c_str(), info.table->task_name.c_str(),
-             use_constant_step ? "constant" : "adaptive");
+    log_info("%sChunking %s using integer algorithm with constant step",
+             m_log_id.c_str(), info.table->task_name.c_str());
 
+    std::size_t ranges_count = 0;
+    const auto step =
+        cast<step_t>(ensure_not_zero(index_range / estimated_chunks));
+    auto current = min;
     bool last_chunk = false;
 
     while (!last_chunk) {
@@ -1315,21 +1273,19 @@ class Dumper::Table_worker final {
         return ranges_count;
       }
 
-      chunk_id = std::to_string(ranges_count);
-      const auto begin = current;
-      auto new_step = next_step(current, step);
+      const auto begin_value = current;
+      auto new_step = step;
 
       // ensure that there's no integer overflow
       --new_step;
       current = (current > max - new_step ? max : current + new_step);
 
-      const auto end = current;
-
       last_chunk = (current >= max);
 
-      create_and_push_table_data_chunk_task(*info.table,
-                                            between(info, begin, end), chunk_id,
-                                            ranges_count++, last_chunk);
+      create_and_push_table_data_chunk_task(
+          *info.table, between(info, begin_value, current),
+          std::to_string(ranges_count), ranges_count, last_chunk);
+      ++ranges_count;
 
       ++current;
     }
@@ -1339,21 +1295,20 @@ class Dumper::Table_worker final {
 
   std::size_t chunk_integer_column(const Chunking_info &info, const Row &begin,
                                    const Row &end) {
-    log_info("%sChunking %s using integer algorithm", m_log_id.c_str(),
-             info.table->task_name.c_str());
-
     const auto type =
         info.table->info->index.columns()[info.index_column]->type;
 
     if (mysqlshdk::db::Type::Integer == type) {
       return chunk_integer_column(info, to_int64_t(begin[info.index_column]),
-                                  to_int64_t(end[info.index_column]));
+                                  to_int64_t(end[info.index_column]), begin,
+                                  end);
     } else if (mysqlshdk::db::Type::UInteger == type) {
       return chunk_integer_column(info, to_uint64_t(begin[info.index_column]),
-                                  to_uint64_t(end[info.index_column]));
+                                  to_uint64_t(end[info.index_column]), begin,
+                                  end);
     } else if (mysqlshdk::db::Type::Decimal == type) {
       return chunk_integer_column(info, Decimal{begin[info.index_column]},
-                                  Decimal{end[info.index_column]});
+                                  Decimal{end[info.index_column]}, begin, end);
     }
 
     throw std::logic_error(
@@ -1361,9 +1316,16 @@ class Dumper::Table_worker final {
         mysqlshdk::db::to_string(type));
   }
 
-  std::size_t chunk_non_integer_column(const Chunking_info &info,
-                                       const Row &begin, const Row &end) {
-    log_info("%sChunking %s using non-integer algorithm", m_log_id.c_str(),
+  /**
+   * Walks the index using keyset pagination: each query skips over
+   * rows_per_chunk index entries, starting at the beginning of the current
+   * chunk, and fetches the last key of the current chunk and the first key of
+   * the next one. Each chunk is scheduled as soon as its boundaries are known,
+   * so it can be dumped while the rest of the table is being chunked.
+   */
+  std::size_t chunk_index_walk(const Chunking_info &info, const Row &begin,
+                               const Row &end) {
+    log_info("%sChunking %s using index walk", m_log_id.c_str(),
              info.table->task_name.c_str());
 
     std::size_t ranges_count = 0;
@@ -1378,9 +1340,11 @@ class Dumper::Table_worker final {
 
     const auto select = "SELECT SQL_NO_CACHE " + index + " FROM " +
                         info.table->quoted_name + info.partition + " ";
-    const auto order_by_and_limit = info.order_by + " LIMIT " +
-                                    std::to_string(info.rows_per_chunk - 1) +
-                                    ",2 ";
+    // if rows are bigger than chunk size, rows_per_chunk is 0, use one row
+    // per chunk
+    const auto order_by_and_limit =
+        info.order_by + " LIMIT " +
+        std::to_string(std::max(info.rows_per_chunk, UINT64_C(1)) - 1) + ",2 ";
 
     const auto fetch =
         [&end](const std::shared_ptr<mysqlshdk::db::IResult> &res) {
@@ -1473,7 +1437,7 @@ class Dumper::Table_worker final {
         mysqlshdk::db::Type::Decimal == type) {
       return chunk_integer_column(info, begin, end);
     } else {
-      return chunk_non_integer_column(info, begin, end);
+      return chunk_index_walk(info, begin, end);
     }
   }
 
@@ -1529,8 +1493,6 @@ class Dumper::Table_worker final {
     info.row_count = partition ? partition->row_count : table.info->row_count;
     info.rows_per_chunk =
         m_dumper->m_options.bytes_per_chunk() / average_row_length;
-    info.accuracy = std::max(info.rows_per_chunk / 10, UINT64_C(10));
-    info.explain_rows_idx = m_dumper->m_cache.explain_rows_idx;
     info.partition = std::move(partition_clause);
     info.where = table.where;
 
@@ -1562,8 +1524,18 @@ class Dumper::Table_worker final {
     const auto ranges_count = chunk_column(info);
 
     duration.finish();
-    log_debug("%sChunking of %s took %f seconds", m_log_id.c_str(),
-              task_name.c_str(), duration.seconds_elapsed());
+    log_info("%sChunking of %s took %f seconds, created %zu chunk%s",
+             m_log_id.c_str(), task_name.c_str(), duration.seconds_elapsed(),
+             ranges_count, ranges_count > 1 ? "s" : "");
+
+    {
+      std::lock_guard<std::mutex> lock(m_dumper->m_table_data_bytes_mutex);
+      auto &stats = m_dumper->m_table_chunk_stats[table.schema][table.name];
+
+      stats.chunked = true;
+      // partitions are chunked separately
+      stats.chunking_time += duration.seconds_elapsed();
+    }
 
     return ranges_count;
   }
@@ -1611,6 +1583,9 @@ class Dumper::Table_worker final {
           common::get_table_data_filename(table.basename, "triggers.sql"));
     }
 
+    ++m_dumper->m_table_ddl_written;
+    m_dumper->m_table_ddl_round_trips += dumper->round_trips();
+
     ++m_dumper->m_ddl_written;
 
     m_dumper->validate_dump_consistency(m_session);
@@ -1656,11 +1631,6 @@ Decimal Dumper::Table_worker::cast(const Decimal &value) {
   return value;
 }
 
-template <>
-Decimal Dumper::Table_worker::sum(const Decimal &value, const Decimal &delta) {
-  return value + delta;
-}
-
 class Dumper::Memory_dumper final {
  public:
   Memory_dumper() = delete;
@@ -1819,6 +1789,11 @@ Dumper::Dumper(const Dump_options &options)
 
   m_table_data_extension +=
       mysqlshdk::storage::get_extension(m_options.compression());
+
+  if (const auto format = m_options.metrics_format();
+      format.has_value() && !m_options.is_dry_run()) {
+    m_metrics = std::make_unique<Dump_metrics>(*format, k_metrics_interval);
+  }
 }
 
 // needs to be defined here due to Dumper::Synchronize_workers being
@@ -1976,6 +1951,13 @@ void Dumper::do_run() {
   wait_for_all_tasks();
 
   if (!m_options.is_dry_run() && !m_worker_interrupt) {
+    try {
+      write_metrics(true);
+    } catch (const std::exception &e) {
+      // metrics are informational, failure to write them is not fatal
+      log_warning("Failed to write the dump metrics: %s", e.what());
+    }
+
     write_dump_finished_metadata();
     close_output_directory();
     shutdown_progress();
@@ -2473,7 +2455,14 @@ void Dumper::initialize_instance_cache() {
   auto builder = Instance_cache_builder(session(), m_options.filters(),
                                         std::move(m_cache));
 
-  builder.metadata(m_options.included_partitions());
+  const auto helpers = open_metadata_sessions();
+  shcore::on_leave_scope close_helpers([&helpers]() {
+    for (const auto &helper : helpers) {
+      helper->close();
+    }
+  });
+
+  builder.helper_sessions(helpers).metadata(m_options.included_partitions());
 
   if (dump_users()) {
     builder.users();
@@ -2504,6 +2493,31 @@ void Dumper::initialize_instance_cache() {
   print_object_stats();
 }
 
+std::vector<std::shared_ptr<mysqlshdk::db::ISession>>
+Dumper::open_metadata_sessions() const {
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions;
+  const auto count =
+      std::min<std::size_t>(m_options.threads(), k_max_metadata_sessions);
+
+  // this is called while read locks are held, transactions started here are
+  // going to see the same snapshot as the main session
+  for (std::size_t i = 1; i < count; ++i) {
+    try {
+      auto s = establish_session(session()->get_connection_options(), false);
+      start_transaction(s);
+      on_init_thread_session(s);
+      sessions.emplace_back(std::move(s));
+    } catch (const mysqlshdk::db::Error &e) {
+      // not fatal, fetch the metadata using the sessions opened so far
+      log_warning("Failed to open a session used to fetch metadata: %s",
+                  e.format().c_str());
+      break;
+    }
+  }
+
+  return sessions;
+}
+
 void Dumper::create_schema_tasks() {
   bool has_partitions = false;
 
@@ -2731,6 +2745,7 @@ void Dumper::initialize_counters() {
   m_bytes_written = 0;
   m_data_bytes = 0;
   m_table_data_bytes.clear();
+  m_table_chunk_stats.clear();
 
   m_data_throughput = std::make_unique<mysqlshdk::textui::Throughput>();
   m_bytes_throughput = std::make_unique<mysqlshdk::textui::Throughput>();
@@ -2739,6 +2754,8 @@ void Dumper::initialize_counters() {
   m_num_threads_dumping = 0;
 
   m_ddl_written = 0;
+  m_table_ddl_written = 0;
+  m_table_ddl_round_trips = 0;
   m_schema_metadata_written = 0;
   m_table_metadata_to_write = 0;
   m_table_metadata_written = 0;
@@ -3034,6 +3051,7 @@ void Dumper::create_schema_ddl_tasks() {
 
 void Dumper::create_table_tasks() {
   m_chunking_tasks = 0;
+  m_data_tasks_left = 0;
 
   m_main_thread_finished_producing_chunking_tasks = false;
 
@@ -3198,16 +3216,16 @@ void Dumper::push_table_chunking_task(Table_task &&task) {
 
 std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
     const std::string &filename) const {
+  auto writer = m_writer_creator();
+  writer->set_measure_time(!!m_metrics);
+
   if (m_options.use_single_file()) {
-    return std::make_unique<Single_file_writer_controller>(m_writer_creator(),
+    return std::make_unique<Single_file_writer_controller>(std::move(writer),
                                                            m_output_file.get());
   } else {
     return std::make_unique<Default_writer_controller>(
-        m_writer_creator(),
-        [this](const std::string &name) {
-          return mysqlshdk::storage::make_file(make_file(name, true),
-                                               m_options.compression());
-        },
+        std::move(writer),
+        [this](const std::string &name) { return make_data_file(name); },
         [this](const std::string &name) { return make_file(name); }, filename,
         // We only use the .dumping extension in case of the local files. In
         // case of the remote ones, file is not actually created until the whole
@@ -3230,6 +3248,14 @@ void Dumper::finish_writing(const std::string &schema, const std::string &table,
 
   controller->update_uncompressed_file_size(&m_chunk_file_bytes);
   m_table_data_bytes[schema][table] += controller->total_stats().data_bytes();
+
+  const auto rows =
+      static_cast<double>(controller->total_stats().rows_written());
+  auto &stats = m_table_chunk_stats[schema][table];
+
+  ++stats.chunks;
+  stats.rows += rows;
+  stats.rows_squared += rows * rows;
 }
 
 void Dumper::write_metadata() const {
@@ -3676,6 +3702,36 @@ void Dumper::summarize() const {
     }
   }
 
+  for (const auto &schema : m_table_chunk_stats) {
+    for (const auto &table : schema.second) {
+      const auto &stats = table.second;
+
+      if (!stats.chunked || 0 == stats.chunks) {
+        continue;
+      }
+
+      const auto mean = stats.rows / stats.chunks;
+      const auto variance =
+          std::max(stats.rows_squared / stats.chunks - mean * mean, 0.0);
+
+      log_info("Table %s was chunked in %f seconds and written to %" PRIu64
+               " chunk%s, rows per chunk: average %.1f, variance %.1f, "
+               "standard deviation %.1f",
+               quote(schema.first, table.first).c_str(), stats.chunking_time,
+               stats.chunks, stats.chunks > 1 ? "s" : "", mean, variance,
+               std::sqrt(variance));
+    }
+  }
+
+  if (m_table_ddl_written) {
+    log_info("DDL of %" PRIu64 " tables written using %" PRIu64
+             " queries, %.1f per table",
+             static_cast<uint64_t>(m_table_ddl_written),
+             static_cast<uint64_t>(m_table_ddl_round_trips),
+             static_cast<double>(m_table_ddl_round_trips) /
+                 m_table_ddl_written);
+  }
+
   console->print_status("Dump duration: " +
                         m_data_dump_stage->duration().to_string());
   console->print_status("Total duration: " +
@@ -3712,6 +3768,16 @@ void Dumper::summarize() const {
         "Average compressed throughput: " +
         mysqlshdk::utils::format_throughput_bytes(
             m_bytes_written, m_data_dump_stage->duration().seconds()));
+
+    // CPU time of all threads, includes fetching the data and compressing it
+    const auto cpu_time = shcore::process_cpu_time() - m_data_dump_cpu_start;
+
+    if (cpu_time.count() > 0) {
+      console->print_status(shcore::str_format(
+          "Average CPU time per compressed byte: %.2f ns",
+          cpu_time.count() /
+              std::max(static_cast<double>(m_bytes_written), 1.0)));
+    }
   }
 
   summary();
@@ -3789,6 +3855,7 @@ void Dumper::initialize_progress() {
     current_console()->print_status("Starting data dump");
   };
 
+  m_data_dump_cpu_start = shcore::process_cpu_time();
   m_data_dump_stage = m_current_stage =
       m_progress_thread.start_stage("Dumping data", std::move(config));
 }
@@ -3810,6 +3877,35 @@ void Dumper::update_progress(const Dump_write_result &progress) {
 
 void Dumper::shutdown_progress() { m_progress_thread.finish(); }
 
+void Dumper::update_metrics(const std::string &schema, const std::string &table,
+                            const std::string &chunk,
+                            const Table_data_metrics &metrics) {
+  assert(m_metrics);
+
+  m_metrics->update(schema, table, chunk, metrics);
+
+  // each write of a file creates a new PAR, metrics are written just once
+  if (!m_options.par_manifest() && m_metrics->write_due()) {
+    try {
+      write_metrics(false);
+    } catch (const std::exception &e) {
+      // metrics are informational, failure to write them is not fatal
+      log_warning("Failed to write the dump metrics: %s", e.what());
+    }
+  }
+}
+
+void Dumper::write_metrics(bool finished) const {
+  if (!m_metrics) {
+    return;
+  }
+
+  const auto output = make_file(m_metrics->filename());
+  output->open(Mode::WRITE);
+  mysqlshdk::storage::fputs(m_metrics->format(finished), output.get());
+  output->close();
+}
+
 std::string Dumper::throughput() const {
   std::lock_guard<std::recursive_mutex> lock(m_throughput_mutex);
 
@@ -3859,6 +3955,50 @@ std::string Dumper::get_basename(const std::string &basename) {
   }
 }
 
+std::unique_ptr<mysqlshdk::storage::IFile> Dumper::make_data_file(
+    const std::string &filename) const {
+  auto file = mysqlshdk::storage::make_file(make_file(filename, true),
+                                            m_options.compression());
+
+  if (mysqlshdk::storage::Compression::ZSTD == m_options.compression()) {
+    if (const auto workers = compression_workers()) {
+      log_debug("Using %d zstd workers to compress: %s", workers,
+                filename.c_str());
+      static_cast<mysqlshdk::storage::compression::Zstd_file *>(file.get())
+          ->set_workers(workers);
+    }
+
+    if (const auto frame_size = m_options.compression_frame_size()) {
+      static_cast<mysqlshdk::storage::compression::Zstd_file *>(file.get())
+          ->set_max_frame_size(frame_size);
+    }
+  }
+
+  return file;
+}
+
+int Dumper::compression_workers() const {
+  const uint64_t max_workers = m_options.compression_threads();
+
+  if (0 == max_workers || !m_main_thread_finished_producing_chunking_tasks) {
+    return 0;
+  }
+
+  // data tasks which are scheduled or being dumped, each table which is still
+  // being chunked is going to produce at least one more
+  const uint64_t tasks =
+      std::max<uint64_t>(m_data_tasks_left + m_chunking_tasks, 1);
+  const uint64_t threads = m_options.threads();
+
+  if (tasks >= threads) {
+    // there's enough work to keep all the threads busy
+    return 0;
+  }
+
+  // threads which are idle are used to compress the remaining files
+  return static_cast<int>(std::min(max_workers, threads / tasks));
+}
+
 bool Dumper::compressed() const {
   return mysqlshdk::storage::Compression::NONE != m_options.compression();
 }
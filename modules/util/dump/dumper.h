@@ -25,6 +25,7 @@
 #define MODULES_UTIL_DUMP_DUMPER_H_
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -40,10 +41,11 @@
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
-#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
 #include "mysqlshdk/libs/utils/version.h"
 
 #include "modules/util/dump/capability.h"
+#include "modules/util/dump/dump_metrics.h"
 #include "modules/util/dump/dump_options.h"
 #include "modules/util/dump/dump_writer.h"
 #include "modules/util/dump/instance_cache.h"
@@ -208,6 +210,9 @@ class Dumper {
 
   void initialize_instance_cache();
 
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> open_metadata_sessions()
+      const;
+
   void create_schema_tasks();
 
   void validate_mds() const;
@@ -324,11 +329,22 @@ class Dumper {
 
   std::string throughput() const;
 
+  void update_metrics(const std::string &schema, const std::string &table,
+                      const std::string &chunk,
+                      const Table_data_metrics &metrics);
+
+  void write_metrics(bool finished) const;
+
   mysqlshdk::storage::IDirectory *directory() const;
 
   std::unique_ptr<mysqlshdk::storage::IFile> make_file(
       const std::string &filename, bool use_mmap = false) const;
 
+  std::unique_ptr<mysqlshdk::storage::IFile> make_data_file(
+      const std::string &filename) const;
+
+  int compression_workers() const;
+
   std::string get_basename(const std::string &basename);
 
   bool compressed() const;
@@ -406,6 +422,10 @@ class Dumper {
   std::atomic<uint64_t> m_num_threads_dumping;
   std::atomic<uint64_t> m_ddl_written;
 
+  // number of statements executed while writing the DDL of tables
+  std::atomic<uint64_t> m_table_ddl_written;
+  std::atomic<uint64_t> m_table_ddl_round_trips;
+
   std::atomic<uint64_t> m_schema_metadata_written;
 
   std::atomic<uint64_t> m_table_metadata_to_write;
@@ -415,6 +435,8 @@ class Dumper {
   mutable std::recursive_mutex m_throughput_mutex;
   std::unique_ptr<mysqlshdk::textui::Throughput> m_data_throughput;
   std::unique_ptr<mysqlshdk::textui::Throughput> m_bytes_throughput;
+  // CPU time of the process when data dump has started
+  std::chrono::nanoseconds m_data_dump_cpu_start;
 
   std::mutex m_table_data_bytes_mutex;
   // schema -> table -> data bytes
@@ -424,11 +446,28 @@ class Dumper {
   // path -> uncompressed bytes
   std::unordered_map<std::string, uint64_t> m_chunk_file_bytes;
 
+  struct Chunk_stats {
+    bool chunked = false;
+    double chunking_time = 0.0;
+    uint64_t chunks = 0;
+    double rows = 0.0;
+    double rows_squared = 0.0;
+  };
+
+  // schema -> table -> chunking time and number of rows written to chunks
+  std::unordered_map<std::string, std::unordered_map<std::string, Chunk_stats>>
+      m_table_chunk_stats;
+
+  // set if metrics were requested
+  std::unique_ptr<Dump_metrics> m_metrics;
+
   // threads
   std::vector<std::thread> m_workers;
   std::vector<std::exception_ptr> m_worker_exceptions;
-  shcore::Synchronized_queue<Task_info> m_worker_tasks;
+  shcore::Work_stealing_queue<Task_info> m_worker_tasks;
   std::atomic<uint64_t> m_chunking_tasks;
+  // data tasks which were scheduled and not yet finished
+  std::atomic<uint64_t> m_data_tasks_left;
   std::atomic<bool> m_main_thread_finished_producing_chunking_tasks;
   std::unique_ptr<Synchronize_workers> m_worker_synchronization;
   std::function<std::unique_ptr<Dump_writer>()> m_writer_creator;
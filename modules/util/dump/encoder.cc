@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/encoder.h"
+
+#include <cstdint>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define ENCODER_HAVE_SIMD
+#include <immintrin.h>
+#define ENCODER_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define ENCODER_TARGET_AVX2 __attribute__((target("avx2")))
+#endif  // (__x86_64__ || _M_X64) && (__GNUC__ || __clang__)
+
+namespace mysqlsh {
+namespace dump {
+namespace encoder {
+
+namespace {
+
+constexpr char k_base64_alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+constexpr char k_hex_digits[] = "0123456789ABCDEF";
+
+char *base64_scalar(const char *data, std::size_t length, char *out) {
+  const auto in = reinterpret_cast<const uint8_t *>(data);
+  std::size_t i = 0;
+
+  for (; i + 3 <= length; i += 3) {
+    const uint32_t v = in[i] << 16 | in[i + 1] << 8 | in[i + 2];
+
+    *out++ = k_base64_alphabet[(v >> 18) & 0x3f];
+    *out++ = k_base64_alphabet[(v >> 12) & 0x3f];
+    *out++ = k_base64_alphabet[(v >> 6) & 0x3f];
+    *out++ = k_base64_alphabet[v & 0x3f];
+  }
+
+  if (const auto left = length - i) {
+    const uint32_t v = in[i] << 16 | (2 == left ? in[i + 1] << 8 : 0);
+
+    *out++ = k_base64_alphabet[(v >> 18) & 0x3f];
+    *out++ = k_base64_alphabet[(v >> 12) & 0x3f];
+    *out++ = 2 == left ? k_base64_alphabet[(v >> 6) & 0x3f] : '=';
+    *out++ = '=';
+  }
+
+  return out;
+}
+
+char *hex_scalar(const char *data, std::size_t length, char *out) {
+  const auto in = reinterpret_cast<const uint8_t *>(data);
+
+  for (std::size_t i = 0; i < length; ++i) {
+    *out++ = k_hex_digits[in[i] >> 4];
+    *out++ = k_hex_digits[in[i] & 0x0f];
+  }
+
+  return out;
+}
+
+#if defined(_MSC_VER)
+inline int count_trailing_zeros(uint32_t v) {
+  unsigned long index;
+  _BitScanForward(&index, v);
+  return static_cast<int>(index);
+}
+#else   // !_MSC_VER
+inline int count_trailing_zeros(uint32_t v) { return __builtin_ctz(v); }
+#endif  // !_MSC_VER
+
+// the largest control character which is escaped: 0x1A (ASCII 26)
+constexpr uint8_t k_max_escaped_control = 0x1A;
+
+const char *find_escape_candidate_scalar(
+    const char *first, const char *last,
+    const char (&escaped)[k_escaped_characters]) {
+  for (; first != last; ++first) {
+    const auto c = *first;
+
+    if (static_cast<uint8_t>(c) <= k_max_escaped_control ||
+        c == escaped[0] || c == escaped[1] || c == escaped[2] ||
+        c == escaped[3]) {
+      return first;
+    }
+  }
+
+  return last;
+}
+
+#ifdef ENCODER_HAVE_SIMD
+
+// x86-64 always supports SSE2, this is used by the "ssse3" implementation
+const char *find_escape_candidate_sse2(
+    const char *first, const char *last,
+    const char (&escaped)[k_escaped_characters]) {
+  const auto control = _mm_set1_epi8(k_max_escaped_control);
+  const auto e0 = _mm_set1_epi8(escaped[0]);
+  const auto e1 = _mm_set1_epi8(escaped[1]);
+  const auto e2 = _mm_set1_epi8(escaped[2]);
+  const auto e3 = _mm_set1_epi8(escaped[3]);
+
+  for (; last - first >= 16; first += 16) {
+    const auto in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+    // unsigned comparison: in <= control if min(in, control) == in
+    auto match = _mm_cmpeq_epi8(_mm_min_epu8(in, control), in);
+    match = _mm_or_si128(match, _mm_or_si128(_mm_cmpeq_epi8(in, e0),
+                                             _mm_cmpeq_epi8(in, e1)));
+    match = _mm_or_si128(match, _mm_or_si128(_mm_cmpeq_epi8(in, e2),
+                                             _mm_cmpeq_epi8(in, e3)));
+
+    if (const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(match))) {
+      return first + count_trailing_zeros(mask);
+    }
+  }
+
+  return find_escape_candidate_scalar(first, last, escaped);
+}
+
+// base64 encoding uses the algorithm described by Wojciech Muła: each 3 input
+// bytes are shuffled into a 32-bit word, multiplications move the four 6-bit
+// indices into separate bytes, which are then translated to the alphabet with
+// a single table lookup
+
+ENCODER_TARGET_SSSE3
+inline __m128i base64_unpack_sse(__m128i in) {
+  in = _mm_shuffle_epi8(
+      in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+  const auto t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const auto t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const auto t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const auto t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+  return _mm_or_si128(t1, t3);
+}
+
+ENCODER_TARGET_SSSE3
+inline __m128i base64_translate_sse(__m128i indices) {
+  // offsets of the ranges: A-Z, a-z, 0-9 (10 times), + and /
+  const auto offsets = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4,
+                                     -4, -4, -19, -16, 0, 0);
+  // 0 for [0..51], [1..12] for [52..63]
+  auto range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  // +1 for [26..63]
+  range = _mm_sub_epi8(range, _mm_cmpgt_epi8(indices, _mm_set1_epi8(25)));
+
+  return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+}
+
+ENCODER_TARGET_SSSE3
+char *base64_ssse3(const char *data, std::size_t length, char *out) {
+  const auto begin = data;
+
+  // 12 bytes are consumed, but 16 are loaded
+  for (; length - (data - begin) >= 16; data += 12, out += 16) {
+    const auto in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                     base64_translate_sse(base64_unpack_sse(in)));
+  }
+
+  return base64_scalar(data, length - (data - begin), out);
+}
+
+ENCODER_TARGET_SSSE3
+char *hex_ssse3(const char *data, std::size_t length, char *out) {
+  const auto digits =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(k_hex_digits));
+  const auto nibble = _mm_set1_epi8(0x0f);
+  const auto begin = data;
+
+  for (; length - (data - begin) >= 16; data += 16, out += 32) {
+    const auto in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+    const auto hi =
+        _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(in, 4), nibble));
+    const auto lo = _mm_shuffle_epi8(digits, _mm_and_si128(in, nibble));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                     _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16),
+                     _mm_unpackhi_epi8(hi, lo));
+  }
+
+  return hex_scalar(data, length - (data - begin), out);
+}
+
+ENCODER_TARGET_AVX2
+char *base64_avx2(const char *data, std::size_t length, char *out) {
+  const auto shuffle = _mm256_set_epi8(
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,  //
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+  const auto offsets = _mm256_setr_epi8(
+      65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,  //
+      65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+  const auto begin = data;
+
+  // each lane consumes 12 bytes, the second lane is loaded from data + 12, so
+  // 28 bytes need to be available
+  for (; length - (data - begin) >= 28; data += 24, out += 32) {
+    auto in = _mm256_castsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data)));
+    in = _mm256_inserti128_si256(
+        in, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 12)), 1);
+    in = _mm256_shuffle_epi8(in, shuffle);
+
+    const auto t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    const auto t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const auto t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    const auto t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const auto indices = _mm256_or_si256(t1, t3);
+
+    auto range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    range = _mm256_sub_epi8(
+        range, _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25)));
+
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i *>(out),
+        _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range)));
+  }
+
+  return base64_ssse3(data, length - (data - begin), out);
+}
+
+ENCODER_TARGET_AVX2
+char *hex_avx2(const char *data, std::size_t length, char *out) {
+  const auto digits = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(k_hex_digits)));
+  const auto nibble = _mm256_set1_epi8(0x0f);
+  const auto begin = data;
+
+  for (; length - (data - begin) >= 32; data += 32, out += 64) {
+    const auto in =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+    const auto hi = _mm256_shuffle_epi8(
+        digits, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble));
+    const auto lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(in, nibble));
+    // unpacking works within the lanes: a holds bytes [0..7] and [16..23],
+    // b holds bytes [8..15] and [24..31]
+    const auto a = _mm256_unpacklo_epi8(hi, lo);
+    const auto b = _mm256_unpackhi_epi8(hi, lo);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                        _mm256_permute2x128_si256(a, b, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 32),
+                        _mm256_permute2x128_si256(a, b, 0x31));
+  }
+
+  return hex_ssse3(data, length - (data - begin), out);
+}
+
+ENCODER_TARGET_AVX2
+const char *find_escape_candidate_avx2(
+    const char *first, const char *last,
+    const char (&escaped)[k_escaped_characters]) {
+  const auto control = _mm256_set1_epi8(k_max_escaped_control);
+  const auto e0 = _mm256_set1_epi8(escaped[0]);
+  const auto e1 = _mm256_set1_epi8(escaped[1]);
+  const auto e2 = _mm256_set1_epi8(escaped[2]);
+  const auto e3 = _mm256_set1_epi8(escaped[3]);
+
+  for (; last - first >= 32; first += 32) {
+    const auto in =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+    auto match = _mm256_cmpeq_epi8(_mm256_min_epu8(in, control), in);
+    match = _mm256_or_si256(match, _mm256_or_si256(_mm256_cmpeq_epi8(in, e0),
+                                                   _mm256_cmpeq_epi8(in, e1)));
+    match = _mm256_or_si256(match, _mm256_or_si256(_mm256_cmpeq_epi8(in, e2),
+                                                   _mm256_cmpeq_epi8(in, e3)));
+
+    if (const auto mask =
+            static_cast<uint32_t>(_mm256_movemask_epi8(match))) {
+      return first + count_trailing_zeros(mask);
+    }
+  }
+
+  return find_escape_candidate_sse2(first, last, escaped);
+}
+
+#endif  // ENCODER_HAVE_SIMD
+
+struct Implementation {
+  const char *name;
+  char *(*base64)(const char *, std::size_t, char *);
+  char *(*hex)(const char *, std::size_t, char *);
+  const char *(*find_escape_candidate)(const char *, const char *,
+                                       const char (&)[k_escaped_characters]);
+};
+
+Implementation select_implementation() {
+#ifdef ENCODER_HAVE_SIMD
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx2")) {
+    return {"avx2", base64_avx2, hex_avx2, find_escape_candidate_avx2};
+  }
+
+  if (__builtin_cpu_supports("ssse3")) {
+    return {"ssse3", base64_ssse3, hex_ssse3, find_escape_candidate_sse2};
+  }
+#endif  // ENCODER_HAVE_SIMD
+
+  return {"scalar", base64_scalar, hex_scalar, find_escape_candidate_scalar};
+}
+
+const Implementation &implementation_impl() {
+  static const Implementation s_impl = select_implementation();
+  return s_impl;
+}
+
+}  // namespace
+
+char *base64(const char *data, std::size_t length, char *out) {
+  return implementation_impl().base64(data, length, out);
+}
+
+char *hex(const char *data, std::size_t length, char *out) {
+  return implementation_impl().hex(data, length, out);
+}
+
+const char *find_escape_candidate(
+    const char *first, const char *last,
+    const char (&escaped)[k_escaped_characters]) {
+  return implementation_impl().find_escape_candidate(first, last, escaped);
+}
+
+const char *implementation() { return implementation_impl().name; }
+
+}  // namespace encoder
+}  // namespace dump
+}  // namespace mysqlsh
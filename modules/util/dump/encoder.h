@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_ENCODER_H_
+#define MODULES_UTIL_DUMP_ENCODER_H_
+
+#include <cstddef>
+
+namespace mysqlsh {
+namespace dump {
+namespace encoder {
+
+/**
+ * Length of the base64 representation of the given number of bytes, including
+ * the padding.
+ */
+constexpr std::size_t base64_length(std::size_t length) {
+  return (length + 2) / 3 * 4;
+}
+
+/**
+ * Length of the hexadecimal representation of the given number of bytes.
+ */
+constexpr std::size_t hex_length(std::size_t length) { return 2 * length; }
+
+/**
+ * Encodes the given data using base64 (RFC 4648), without line breaks. Output
+ * is the same as the one produced by TO_BASE64(), once the new line
+ * characters are removed.
+ *
+ * @param data Data to encode.
+ * @param length Length of the data.
+ * @param out Output buffer, needs to hold at least base64_length(length)
+ *        bytes.
+ *
+ * @returns Pointer past the last written byte.
+ */
+char *base64(const char *data, std::size_t length, char *out);
+
+/**
+ * Encodes the given data using upper case hexadecimal digits, output is the
+ * same as the one produced by HEX().
+ *
+ * @param data Data to encode.
+ * @param length Length of the data.
+ * @param out Output buffer, needs to hold at least hex_length(length) bytes.
+ *
+ * @returns Pointer past the last written byte.
+ */
+char *hex(const char *data, std::size_t length, char *out);
+
+/**
+ * Number of dialect-specific characters handled by find_escape_candidate().
+ */
+constexpr int k_escaped_characters = 4;
+
+/**
+ * Finds the first byte in range [first, last) which may need to be escaped by
+ * a text dump writer: a control character in range [0x00, 0x1A] or one of the
+ * given dialect-specific characters. Unused characters should be set to 0.
+ *
+ * Bytes in range [first, result) can be copied as they are.
+ *
+ * @returns Pointer to the matching byte or last if there's none.
+ */
+const char *find_escape_candidate(const char *first, const char *last,
+                                  const char (&escaped)[k_escaped_characters]);
+
+/**
+ * Name of the implementation selected at runtime: "avx2", "ssse3" or
+ * "scalar".
+ */
+const char *implementation();
+
+}  // namespace encoder
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_ENCODER_H_
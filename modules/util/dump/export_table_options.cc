@@ -25,6 +25,7 @@
 
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 
@@ -45,6 +46,8 @@ const shcore::Option_pack_def<Export_table_options>
           .include<Dump_options>()
           .optional("where", &Export_table_options::m_where)
           .optional("partitions", &Export_table_options::m_partitions)
+          .optional("compressionFrameSize",
+                    &Export_table_options::set_compression_frame_size)
           .include(&Export_table_options::m_oci_bucket_options)
           .include(&Export_table_options::m_s3_bucket_options)
           .include(&Export_table_options::m_blob_storage_options)
@@ -70,6 +73,13 @@ void Export_table_options::on_unpacked_options() {
   if (m_blob_storage_options) {
     set_storage_config(m_blob_storage_options.config());
   }
+
+  if (m_compression_frame_size > 0 &&
+      mysqlshdk::storage::Compression::ZSTD != compression()) {
+    throw std::invalid_argument(
+        "The 'compressionFrameSize' option can only be used if the "
+        "'compression' option is set to 'zstd'.");
+  }
 }
 
 void Export_table_options::set_table(const std::string &schema_table) {
@@ -111,6 +121,16 @@ void Export_table_options::validate_options() const {
   }
 }
 
+void Export_table_options::set_compression_frame_size(
+    const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument(
+        "The option 'compressionFrameSize' cannot be set to an empty string.");
+  }
+
+  m_compression_frame_size = mysqlshdk::utils::expand_to_bytes(value);
+}
+
 void Export_table_options::on_set_schema() {
   if (!schema().empty()) {
     filters().schemas().include(schema());
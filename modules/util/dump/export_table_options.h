@@ -67,6 +67,12 @@ class Export_table_options : public Dump_options {
 
   std::size_t threads() const override { return 1; }
 
+  uint64_t compression_threads() const override { return 0; }
+
+  uint64_t compression_frame_size() const override {
+    return m_compression_frame_size;
+  }
+
   bool dump_ddl() const override { return false; }
 
   bool dump_data() const override { return true; }
@@ -91,6 +97,8 @@ class Export_table_options : public Dump_options {
 
   bool par_manifest() const override { return false; }
 
+  std::optional<Metrics_format> metrics_format() const override { return {}; }
+
  private:
   void on_set_session(
       const std::shared_ptr<mysqlshdk::db::ISession> &session) override;
@@ -101,12 +109,16 @@ class Export_table_options : public Dump_options {
 
   void on_set_schema();
 
+  void set_compression_frame_size(const std::string &value);
+
   std::string m_schema;
   std::string m_table;
 
   std::string m_where;
   std::unordered_set<std::string> m_partitions;
 
+  uint64_t m_compression_frame_size = 0;
+
   mysqlshdk::oci::Oci_bucket_options m_oci_bucket_options;
   mysqlshdk::aws::S3_bucket_options m_s3_bucket_options;
   mysqlshdk::azure::Blob_storage_options m_blob_storage_options;
@@ -26,11 +26,17 @@
 #include <mysqld_error.h>
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <iterator>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/profiling.h"
@@ -114,6 +120,33 @@ struct Instance_cache_builder::Iterate_table
   std::string table_column;
 };
 
+class Instance_cache_builder::Collector_times final {
+ public:
+  template <typename F>
+  void measure(const char *collector, F &&f) {
+    mysqlshdk::utils::Duration duration;
+    duration.start();
+
+    f();
+
+    duration.finish();
+
+    std::lock_guard lock{m_mutex};
+    m_times[collector] += duration.seconds_elapsed();
+  }
+
+  void log() const {
+    // when collectors run concurrently, this is the sum of times of all batches
+    for (const auto &time : m_times) {
+      log_info("Fetching %s took %f seconds", time.first.c_str(), time.second);
+    }
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::map<std::string, double> m_times;
+};
+
 struct Instance_cache_builder::Query_helper {
   static std::string case_sensitive_compare(const std::string &column,
                                             const std::string &value) {
@@ -301,13 +334,18 @@ Instance_cache_builder::Instance_cache_builder(
 
   if (m_cache.schemas.empty()) {
     fetch_version();
-    fetch_explain_select_rows_index();
 
     filter_schemas();
     filter_tables();
   }
 }
 
+Instance_cache_builder &Instance_cache_builder::helper_sessions(
+    std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions) {
+  m_helper_sessions = std::move(sessions);
+  return *this;
+}
+
 Instance_cache_builder &Instance_cache_builder::metadata(
     const Partition_filters &partitions) {
   fetch_metadata(partitions);
@@ -548,11 +586,143 @@ void Instance_cache_builder::fetch_metadata(
 
   fetch_ndbinfo();
   fetch_server_metadata();
-  fetch_view_metadata();
-  fetch_columns();
-  fetch_table_indexes();
-  fetch_table_histograms();
-  fetch_table_partitions(partitions);
+
+  Collector_times times;
+
+  if (m_helper_sessions.empty()) {
+    times.measure("view metadata", [this]() { fetch_view_metadata(); });
+    times.measure("columns", [this]() { fetch_columns(); });
+    times.measure("table indexes", [this]() { fetch_table_indexes(); });
+    times.measure("table histograms", [this]() { fetch_table_histograms(); });
+    times.measure("table partitions", [this, &partitions]() {
+      fetch_table_partitions(partitions);
+    });
+  } else {
+    fetch_metadata_concurrently(partitions, &times);
+  }
+
+  times.log();
+}
+
+void Instance_cache_builder::fetch_metadata_concurrently(
+    const Partition_filters &partitions, Collector_times *times) {
+  Profiler profiler{"fetching metadata concurrently"};
+
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions;
+  sessions.reserve(m_helper_sessions.size() + 1);
+  sessions.emplace_back(m_session);
+  sessions.insert(sessions.end(), m_helper_sessions.begin(),
+                  m_helper_sessions.end());
+
+  const auto batches = schema_batches(sessions.size());
+
+  using Task =
+      std::function<void(const std::shared_ptr<mysqlshdk::db::ISession> &)>;
+  std::vector<Task> tasks;
+
+  // collectors write to different members of the cached objects, the structure
+  // of the cache is not modified, so they can run concurrently; indexes refer
+  // to columns, so these are fetched one after another
+  for (const auto &batch : batches) {
+    tasks.emplace_back([this, &batch, times](const auto &session) {
+      const Metadata_batch b{session, &batch};
+      times->measure("columns", [this, &b]() { fetch_columns(&b); });
+      times->measure("table indexes",
+                     [this, &b]() { fetch_table_indexes(&b); });
+    });
+  }
+
+  for (const auto &batch : batches) {
+    tasks.emplace_back([this, &batch, &partitions, times](const auto &session) {
+      const Metadata_batch b{session, &batch};
+      times->measure("table partitions", [this, &partitions, &b]() {
+        fetch_table_partitions(partitions, &b);
+      });
+    });
+  }
+
+  for (const auto &batch : batches) {
+    tasks.emplace_back([this, &batch, times](const auto &session) {
+      const Metadata_batch b{session, &batch};
+      times->measure("table histograms",
+                     [this, &b]() { fetch_table_histograms(&b); });
+    });
+  }
+
+  // views are usually not numerous, there's no need to split them
+  tasks.emplace_back([this, times](const auto &session) {
+    const Metadata_batch b{session, nullptr};
+    times->measure("view metadata", [this, &b]() { fetch_view_metadata(&b); });
+  });
+
+  std::atomic<std::size_t> next_task{0};
+  std::vector<std::exception_ptr> exceptions(sessions.size());
+
+  const auto run = [&tasks, &next_task, &exceptions, &sessions](std::size_t i) {
+    try {
+      std::size_t task;
+
+      while ((task = next_task++) < tasks.size()) {
+        tasks[task](sessions[i]);
+      }
+    } catch (...) {
+      exceptions[i] = std::current_exception();
+      // do not start any new tasks
+      next_task = tasks.size();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(m_helper_sessions.size());
+
+  for (std::size_t i = 1; i < sessions.size(); ++i) {
+    threads.emplace_back(mysqlsh::spawn_scoped_thread([&run, i]() { run(i); }));
+  }
+
+  // main session is used by the current thread
+  run(0);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (const auto &exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+
+std::vector<std::set<std::string>> Instance_cache_builder::schema_batches(
+    std::size_t count) const {
+  // schema -> number of tables and views
+  std::vector<std::pair<const std::string *, std::size_t>> schemas;
+
+  for (const auto &schema : m_cache.schemas) {
+    const auto objects =
+        schema.second.tables.size() + schema.second.views.size();
+
+    if (objects > 0) {
+      schemas.emplace_back(&schema.first, objects);
+    }
+  }
+
+  // assign the biggest schemas first, each one to the least loaded batch
+  std::sort(schemas.begin(), schemas.end(), [](const auto &l, const auto &r) {
+    return l.second > r.second || (l.second == r.second && *l.first < *r.first);
+  });
+
+  std::vector<std::set<std::string>> batches(std::min(count, schemas.size()));
+  std::vector<std::size_t> load(batches.size(), 0);
+
+  for (const auto &schema : schemas) {
+    const auto idx = std::min_element(load.begin(), load.end()) - load.begin();
+
+    batches[idx].emplace(*schema.first);
+    load[idx] += schema.second;
+  }
+
+  return batches;
 }
 
 void Instance_cache_builder::fetch_version() {
@@ -561,11 +731,6 @@ void Instance_cache_builder::fetch_version() {
   m_cache.server_version = Schema_dumper{m_session}.server_version();
 }
 
-void Instance_cache_builder::fetch_explain_select_rows_index() {
-  m_cache.explain_rows_idx =
-      query("EXPLAIN SELECT 1")->field_names()->field_index("rows");
-}
-
 void Instance_cache_builder::fetch_server_metadata() {
   Profiler profiler{"fetching server metadata"};
 
@@ -604,7 +769,7 @@ void Instance_cache_builder::fetch_ndbinfo() {
   }
 }
 
-void Instance_cache_builder::fetch_view_metadata() {
+void Instance_cache_builder::fetch_view_metadata(const Metadata_batch *batch) {
   Profiler profiler{"fetching view metadata"};
 
   if (!has_views()) {
@@ -620,15 +785,19 @@ void Instance_cache_builder::fetch_view_metadata() {
   };
   info.table_name = "views";
 
-  iterate_views(info, [](const std::string &, const std::string &,
-                         Instance_cache::View *view,
-                         const mysqlshdk::db::IRow *row) {
-    view->character_set_client = row->get_string(2);  // CHARACTER_SET_CLIENT
-    view->collation_connection = row->get_string(3);  // COLLATION_CONNECTION
-  });
+  iterate_views(
+      info,
+      [](const std::string &, const std::string &, Instance_cache::View *view,
+         const mysqlshdk::db::IRow *row) {
+        view->character_set_client =
+            row->get_string(2);  // CHARACTER_SET_CLIENT
+        view->collation_connection =
+            row->get_string(3);  // COLLATION_CONNECTION
+      },
+      batch);
 }
 
-void Instance_cache_builder::fetch_columns() {
+void Instance_cache_builder::fetch_columns(const Metadata_batch *batch) {
   Profiler profiler{"fetching columns"};
 
   if (!has_tables() && !has_views()) {
@@ -696,7 +865,8 @@ void Instance_cache_builder::fetch_columns() {
         view_columns[schema_name][view_name].emplace(
             row->get_uint(4),  // ORDINAL_POSITION
             create_column(row));
-      });
+      },
+      batch);
 
   for (auto &schema : table_columns) {
     auto &s = m_cache.schemas.at(schema.first);
@@ -735,7 +905,7 @@ void Instance_cache_builder::fetch_columns() {
   }
 }
 
-void Instance_cache_builder::fetch_table_indexes() {
+void Instance_cache_builder::fetch_table_indexes(const Metadata_batch *batch) {
   Profiler profiler{"fetching table indexes"};
 
   if (!has_tables()) {
@@ -746,12 +916,13 @@ void Instance_cache_builder::fetch_table_indexes() {
   info.schema_column = "TABLE_SCHEMA";  // NOT NULL
   info.table_column = "TABLE_NAME";
   info.extra_columns = {
-      "INDEX_NAME",   // can be NULL in 8.0
-      "COLUMN_NAME",  // can be NULL in 8.0
-      "SEQ_IN_INDEX"  // NOT NULL
+      "INDEX_NAME",    // can be NULL in 8.0
+      "COLUMN_NAME",   // can be NULL in 8.0
+      "SEQ_IN_INDEX",  // NOT NULL
+      "SUB_PART"       // can be NULL
   };
   info.table_name = "statistics";
-  info.where = "COLUMN_NAME IS NOT NULL AND NON_UNIQUE=0";
+  info.where = "NON_UNIQUE=0";
 
   const std::string primary_index = "PRIMARY";
   // schema -> table -> index name -> columns
@@ -761,16 +932,34 @@ void Instance_cache_builder::fetch_table_indexes() {
           std::string,
           std::map<std::string, std::map<uint64_t, Instance_cache::Column *>>>>
       indexes;
+  // schema -> table -> names of indexes with prefix or functional key parts,
+  // server does not use such indexes as a primary key
+  std::unordered_map<
+      std::string,
+      std::unordered_map<std::string, std::unordered_set<std::string>>>
+      partial_indexes;
 
   iterate_tables(
       info,
-      [&indexes](const std::string &schema_name, const std::string &table_name,
-                 Instance_cache::Table *t, const mysqlshdk::db::IRow *row) {
+      [&indexes, &partial_indexes](
+          const std::string &schema_name, const std::string &table_name,
+          Instance_cache::Table *t, const mysqlshdk::db::IRow *row) {
         // INDEX_NAME can be NULL in 8.0, as per output of 'SHOW COLUMNS', but
         // it's not likely, as it's NOT NULL in definition of mysql.indexes
         // hidden table
-        //
-        // NULL values in COLUMN_NAME are filtered out
+        const auto index_name = row->get_string(2, "");
+
+        // COLUMN_NAME is NULL for functional key parts, SUB_PART is not NULL
+        // for prefix key parts
+        if (row->is_null(3) || !row->is_null(5)) {
+          partial_indexes[schema_name][table_name].emplace(index_name);
+        }
+
+        // functional key parts are not used when chunking
+        if (row->is_null(3)) {
+          return;
+        }
+
         const auto column =
             std::find_if(t->all_columns.begin(), t->all_columns.end(),
                          [name = row->get_string(3)](const auto &c) {
@@ -780,18 +969,30 @@ void Instance_cache_builder::fetch_table_indexes() {
         // column will not be found if user is missing SELECT privilege and it
         // was not possible to fetch column information
         if (t->all_columns.end() != column) {
-          indexes[schema_name][table_name][row->get_string(2, "")].emplace(
-              row->get_uint(4), &(*column));  // INDEX_NAME, SEQ_IN_INDEX
+          indexes[schema_name][table_name][index_name].emplace(
+              row->get_uint(4), &(*column));  // SEQ_IN_INDEX
         } else {
           assert(t->all_columns.empty());
         }
-      });
+      },
+      batch);
 
   for (const auto &schema : indexes) {
     auto &s = m_cache.schemas.at(schema.first);
 
     for (const auto &table : schema.second) {
       auto &t = s.tables.at(table.first);
+      const auto &partial = partial_indexes[schema.first][table.first];
+
+      for (const auto &idx : table.second) {
+        // explicit primary key is always used, even if it has prefix parts
+        if ((primary_index == idx.first || !partial.count(idx.first)) &&
+            std::none_of(idx.second.begin(), idx.second.end(),
+                         [](const auto &c) { return c.second->nullable; })) {
+          t.has_not_null_unique_key = true;
+          break;
+        }
+      }
 
       auto index = table.second.find(primary_index);
       bool primary = false;
@@ -889,7 +1090,8 @@ void Instance_cache_builder::fetch_table_indexes() {
   }
 }
 
-void Instance_cache_builder::fetch_table_histograms() {
+void Instance_cache_builder::fetch_table_histograms(
+    const Metadata_batch *batch) {
   Profiler profiler{"fetching table histograms"};
 
   if (!has_tables() || !m_cache.server_version.is_8_0) {
@@ -908,8 +1110,9 @@ void Instance_cache_builder::fetch_table_histograms() {
     info.table_name = "column_statistics";
 
     iterate_tables(
-        info, [](const std::string &, const std::string &,
-                 Instance_cache::Table *table, const mysqlshdk::db::IRow *row) {
+        info,
+        [](const std::string &, const std::string &,
+           Instance_cache::Table *table, const mysqlshdk::db::IRow *row) {
           Instance_cache::Histogram histogram;
 
           histogram.column = row->get_string(2);  // COLUMN_NAME
@@ -917,9 +1120,15 @@ void Instance_cache_builder::fetch_table_histograms() {
               row->get_string(3));  // number-of-buckets-specified
 
           table->histograms.emplace_back(std::move(histogram));
-        });
+        },
+        batch);
 
     for (auto &schema : m_cache.schemas) {
+      // other batches may be modified concurrently
+      if (batch && batch->schemas && !batch->schemas->count(schema.first)) {
+        continue;
+      }
+
       for (auto &table : schema.second.tables) {
         std::sort(
             table.second.histograms.begin(), table.second.histograms.end(),
@@ -933,7 +1142,7 @@ void Instance_cache_builder::fetch_table_histograms() {
 }
 
 void Instance_cache_builder::fetch_table_partitions(
-    const Partition_filters &partitions) {
+    const Partition_filters &partitions, const Metadata_batch *batch) {
   Profiler profiler{"fetching table partitions"};
 
   if (!has_tables()) {
@@ -982,9 +1191,10 @@ void Instance_cache_builder::fetch_table_partitions(
       };
 
   iterate_tables(
-      info, [&include_partition](const std::string &s, const std::string &t,
-                                 Instance_cache::Table *table,
-                                 const mysqlshdk::db::IRow *row) {
+      info,
+      [&include_partition](const std::string &s, const std::string &t,
+                           Instance_cache::Table *table,
+                           const mysqlshdk::db::IRow *row) {
         if (shcore::str_caseeq(table->engine, "NDB", "NDBCLUSTER")) {
           // Partition selection is disabled for tables employing a storage
           // engine that supplies automatic partitioning, such as NDB. Ignore
@@ -1007,7 +1217,8 @@ void Instance_cache_builder::fetch_table_partitions(
         p.average_row_length = row->get_uint(5, 0);  // AVG_ROW_LENGTH
 
         table->partitions.emplace_back(std::move(p));
-      });
+      },
+      batch);
 }
 
 void Instance_cache_builder::iterate_schemas(
@@ -1051,11 +1262,25 @@ void Instance_cache_builder::iterate_tables_and_views(
                              const mysqlshdk::db::IRow *)> &table_callback,
     const std::function<void(const std::string &, const std::string &,
                              Instance_cache::View *,
-                             const mysqlshdk::db::IRow *)> &view_callback) {
+                             const mysqlshdk::db::IRow *)> &view_callback,
+    const Metadata_batch *batch) {
   Profiler profiler{"iterating tables and views"};
 
-  const auto result =
-      query(QH::build_query(info, schema_and_table_filter(info)));
+  auto filter = schema_and_table_filter(info);
+  const std::set<std::string> *batch_schemas = nullptr;
+
+  if (batch && batch->schemas) {
+    batch_schemas = batch->schemas;
+
+    if (!filter.empty()) {
+      filter += " AND ";
+    }
+
+    filter += QH::compare(info.schema_column, *batch_schemas, true);
+  }
+
+  const auto sql = QH::build_query(info, filter);
+  const auto result = batch ? batch->session->query(sql) : query(sql);
 
   std::string current_schema;
   Instance_cache::Schema *schema = nullptr;
@@ -1074,7 +1299,10 @@ void Instance_cache_builder::iterate_tables_and_views(
 
         const auto it = m_cache.schemas.find(current_schema);
 
-        if (it != m_cache.schemas.end()) {
+        // comparison in the query may be case-insensitive, schemas which
+        // belong to other batches are skipped
+        if (it != m_cache.schemas.end() &&
+            (!batch_schemas || batch_schemas->count(current_schema))) {
           schema = &it->second;
         } else {
           schema = nullptr;
@@ -1123,20 +1351,22 @@ void Instance_cache_builder::iterate_tables(
     const Iterate_table &info,
     const std::function<void(const std::string &, const std::string &,
                              Instance_cache::Table *,
-                             const mysqlshdk::db::IRow *)> &callback) {
+                             const mysqlshdk::db::IRow *)> &callback,
+    const Metadata_batch *batch) {
   Profiler profiler{"iterating tables"};
 
-  iterate_tables_and_views(info, callback, {});
+  iterate_tables_and_views(info, callback, {}, batch);
 }
 
 void Instance_cache_builder::iterate_views(
     const Iterate_table &info,
     const std::function<void(const std::string &, const std::string &,
                              Instance_cache::View *,
-                             const mysqlshdk::db::IRow *)> &callback) {
+                             const mysqlshdk::db::IRow *)> &callback,
+    const Metadata_batch *batch) {
   Profiler profiler{"iterating views"};
 
-  iterate_tables_and_views(info, {}, callback);
+  iterate_tables_and_views(info, {}, callback, batch);
 }
 
 void Instance_cache_builder::set_schema_filter() {
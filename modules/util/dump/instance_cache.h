@@ -107,6 +107,8 @@ struct Instance_cache {
     std::string create_options;
     std::string comment;
     Index index;
+    // PRIMARY KEY or a UNIQUE index on NOT NULL columns
+    bool has_not_null_unique_key = false;
     std::vector<Column *> columns;
     std::vector<Column> all_columns;
     std::vector<Histogram> histograms;
@@ -164,7 +166,6 @@ struct Instance_cache {
   std::string hostname;
   std::string server;
   Server_version server_version;
-  uint32_t explain_rows_idx = 0;
   Binlog binlog;
   std::string gtid_executed;
   std::unordered_map<std::string, Schema> schemas;
@@ -195,6 +196,17 @@ class Instance_cache_builder final {
   Instance_cache_builder &operator=(const Instance_cache_builder &) = delete;
   Instance_cache_builder &operator=(Instance_cache_builder &&) = delete;
 
+  /**
+   * Provides additional sessions which are used to fetch the metadata
+   * concurrently, together with the main session. Schemas are split into
+   * batches, which are handled in parallel. If consistency is required, all
+   * sessions need to share the same consistent snapshot.
+   *
+   * Needs to be called before metadata().
+   */
+  Instance_cache_builder &helper_sessions(
+      std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions);
+
   Instance_cache_builder &metadata(const Partition_filters &partitions);
 
   Instance_cache_builder &users();
@@ -226,29 +238,44 @@ class Instance_cache_builder final {
     std::string name;
   };
 
+  /**
+   * Session and schemas used by a metadata collector.
+   */
+  struct Metadata_batch {
+    std::shared_ptr<mysqlshdk::db::ISession> session;
+    // all schemas are handled if this is not set
+    const std::set<std::string> *schemas = nullptr;
+  };
+
+  class Collector_times;
+
   void filter_schemas();
 
   void filter_tables();
 
   void fetch_metadata(const Partition_filters &partitions);
 
-  void fetch_version();
+  void fetch_metadata_concurrently(const Partition_filters &partitions,
+                                   Collector_times *times);
 
-  void fetch_explain_select_rows_index();
+  std::vector<std::set<std::string>> schema_batches(std::size_t count) const;
+
+  void fetch_version();
 
   void fetch_server_metadata();
 
   void fetch_ndbinfo();
 
-  void fetch_view_metadata();
+  void fetch_view_metadata(const Metadata_batch *batch = nullptr);
 
-  void fetch_columns();
+  void fetch_columns(const Metadata_batch *batch = nullptr);
 
-  void fetch_table_indexes();
+  void fetch_table_indexes(const Metadata_batch *batch = nullptr);
 
-  void fetch_table_histograms();
+  void fetch_table_histograms(const Metadata_batch *batch = nullptr);
 
-  void fetch_table_partitions(const Partition_filters &partitions);
+  void fetch_table_partitions(const Partition_filters &partitions,
+                              const Metadata_batch *batch = nullptr);
 
   void iterate_schemas(
       const Iterate_schema &info,
@@ -259,13 +286,15 @@ class Instance_cache_builder final {
       const Iterate_table &info,
       const std::function<void(const std::string &, const std::string &,
                                Instance_cache::Table *,
-                               const mysqlshdk::db::IRow *)> &callback);
+                               const mysqlshdk::db::IRow *)> &callback,
+      const Metadata_batch *batch = nullptr);
 
   void iterate_views(
       const Iterate_table &info,
       const std::function<void(const std::string &, const std::string &,
                                Instance_cache::View *,
-                               const mysqlshdk::db::IRow *)> &callback);
+                               const mysqlshdk::db::IRow *)> &callback,
+      const Metadata_batch *batch = nullptr);
 
   void iterate_tables_and_views(
       const Iterate_table &info,
@@ -274,7 +303,8 @@ class Instance_cache_builder final {
                                const mysqlshdk::db::IRow *)> &table_callback,
       const std::function<void(const std::string &, const std::string &,
                                Instance_cache::View *,
-                               const mysqlshdk::db::IRow *)> &view_callback);
+                               const mysqlshdk::db::IRow *)> &view_callback,
+      const Metadata_batch *batch = nullptr);
 
   inline bool has_tables() const { return m_has_tables; }
 
@@ -349,6 +379,8 @@ class Instance_cache_builder final {
 
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
 
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> m_helper_sessions;
+
   Instance_cache m_cache;
 
   const common::Filtering_options &m_filters;
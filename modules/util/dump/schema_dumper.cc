@@ -436,6 +436,7 @@ void Schema_dumper::write_comment(IFile *sql_file, const std::string &db_name,
 int Schema_dumper::execute_no_throw(const std::string &s,
                                     mysqlshdk::db::Error *out_error) {
   try {
+    ++m_round_trips;
     m_mysql->execute(s);
   } catch (const mysqlshdk::db::Error &e) {
     if (out_error) *out_error = e;
@@ -450,6 +451,7 @@ int Schema_dumper::execute_no_throw(const std::string &s,
 int Schema_dumper::execute_maybe_throw(const std::string &s,
                                        mysqlshdk::db::Error *out_error) {
   try {
+    ++m_round_trips;
     m_mysql->execute(s);
   } catch (const mysqlshdk::db::Error &e) {
     if (out_error) *out_error = e;
@@ -468,6 +470,7 @@ int Schema_dumper::query_no_throw(
     const std::string &s, std::shared_ptr<mysqlshdk::db::IResult> *out_result,
     mysqlshdk::db::Error *out_error) {
   try {
+    ++m_round_trips;
     *out_result = m_mysql->query(s);
     return 0;
   } catch (const mysqlshdk::db::Error &e) {
@@ -482,6 +485,7 @@ int Schema_dumper::query_no_throw(
 std::shared_ptr<mysqlshdk::db::IResult> Schema_dumper::query_log_and_throw(
     const std::string &s) {
   try {
+    ++m_round_trips;
     return m_mysql->query(s);
   } catch (const mysqlshdk::db::Error &e) {
     current_console()->print_error("Could not execute '" + s +
@@ -493,6 +497,7 @@ std::shared_ptr<mysqlshdk::db::IResult> Schema_dumper::query_log_and_throw(
 std::shared_ptr<mysqlshdk::db::IResult> Schema_dumper::query_log_error(
     const std::string &sql, const std::string &schema,
     const std::string &table) const {
+  ++m_round_trips;
   return m_mysql->queryf(sql, schema, table);
 }
 
@@ -551,6 +556,7 @@ void Schema_dumper::fetch_db_collation(const std::string &db,
 */
 void Schema_dumper::switch_character_set_results(const char *cs_name) {
   try {
+    ++m_round_trips;
     m_mysql->executef("SET SESSION character_set_results = ?", cs_name);
   } catch (const mysqlshdk::db::Error &e) {
     THROW_ERROR(SHERR_DUMP_SD_CHARACTER_SET_RESULTS_ERROR, cs_name);
@@ -558,6 +564,7 @@ void Schema_dumper::switch_character_set_results(const char *cs_name) {
 }
 
 void Schema_dumper::use(const std::string &db) const {
+  ++m_round_trips;
   m_mysql->executef("USE !", db);
 }
 
@@ -944,7 +951,25 @@ std::vector<Schema_dumper::Issue> Schema_dumper::check_ct_for_mysqlaas(
   std::vector<Schema_dumper::Issue> res;
   const auto prefix = "Table " + quote(db, table) + " ";
 
-  if (opt_pk_mandatory_check) {
+  const Instance_cache::Table *cached_table = nullptr;
+
+  if (m_cache) {
+    cached_table = &m_cache->schemas.at(db).tables.at(table);
+
+    // column information is not available if user is missing the SELECT
+    // privilege, in such case the server has to be asked
+    if (cached_table->all_columns.empty()) {
+      cached_table = nullptr;
+    }
+  }
+
+  if (opt_pk_mandatory_check && cached_table) {
+    if (!cached_table->has_not_null_unique_key) {
+      res.emplace_back(
+          prefix + "does not have primary or unique non null key defined",
+          Issue::Status::FIX_MANUALLY);
+    }
+  } else if (opt_pk_mandatory_check) {
     try {
       // check if table has primary key
       const auto result = query_log_error(
@@ -2112,6 +2137,7 @@ char Schema_dumper::check_if_ignore_table(const std::string &db,
     }
   } else {
     try {
+      ++m_round_trips;
       res = m_mysql->query("show table status like " +
                            quote_for_like(table_name));
     } catch (const mysqlshdk::db::Error &e) {
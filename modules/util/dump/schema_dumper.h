@@ -150,6 +150,11 @@ class Schema_dumper {
 
   bool partial_revokes() const;
 
+  /**
+   * Number of statements sent to the server by this instance so far.
+   */
+  uint64_t round_trips() const { return m_round_trips; }
+
  public:
   // Config options
   bool opt_force = false;
@@ -221,6 +226,8 @@ class Schema_dumper {
 
   mutable std::optional<bool> m_partial_revokes;
 
+  mutable uint64_t m_round_trips = 0;
+
  private:
   int execute_no_throw(const std::string &s,
                        mysqlshdk::db::Error *out_error = nullptr);
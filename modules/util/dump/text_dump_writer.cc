@@ -124,6 +124,9 @@ void Text_dump_writer::read_metadata(
   m_needs_escape.clear();
   m_needs_escape.resize(m_num_fields);
 
+  m_encoding.clear();
+  m_encoding.resize(m_num_fields, Encoding_type::NONE);
+
   std::size_t fixed_length =
       m_dialect.lines_starting_by.length() + m_line_terminator.length();
 
@@ -150,6 +153,21 @@ void Text_dump_writer::read_metadata(
           m_needs_escape[i] = m_base64_need_escape;
         else if (pre_encoded_columns[i] == Encoding_type::HEX)
           m_needs_escape[i] = m_hex_need_escape;
+        else if (pre_encoded_columns[i] == Encoding_type::ENCODE_BASE64)
+          m_needs_escape[i] = Escape_type::FULL == m_base64_need_escape
+                                  ? Escape_type::FULL
+                                  : Escape_type::ENCODE_BASE64;
+        else if (pre_encoded_columns[i] == Encoding_type::ENCODE_HEX)
+          m_needs_escape[i] = Escape_type::FULL == m_hex_need_escape
+                                  ? Escape_type::FULL
+                                  : Escape_type::ENCODE_HEX;
+
+        // if encoded data needs to be escaped, it's encoded to a temporary
+        // buffer first
+        if (Escape_type::FULL == m_needs_escape[i] &&
+            (pre_encoded_columns[i] == Encoding_type::ENCODE_BASE64 ||
+             pre_encoded_columns[i] == Encoding_type::ENCODE_HEX))
+          m_encoding[i] = pre_encoded_columns[i];
       }
     }
 
@@ -197,7 +215,24 @@ void Text_dump_writer::store_field(const mysqlshdk::db::IRow *row,
   } else {
     quote_field(idx);
 
-    if (!m_escape || m_needs_escape[idx] == Escape_type::NONE) {
+    if (Encoding_type::NONE != m_encoding[idx]) {
+      if (Encoding_type::ENCODE_BASE64 == m_encoding[idx]) {
+        m_encoded.resize(encoder::base64_length(length));
+        encoder::base64(data, length, m_encoded.data());
+      } else {
+        m_encoded.resize(encoder::hex_length(length));
+        encoder::hex(data, length, m_encoded.data());
+      }
+
+      data = m_encoded.data();
+      length = m_encoded.length();
+    }
+
+    if (m_needs_escape[idx] == Escape_type::ENCODE_BASE64) {
+      buffer()->write_base64(data, length);
+    } else if (m_needs_escape[idx] == Escape_type::ENCODE_HEX) {
+      buffer()->write_hex(data, length);
+    } else if (!m_escape || m_needs_escape[idx] == Escape_type::NONE) {
       buffer()->will_write(length);
       buffer()->append(data, length);
     } else if (m_escape && m_needs_escape[idx] == Escape_type::BASE64 &&
@@ -208,6 +243,18 @@ void Text_dump_writer::store_field(const mysqlshdk::db::IRow *row,
       const auto end = data + length;
 
       for (auto p = data; p != end; ++p) {
+        // copy the bytes which don't need to be escaped in one go, unused
+        // entries of m_escaped_characters are zeroed
+        const auto next =
+            encoder::find_escape_candidate(p, end, m_escaped_characters);
+        buffer()->append(p, next - p);
+
+        if (next == end) {
+          break;
+        }
+
+        p = next;
+
         const auto c = *p;
         char to_write = 0;
         char escape = m_escape_char;
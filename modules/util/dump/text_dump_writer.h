@@ -29,12 +29,13 @@
 #include <vector>
 
 #include "modules/util/dump/dump_writer.h"
+#include "modules/util/dump/encoder.h"
 #include "modules/util/import_table/dialect.h"
 
 namespace mysqlsh {
 namespace dump {
 
-class Text_dump_writer : public Dump_writer {
+class Text_dump_writer final : public Dump_writer {
  public:
   Text_dump_writer() = default;
   explicit Text_dump_writer(const import_table::Dialect &dialect);
@@ -77,7 +78,7 @@ class Text_dump_writer : public Dump_writer {
 
   bool m_escape;
 
-  char m_escaped_characters[4];
+  char m_escaped_characters[encoder::k_escaped_characters];
 
   char m_escape_char;
 
@@ -95,6 +96,11 @@ class Text_dump_writer : public Dump_writer {
   std::vector<int> m_is_number_type;
 
   std::vector<Escape_type> m_needs_escape;
+
+  // columns which are encoded before being escaped
+  std::vector<Encoding_type> m_encoding;
+
+  std::string m_encoded;
 };
 
 }  // namespace dump
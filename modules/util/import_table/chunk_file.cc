@@ -25,6 +25,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <exception>
+#include <vector>
 
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
@@ -145,6 +147,49 @@ void File_iterator::force_offset(size_t start_from_offset) {
   }
 }
 
+bool File_iterator::scan(Row_scanner *scanner) {
+  assert(scanner);
+
+  while (m_offset < m_file_size) {
+    const auto first = reinterpret_cast<const char *>(m_ptr);
+    const auto last = reinterpret_cast<const char *>(m_ptr_end);
+    // reserved area is used only to match the terminator which starts before
+    // the end of the buffer
+    const auto limit = reinterpret_cast<const char *>(m_current->end());
+    const auto found = scanner->find(first, last, limit);
+
+    advance((found ? found : last) - first);
+
+    if (found) return true;
+  }
+
+  return false;
+}
+
+void File_iterator::advance(size_t bytes) {
+  m_offset += bytes;
+  m_ptr += bytes;
+
+  assert(m_ptr <= m_current->end());
+
+  if (m_ptr >= m_ptr_end && m_offset < m_file_size) {
+    // terminator could end in the reserved area, move to the same position in
+    // the next buffer
+    const auto overshoot = m_ptr - m_ptr_end;
+
+    m_offset -= overshoot;
+    await_next();
+    swap();
+
+    if (!m_eof) {
+      read_next(m_offset + m_current->size() - m_current->reserved);
+    }
+
+    m_offset += overshoot;
+    m_ptr += overshoot;
+  }
+}
+
 File_handler::File_handler(mysqlshdk::storage::IFile *fh) : m_fh(fh) {
   m_fh->open(mysqlshdk::storage::Mode::READ);
   m_file_size = m_fh->file_size();
@@ -195,32 +240,123 @@ void Chunk_file::set_chunk_size(const size_t bytes) {
 }
 
 void Chunk_file::start() {
-  File_handler fh{m_file_handle};
-
   const size_t needle_size = m_dialect.lines_terminated_by.size();
-  auto first = fh.begin(needle_size);
-  auto last = fh.end(needle_size);
 
   File_import_info stencil;
   stencil.file_path = m_file_handle->full_path().real();
   stencil.range_read = true;
   stencil.is_guard = false;
 
-  if (m_dialect.fields_escaped_by.empty()) {
+  size_t first_row = 0;
+  size_t file_size = 0;
+
+  {
+    File_handler fh{m_file_handle};
+
+    auto first = fh.begin(needle_size);
+    auto last = fh.end(needle_size);
+
     if (m_skip_rows_count > 0) {
-      first = skip_rows(first, last, m_dialect.lines_terminated_by,
-                        m_skip_rows_count);
+      if (m_dialect.fields_escaped_by.empty()) {
+        first = skip_rows(first, last, m_dialect.lines_terminated_by,
+                          m_skip_rows_count);
+      } else {
+        first = skip_rows(first, last, m_dialect.lines_terminated_by,
+                          m_skip_rows_count, m_dialect.fields_escaped_by[0]);
+      }
     }
-    chunk_by_max_bytes(first, last, m_dialect.lines_terminated_by, m_chunk_size,
-                       m_queue, stencil);
-  } else {
-    if (m_skip_rows_count > 0) {
-      first = skip_rows(first, last, m_dialect.lines_terminated_by,
-                        m_skip_rows_count, m_dialect.fields_escaped_by[0]);
+
+    first_row = first.offset();
+    file_size = fh.size();
+
+    const auto chunks = (file_size - first_row) / m_chunk_size;
+
+    if (m_threads <= 1 || !m_file_handle_factory || chunks < 2) {
+      if (m_dialect.fields_escaped_by.empty()) {
+        chunk_by_max_bytes(first, last, m_dialect.lines_terminated_by,
+                           m_chunk_size, m_queue, stencil);
+      } else {
+        chunk_by_max_bytes(first, last, m_dialect.lines_terminated_by,
+                           m_dialect.fields_escaped_by[0], m_chunk_size,
+                           m_queue, stencil);
+      }
+
+      return;
+    }
+  }
+
+  // split the file into ranges, each thread resynchronises to the next row
+  // boundary and emits the chunks as soon as they are found, range ends are
+  // found using the same rules, so the chunks of the neighbouring ranges are
+  // contiguous
+  const auto ranges =
+      std::min<size_t>(m_threads, (file_size - first_row) / m_chunk_size);
+  const auto range_size = (file_size - first_row) / ranges;
+
+  std::vector<std::thread> threads;
+  std::vector<std::exception_ptr> exceptions(ranges);
+
+  for (size_t i = 0; i < ranges; ++i) {
+    const auto begin = first_row + i * range_size;
+    const auto end = i + 1 == ranges ? file_size : begin + range_size;
+
+    threads.emplace_back(mysqlsh::spawn_scoped_thread(
+        [this, i, begin, end, &stencil, &exceptions]() {
+          try {
+            const auto file = m_file_handle_factory();
+            chunk_range(file.get(), begin, end, 0 == i, stencil);
+          } catch (...) {
+            exceptions[i] = std::current_exception();
+          }
+        }));
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (const auto &exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
     }
-    chunk_by_max_bytes(first, last, m_dialect.lines_terminated_by,
-                       m_dialect.fields_escaped_by[0], m_chunk_size, m_queue,
-                       stencil);
+  }
+}
+
+void Chunk_file::chunk_range(mysqlshdk::storage::IFile *file, size_t begin,
+                             size_t end, bool begin_is_row_start,
+                             const File_import_info &stencil) {
+  File_handler fh{file};
+
+  const size_t needle_size = m_dialect.lines_terminated_by.size();
+  auto first = fh.begin(needle_size);
+
+  const auto row_boundary = [&](size_t offset) -> size_t {
+    if (offset >= fh.size()) {
+      return fh.size();
+    }
+
+    if (m_dialect.fields_escaped_by.empty()) {
+      return find_row_boundary(&first, offset, m_dialect.lines_terminated_by);
+    } else {
+      return find_row_boundary(&first, offset, m_dialect.lines_terminated_by,
+                               m_dialect.fields_escaped_by[0]);
+    }
+  };
+
+  // end of this range is the beginning of the next one
+  const auto range_end = row_boundary(end);
+  auto chunk_begin = begin_is_row_start ? begin : row_boundary(begin);
+
+  while (chunk_begin < range_end) {
+    const auto next = chunk_begin + m_chunk_size;
+    const auto chunk_end =
+        next >= range_end ? range_end : std::min(row_boundary(next), range_end);
+
+    File_import_info info = stencil;
+    info.range = std::make_pair(chunk_begin, chunk_end);
+    m_queue->push(std::move(info));
+
+    chunk_begin = chunk_end;
   }
 }
 
@@ -27,6 +27,7 @@
 #include <atomic>
 #include <cassert>
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -35,6 +36,7 @@
 
 #include "modules/util/import_table/dialect.h"
 #include "modules/util/import_table/helpers.h"
+#include "modules/util/import_table/scanner.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 
@@ -168,6 +170,17 @@ class File_iterator final {
    */
   void force_offset(size_t start_from_offset);
 
+  /**
+   * Moves the iterator past the next line terminator found by the scanner,
+   * scanning whole buffers at once.
+   *
+   * @param scanner Scanner used to find the line terminator.
+   *
+   * @return true if line terminator was found, false if end of file was
+   * reached.
+   */
+  bool scan(Row_scanner *scanner);
+
   ~File_iterator() = default;
 
  private:
@@ -189,6 +202,12 @@ class File_iterator final {
    */
   void read_next(size_t offset);
 
+  /**
+   * Advances the iterator by the given number of bytes, which cannot go past
+   * the reserved area of the current buffer.
+   */
+  void advance(size_t bytes);
+
   /**
    * Wait for currently enqueued task finish work. After this call next buffer
    * is valid to read.
@@ -400,6 +419,52 @@ Iter skip_rows(Iter first, Iter last, const std::string &needle,
   return first;
 }
 
+/**
+ * Moves the iterator to the first row which ends at or after the given offset,
+ * and then past its (unescaped) line terminator.
+ *
+ * @tparam Iter Forward iterator.
+ * @param first Iterator which is going to be moved.
+ * @param offset File offset where the search starts.
+ * @param needle Line terminator string.
+ * @param escape_char Escape character.
+ * @return Offset of the beginning of the next row.
+ */
+template <typename Iter>
+size_t find_row_boundary(Iter *first, size_t offset,
+                         const std::string &needle, char escape_char) {
+  first->force_offset(offset);
+
+  // escape state at the given offset is unknown
+  Row_scanner scanner{needle, std::string(1, escape_char), false};
+  first->scan(&scanner);
+
+  return first->offset();
+}
+
+/**
+ * Moves the iterator to the first row which ends at or after the given offset,
+ * and then past its line terminator.
+ *
+ * @tparam Iter Forward iterator.
+ * @param first Iterator which is going to be moved.
+ * @param offset File offset where the search starts.
+ * @param needle Line terminator string.
+ * @return Offset of the beginning of the next row.
+ */
+template <typename Iter>
+size_t find_row_boundary(Iter *first, size_t offset,
+                         const std::string &needle) {
+  first->force_offset(offset);
+
+  // terminator found right at the given offset could be a part of the
+  // previous row, it's ignored
+  Row_scanner scanner{needle, {}, false};
+  first->scan(&scanner);
+
+  return first->offset();
+}
+
 /**
  * Fill QueueContainer with file chunks offset that are roughly
  * max_bytes_per_chunk in size.
@@ -425,27 +490,10 @@ void chunk_by_max_bytes(Iter first, Iter last, const std::string &needle,
 
   while (first != last) {
     const size_t prev_offset = current_offset;
-    const size_t next_offset = current_offset + max_bytes_per_chunk;
-    first.force_offset(next_offset);
-    Find_context<typename Iter::value_type> context{};
-
-    first = find(first, last, needle.begin(), needle.end(), &context);
+    current_offset =
+        find_row_boundary(&first, current_offset + max_bytes_per_chunk, needle,
+                          escape_char);
 
-    // needle found, but is escaped or escape state is unknown
-    auto escaped = [&]() -> bool {
-      return context.needle_found &&
-             ((context.preceding_element_set &&
-               context.preceding_element == escape_char) ||
-              (!context.preceding_element_set));
-    };
-
-    while (escaped()) {
-      context.preceding_element_set = true;
-      context.preceding_element = context.last_element;
-      first = find(first, last, needle.begin(), needle.end(), &context);
-    }
-
-    current_offset = first.offset();
     File_import_info info = stencil;
     info.range = std::make_pair(prev_offset, current_offset);
     range_queue->push(std::move(info));
@@ -475,23 +523,10 @@ void chunk_by_max_bytes(Iter first, Iter last, const std::string &needle,
   size_t current_offset = first.offset();
 
   while (first != last) {
-    size_t prev_offset = current_offset;
-    const size_t next_offset = current_offset + max_bytes_per_chunk;
-    first.force_offset(next_offset);
-    Find_context<typename Iter::value_type> context{};
-
-    first = find(first, last, needle.begin(), needle.end(), &context);
-
-    // needle found, but escape state is unknown
-    auto escaped = [&]() -> bool {
-      return context.needle_found && !context.preceding_element_set;
-    };
-
-    while (escaped()) {
-      first = find(first, last, needle.begin(), needle.end(), &context);
-    }
+    const size_t prev_offset = current_offset;
+    current_offset =
+        find_row_boundary(&first, current_offset + max_bytes_per_chunk, needle);
 
-    current_offset = first.offset();
     File_import_info info = stencil;
     info.range = std::make_pair(prev_offset, current_offset);
     range_queue->push(std::move(info));
@@ -516,14 +551,42 @@ class Chunk_file final {
   void set_output_queue(shcore::Synchronized_queue<File_import_info> *queue) {
     m_queue = queue;
   }
+
+  /**
+   * Sets the number of threads used to find the chunk boundaries. If more than
+   * one thread is used, file handle factory needs to be set as well.
+   */
+  void set_threads(const size_t threads) { m_threads = threads; }
+
+  /**
+   * Sets the function used to create the additional handles to the file being
+   * chunked, each thread needs its own handle.
+   */
+  void set_file_handle_factory(
+      std::function<std::unique_ptr<mysqlshdk::storage::IFile>()> factory) {
+    m_file_handle_factory = std::move(factory);
+  }
+
   void start();
 
  private:
+  /**
+   * Chunks the rows which end within the given range of bytes. The first row
+   * is expected to start at the beginning of the range if begin_is_row_start
+   * is set, otherwise chunking starts from the first row which ends after the
+   * beginning of the range.
+   */
+  void chunk_range(mysqlshdk::storage::IFile *file, size_t begin, size_t end,
+                   bool begin_is_row_start, const File_import_info &stencil);
+
   size_t m_chunk_size = 2 * BUFFER_SIZE;
   Dialect m_dialect;
   uint64_t m_skip_rows_count = 0;
   shcore::Synchronized_queue<File_import_info> *m_queue = nullptr;
   mysqlshdk::storage::IFile *m_file_handle;
+  size_t m_threads = 1;
+  std::function<std::unique_ptr<mysqlshdk::storage::IFile>()>
+      m_file_handle_factory;
 };
 
 }  // namespace import_table
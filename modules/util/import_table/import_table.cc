@@ -115,6 +115,10 @@ void Import_table::chunk_file() {
   chunk.set_dialect(m_opt.dialect());
   chunk.set_rows_to_skip(m_opt.skip_rows_count());
   chunk.set_output_queue(&m_range_queue);
+  chunk.set_threads(m_opt.threads_size());
+  chunk.set_file_handle_factory([this]() {
+    return m_opt.create_file_handle(m_opt.filelist_from_user()[0]);
+  });
   chunk.start();
 
   m_range_queue.shutdown(m_opt.threads_size());
@@ -181,8 +185,9 @@ void Import_table::import() {
   if (m_opt.is_multifile()) {
     build_queue();
   } else {
-    if (m_opt.is_compressed(m_opt.filelist_from_user()[0])) {
-      // cannot chunk compressed files
+    if (m_opt.is_compressed(m_opt.filelist_from_user()[0]) &&
+        !m_opt.is_file_seekable()) {
+      // cannot chunk compressed files, unless they are seekable
       build_queue();
     } else {
       chunk_file();
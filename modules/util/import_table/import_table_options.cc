@@ -37,6 +37,7 @@
 #include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
@@ -222,7 +223,8 @@ bool Import_table_option_pack::is_compressed(const std::string &path) const {
   const auto extension = std::get<1>(shcore::path::split_extension(path));
 
   return extension == get_extension(Compression::GZIP) ||
-         extension == get_extension(Compression::ZSTD);
+         extension == get_extension(Compression::ZSTD) ||
+         extension == get_extension(Compression::LZ4);
 }
 
 Import_table_options::Import_table_options(
@@ -285,6 +287,13 @@ void Import_table_options::validate() {
       m_file_handle = create_file_handle(m_filelist_from_user[0]);
       m_file_handle->open(mysqlshdk::storage::Mode::READ);
       m_file_size = m_file_handle->file_size();
+
+      if (const auto compressed =
+              dynamic_cast<mysqlshdk::storage::Compressed_file *>(
+                  m_file_handle.get())) {
+        m_file_seekable = compressed->is_seekable();
+      }
+
       m_file_handle->close();
     }
   }
@@ -308,7 +317,15 @@ Import_table_option_pack::create_file_handle(
   } catch (...) {
     compr = mysqlshdk::storage::Compression::NONE;
   }
-  return mysqlshdk::storage::make_file(std::move(file_handler), compr);
+  auto file = mysqlshdk::storage::make_file(std::move(file_handler), compr);
+
+  if (mysqlshdk::storage::Compression::ZSTD == compr && !is_multifile()) {
+    // seekable zstd file can be chunked
+    static_cast<mysqlshdk::storage::compression::Zstd_file *>(file.get())
+        ->load_seek_table();
+  }
+
+  return file;
 }
 
 size_t Import_table_option_pack::calc_thread_size() {
@@ -316,9 +333,9 @@ size_t Import_table_option_pack::calc_thread_size() {
   int64_t threads_size = std::max(static_cast<int64_t>(1), m_threads_size);
 
   if (!is_multifile()) {
-    if (is_compressed(m_filelist_from_user[0])) {
-      // a single compressed file cannot be chunked, we're going to use a single
-      // thread
+    if (is_compressed(m_filelist_from_user[0]) && !m_file_seekable) {
+      // a single compressed file cannot be chunked (unless it's seekable),
+      // we're going to use a single thread
       threads_size = 1;
     } else {
       // We do not need to spawn more threads than file chunks
@@ -112,6 +112,11 @@ class Import_table_option_pack {
 
   size_t file_size() const { return m_file_size; }
 
+  /**
+   * Whether the single compressed file can be chunked.
+   */
+  bool is_file_seekable() const { return m_file_seekable; }
+
   uint64_t bytes_per_chunk() const;
 
   size_t max_transaction_size() const;
@@ -148,6 +153,7 @@ class Import_table_option_pack {
 
   std::vector<std::string> m_filelist_from_user;
   size_t m_file_size;
+  bool m_file_seekable = false;
   std::string m_table;
   std::string m_schema;
   std::string m_partition;
@@ -42,6 +42,8 @@ using off64_t = off_t;
 #include <memory>
 #include <utility>
 #include "modules/util/import_table/helpers.h"
+#include "modules/util/import_table/prefetching_file.h"
+#include "modules/util/import_table/scanner.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/include/shellcore/shell_init.h"
@@ -72,6 +74,19 @@ int local_infile_error_nop(void * /* userdata */, char * /* error_msg */,
   return CR_LOAD_DATA_LOCAL_INFILE_REJECTED;
 }
 
+/**
+ * Compressed files are decompressed ahead of LOAD DATA in a background thread,
+ * so that the server does not have to wait for the data to be decompressed.
+ */
+std::unique_ptr<mysqlshdk::storage::IFile> prefetch(
+    std::unique_ptr<mysqlshdk::storage::IFile> file) {
+  if (file && file->is_compressed()) {
+    return std::make_unique<Prefetching_file>(std::move(file));
+  }
+
+  return file;
+}
+
 }  // namespace
 
 Transaction_buffer::Transaction_buffer(Dialect dialect,
@@ -329,11 +344,13 @@ uint64_t Transaction_buffer::find_first_row_boundary_after_impl_default()
   assert(m_dialect == Dialect::default_());
 
   const char needle = m_dialect.lines_terminated_by[0];
-  const auto p = m_data.find(needle);
+  const auto begin = m_data.data();
+  const auto end = begin + m_data.length();
+  const auto p = scanner::find(begin, end, needle);
 
-  if (p >= m_data.length()) return 0;
+  if (p == end) return 0;
 
-  return p + 1;
+  return p - begin + 1;
 }
 
 uint64_t Transaction_buffer::find_last_row_boundary_before_impl_default(
@@ -347,11 +364,14 @@ uint64_t Transaction_buffer::find_last_row_boundary_before_impl_default(
   if (p == 0) return 0;
 
   p = adjust_line_offset(p);
-  p = m_data.rfind(needle, p);
 
-  if (p >= m_data.length()) return 0;
+  const auto begin = m_data.data();
+  const auto r =
+      scanner::rfind(begin, begin + std::min(p + 1, m_data.length()), needle);
+
+  if (!r) return 0;
 
-  return p + 1;
+  return r - begin + 1;
 }
 
 uint64_t Transaction_buffer::find_first_row_boundary_after_impl_no_escape()
@@ -359,12 +379,14 @@ uint64_t Transaction_buffer::find_first_row_boundary_after_impl_no_escape()
   assert(m_dialect.lines_terminated_by.size());
   assert(!m_dialect.fields_escaped_by.size());
 
-  const auto &needle = m_dialect.lines_terminated_by;
-  const auto p = m_data.find(needle);
+  const auto begin = m_data.data();
+  const auto end = begin + m_data.length();
+  const auto r = Row_scanner(m_dialect.lines_terminated_by, {}, true)
+                     .find(begin, end, end);
 
-  if (p >= m_data.length()) return 0;
+  if (!r) return 0;
 
-  return p + needle.size();
+  return r - begin;
 }
 
 uint64_t Transaction_buffer::find_last_row_boundary_before_impl_no_escape(
@@ -378,32 +400,23 @@ uint64_t Transaction_buffer::find_last_row_boundary_before_impl_no_escape(
 
   if (p < needle.size()) return 0;
 
-  p = adjust_line_offset(p);
-  p = m_data.rfind(needle, p);
-
-  if (p >= m_data.length()) return 0;
-
-  return p + needle.size();
+  return find_last_row_boundary_at(adjust_line_offset(p));
 }
 
 uint64_t Transaction_buffer::find_first_row_boundary_after_impl_escape() const {
   assert(m_dialect.lines_terminated_by.size());
   assert(m_dialect.fields_escaped_by.size());
 
-  const auto &needle = m_dialect.lines_terminated_by;
-  auto p = m_data.find(needle);
+  const auto begin = m_data.data();
+  const auto end = begin + m_data.length();
+  // buffer always starts at the beginning of a row
+  const auto r = Row_scanner(m_dialect.lines_terminated_by,
+                             m_dialect.fields_escaped_by, true)
+                     .find(begin, end, end);
 
-  while (p != std::string::npos) {
-    if (!(p > 0 && m_data[p - 1] == m_dialect.fields_escaped_by[0])) {
-      assert(p < m_data.length());
-      return p + needle.size();
-    }
-
-    p += needle.size();
-    p = m_data.find(needle, p);
-  }
+  if (!r) return 0;
 
-  return 0;
+  return r - begin;
 }
 
 uint64_t Transaction_buffer::find_last_row_boundary_before_impl_escape(
@@ -417,24 +430,21 @@ uint64_t Transaction_buffer::find_last_row_boundary_before_impl_escape(
 
   if (p < needle.size()) return 0;
 
-  p = adjust_line_offset(p);
-  p = m_data.rfind(needle, p);
+  return find_last_row_boundary_at(adjust_line_offset(p));
+}
 
-  while (p != std::string::npos) {
-    if (!(p > 0 && m_data[p - 1] == m_dialect.fields_escaped_by[0])) {
-      assert(p < m_data.length());
-      return p + needle.size();
-    }
+uint64_t Transaction_buffer::find_last_row_boundary_at(uint64_t offset) const {
+  if (m_data.empty()) return 0;
 
-    if (p < needle.size()) {
-      break;
-    }
+  const auto begin = m_data.data();
+  const auto end = begin + m_data.length();
+  const auto r = scanner::rfind_row_end(
+      begin, begin + std::min<uint64_t>(offset, m_data.length() - 1), end,
+      m_dialect.lines_terminated_by, m_dialect.fields_escaped_by);
 
-    p -= needle.size();
-    p = m_data.rfind(needle, p);
-  }
+  if (!r) return 0;
 
-  return 0;
+  return r - begin;
 }
 
 uint64_t Transaction_buffer::adjust_line_offset(uint64_t offset) {
@@ -799,6 +809,9 @@ void Load_data_worker::execute(
               // single uncompressed file, rows were already skipped
               query_ignore_lines.clear();
             } else {
+              // ranges are not prefetched, data past the end of a range would
+              // be decompressed in vain
+              fi.filehandler = prefetch(std::move(fi.filehandler));
               fi.bytes_left = 0;
               max_trx_size = m_opt.max_transaction_size();
 
@@ -817,7 +830,7 @@ void Load_data_worker::execute(
           }
         } else {
           if (file != nullptr) {
-            fi.filehandler = std::move(file);
+            fi.filehandler = prefetch(std::move(file));
             file.reset(nullptr);
             fi.buffer = Transaction_buffer(m_opt.dialect(),
                                            fi.filehandler.get(), options);
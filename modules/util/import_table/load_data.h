@@ -99,6 +99,8 @@ class Transaction_buffer {
   uint64_t find_first_row_boundary_after_impl_escape() const;
   uint64_t find_last_row_boundary_before_impl_escape(uint64_t limit);
 
+  uint64_t find_last_row_boundary_at(uint64_t offset) const;
+
   uint64_t adjust_line_offset(uint64_t offset);
 
   void set_trx_end_offset(uint64_t end) { m_trx_end_offset = m_trx_size + end; }
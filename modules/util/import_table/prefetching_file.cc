@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/prefetching_file.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+Prefetching_file::Prefetching_file(
+    std::unique_ptr<mysqlshdk::storage::IFile> file, size_t buffer_size,
+    size_t buffer_count)
+    : Compressed_file(std::move(file)), m_buffers(buffer_count) {
+  assert(buffer_size > 0);
+  assert(buffer_count > 0);
+
+  for (auto &b : m_buffers) {
+    b.data.resize(buffer_size);
+  }
+}
+
+Prefetching_file::~Prefetching_file() {
+  try {
+    stop();
+  } catch (const std::exception &e) {
+    log_error("Failed to stop the prefetching thread: %s", e.what());
+  }
+}
+
+void Prefetching_file::open(mysqlshdk::storage::Mode m) {
+  if (mysqlshdk::storage::Mode::READ != m) {
+    throw std::invalid_argument("Prefetching_file supports only reading");
+  }
+
+  Compressed_file::open(m);
+  m_offset = 0;
+}
+
+void Prefetching_file::close() {
+  stop();
+  Compressed_file::close();
+}
+
+off64_t Prefetching_file::seek(off64_t offset) {
+  if (m_thread.joinable()) {
+    throw std::logic_error(
+        "Prefetching_file::seek() - not supported once reading has started");
+  }
+
+  const auto result = file()->seek(offset);
+  m_offset = file()->tell();
+  return result;
+}
+
+ssize_t Prefetching_file::read(void *buffer, size_t length) {
+  if (!m_thread.joinable()) {
+    start();
+  }
+
+  const auto out = static_cast<char *>(buffer);
+  size_t offset = 0;
+
+  start_io();
+
+  while (offset < length) {
+    if (!m_current || m_current_offset == m_current->size) {
+      if (!next_buffer()) {
+        // data which was read before an error is returned first, error is
+        // reported by the next call
+        if (0 == offset && m_error) {
+          std::rethrow_exception(m_error);
+        }
+
+        break;
+      }
+
+      // compressed bytes are reported once the buffer is used for the first
+      // time
+      update_io(m_current->file_bytes);
+    }
+
+    const auto bytes =
+        std::min(length - offset, m_current->size - m_current_offset);
+
+    ::memcpy(out + offset, m_current->data.data() + m_current_offset, bytes);
+
+    m_current_offset += bytes;
+    offset += bytes;
+  }
+
+  finish_io();
+
+  m_offset += offset;
+
+  return offset;
+}
+
+void Prefetching_file::start() {
+  assert(!m_thread.joinable());
+
+  m_read_index = 0;
+  m_write_index = 0;
+  m_filled = 0;
+  m_eof = false;
+  m_stop = false;
+  m_error = nullptr;
+  m_current = nullptr;
+  m_current_offset = 0;
+
+  m_thread = mysqlsh::spawn_scoped_thread([this]() { prefetch(); });
+}
+
+void Prefetching_file::stop() {
+  if (!m_thread.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+
+  m_buffer_released.notify_one();
+  m_thread.join();
+
+  m_current = nullptr;
+}
+
+void Prefetching_file::prefetch() {
+  try {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_buffer_released.wait(
+            lock, [this]() { return m_stop || m_filled < m_buffers.size(); });
+
+        if (m_stop) {
+          return;
+        }
+      }
+
+      // this buffer is not used by the consumer, it's safe to write to it
+      // without holding the lock
+      auto &buffer = m_buffers[m_write_index];
+
+      fill(&buffer);
+
+      const auto eof = buffer.size < buffer.data.size();
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (buffer.size > 0) {
+          ++m_filled;
+          m_write_index = (m_write_index + 1) % m_buffers.size();
+        }
+
+        m_eof = eof;
+      }
+
+      m_buffer_filled.notify_one();
+
+      if (eof) {
+        return;
+      }
+    }
+  } catch (...) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_error = std::current_exception();
+    }
+
+    m_buffer_filled.notify_one();
+  }
+}
+
+void Prefetching_file::fill(Buffer *buffer) {
+  const auto compressed = dynamic_cast<Compressed_file *>(file());
+  const auto capacity = buffer->data.size();
+
+  buffer->size = 0;
+  buffer->file_bytes = 0;
+
+  while (buffer->size < capacity) {
+    const auto bytes =
+        file()->read(buffer->data.data() + buffer->size, capacity - buffer->size);
+
+    if (bytes < 0) {
+      throw std::runtime_error("Failed to read data from " +
+                               file()->full_path().masked());
+    }
+
+    if (0 == bytes) {
+      break;
+    }
+
+    buffer->size += bytes;
+    buffer->file_bytes += compressed ? compressed->latest_io_size() : bytes;
+  }
+}
+
+bool Prefetching_file::next_buffer() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  if (m_current) {
+    // release the buffer which was fully consumed
+    m_current = nullptr;
+    m_current_offset = 0;
+    m_read_index = (m_read_index + 1) % m_buffers.size();
+    --m_filled;
+
+    m_buffer_released.notify_one();
+  }
+
+  m_buffer_filled.wait(lock,
+                       [this]() { return m_filled > 0 || m_eof || m_error; });
+
+  if (m_filled > 0) {
+    m_current = &m_buffers[m_read_index];
+    return true;
+  }
+
+  return false;
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_PREFETCHING_FILE_H_
+#define MODULES_UTIL_IMPORT_TABLE_PREFETCHING_FILE_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+/**
+ * Wraps a compressed file, reading and decompressing it in a background thread.
+ * Decompressed data is stored in a ring of buffers, ahead of the consumer, so
+ * that the decompression overlaps with sending the data to the server.
+ *
+ * Only reading is supported. seek() is allowed only before the first read().
+ */
+class Prefetching_file final : public mysqlshdk::storage::Compressed_file {
+ public:
+  static constexpr size_t k_default_buffer_size = 1024 * 1024;
+  static constexpr size_t k_default_buffer_count = 4;
+
+  Prefetching_file() = delete;
+
+  explicit Prefetching_file(std::unique_ptr<mysqlshdk::storage::IFile> file,
+                            size_t buffer_size = k_default_buffer_size,
+                            size_t buffer_count = k_default_buffer_count);
+
+  Prefetching_file(const Prefetching_file &other) = delete;
+  Prefetching_file(Prefetching_file &&other) = delete;
+
+  Prefetching_file &operator=(const Prefetching_file &other) = delete;
+  Prefetching_file &operator=(Prefetching_file &&other) = delete;
+
+  ~Prefetching_file() override;
+
+  void open(mysqlshdk::storage::Mode m) override;
+  void close() override;
+
+  off64_t seek(off64_t offset) override;
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override;
+
+  ssize_t write(const void *, size_t) override {
+    throw std::logic_error("Prefetching_file::write() - not supported");
+  }
+
+ private:
+  struct Buffer {
+    std::vector<char> data;
+    // number of bytes of decompressed data
+    size_t size = 0;
+    // number of bytes read from the underlying file to produce the data
+    size_t file_bytes = 0;
+  };
+
+  void start();
+
+  void stop();
+
+  void prefetch();
+
+  void fill(Buffer *buffer);
+
+  /**
+   * Waits for the next buffer filled by the background thread.
+   *
+   * @returns false if there are no more buffers, either because the end of
+   *          file was reached or because an error has occurred.
+   */
+  bool next_buffer();
+
+  std::vector<Buffer> m_buffers;
+
+  // protects all the fields below
+  std::mutex m_mutex;
+  std::condition_variable m_buffer_filled;
+  std::condition_variable m_buffer_released;
+  // index of the buffer being read by the consumer
+  size_t m_read_index = 0;
+  // index of the next buffer to be filled by the background thread
+  size_t m_write_index = 0;
+  // number of buffers which were filled, but not released by the consumer
+  size_t m_filled = 0;
+  bool m_eof = false;
+  bool m_stop = false;
+  std::exception_ptr m_error;
+
+  std::thread m_thread;
+
+  // consumer state
+  const Buffer *m_current = nullptr;
+  size_t m_current_offset = 0;
+  off64_t m_offset = 0;
+};
+
+}  // namespace import_table
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_PREFETCHING_FILE_H_
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/scanner.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif  // _MSC_VER
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SCANNER_HAVE_SSE2
+#include <emmintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SCANNER_HAVE_AVX2
+#include <immintrin.h>
+#define SCANNER_TARGET_AVX2 __attribute__((target("avx2")))
+#endif  // __GNUC__ || __clang__
+#endif  // __x86_64__ || _M_X64
+
+namespace mysqlsh {
+namespace import_table {
+namespace scanner {
+
+namespace {
+
+#if defined(_MSC_VER)
+inline int count_trailing_zeros(uint64_t v) {
+  unsigned long index;
+  _BitScanForward64(&index, v);
+  return static_cast<int>(index);
+}
+
+inline int count_leading_zeros(uint32_t v) {
+  unsigned long index;
+  _BitScanReverse(&index, v);
+  return 31 - static_cast<int>(index);
+}
+#else   // !_MSC_VER
+inline int count_trailing_zeros(uint64_t v) { return __builtin_ctzll(v); }
+
+inline int count_leading_zeros(uint32_t v) { return __builtin_clz(v); }
+#endif  // !_MSC_VER
+
+#ifndef SCANNER_HAVE_SSE2
+
+uint64_t classify_scalar(const char *block, char c1, char c2,
+                         uint64_t *c2_mask) {
+  uint64_t m1 = 0;
+  uint64_t m2 = 0;
+
+  for (int i = 0; i < k_block_size; ++i) {
+    m1 |= static_cast<uint64_t>(block[i] == c1) << i;
+    m2 |= static_cast<uint64_t>(block[i] == c2) << i;
+  }
+
+  *c2_mask = m2;
+  return m1;
+}
+
+#endif  // !SCANNER_HAVE_SSE2
+
+const char *rfind_scalar(const char *first, const char *last, char c) {
+  while (last > first) {
+    if (*--last == c) return last;
+  }
+
+  return nullptr;
+}
+
+#ifdef SCANNER_HAVE_SSE2
+
+uint64_t classify_sse2(const char *block, char c1, char c2,
+                       uint64_t *c2_mask) {
+  const auto v1 = _mm_set1_epi8(c1);
+  const auto v2 = _mm_set1_epi8(c2);
+  uint64_t m1 = 0;
+  uint64_t m2 = 0;
+
+  for (int i = 0; i < k_block_size; i += 16) {
+    const auto data =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + i));
+
+    m1 |= static_cast<uint64_t>(static_cast<uint32_t>(
+              _mm_movemask_epi8(_mm_cmpeq_epi8(data, v1))))
+          << i;
+    m2 |= static_cast<uint64_t>(static_cast<uint32_t>(
+              _mm_movemask_epi8(_mm_cmpeq_epi8(data, v2))))
+          << i;
+  }
+
+  *c2_mask = m2;
+  return m1;
+}
+
+const char *rfind_sse2(const char *first, const char *last, char c) {
+  const auto v = _mm_set1_epi8(c);
+
+  for (; last - first >= 16; last -= 16) {
+    const auto data =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(last - 16));
+    const auto mask =
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(data, v)));
+
+    if (mask) return last - 1 - (count_leading_zeros(mask) - 16);
+  }
+
+  return rfind_scalar(first, last, c);
+}
+
+#endif  // SCANNER_HAVE_SSE2
+
+#ifdef SCANNER_HAVE_AVX2
+
+SCANNER_TARGET_AVX2
+uint64_t classify_avx2(const char *block, char c1, char c2,
+                       uint64_t *c2_mask) {
+  const auto v1 = _mm256_set1_epi8(c1);
+  const auto v2 = _mm256_set1_epi8(c2);
+  const auto lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+  const auto hi =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + 32));
+
+  const auto mask = [](__m256i l, __m256i h) SCANNER_TARGET_AVX2 {
+    return static_cast<uint64_t>(
+               static_cast<uint32_t>(_mm256_movemask_epi8(l))) |
+           static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(h)))
+               << 32;
+  };
+
+  *c2_mask = mask(_mm256_cmpeq_epi8(lo, v2), _mm256_cmpeq_epi8(hi, v2));
+  return mask(_mm256_cmpeq_epi8(lo, v1), _mm256_cmpeq_epi8(hi, v1));
+}
+
+SCANNER_TARGET_AVX2
+const char *rfind_avx2(const char *first, const char *last, char c) {
+  const auto v = _mm256_set1_epi8(c);
+
+  for (; last - first >= 32; last -= 32) {
+    const auto data =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(last - 32));
+    const auto mask = static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(data, v)));
+
+    if (mask) return last - 1 - count_leading_zeros(mask);
+  }
+
+  return rfind_sse2(first, last, c);
+}
+
+#endif  // SCANNER_HAVE_AVX2
+
+struct Implementation {
+  const char *name;
+  uint64_t (*classify)(const char *, char, char, uint64_t *);
+  const char *(*rfind)(const char *, const char *, char);
+};
+
+Implementation select_implementation() {
+#ifdef SCANNER_HAVE_AVX2
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx2")) {
+    return {"avx2", classify_avx2, rfind_avx2};
+  }
+#endif  // SCANNER_HAVE_AVX2
+
+#ifdef SCANNER_HAVE_SSE2
+  return {"sse2", classify_sse2, rfind_sse2};
+#else   // !SCANNER_HAVE_SSE2
+  return {"scalar", classify_scalar, rfind_scalar};
+#endif  // !SCANNER_HAVE_SSE2
+}
+
+const Implementation &implementation_impl() {
+  static const Implementation s_impl = select_implementation();
+  return s_impl;
+}
+
+}  // namespace
+
+const char *find(const char *first, const char *last, char c) {
+  // memchr() is already vectorised by the C library
+  const auto p = first < last ? ::memchr(first, c, last - first) : nullptr;
+  return p ? static_cast<const char *>(p) : last;
+}
+
+uint64_t classify(const char *block, char c1, char c2, uint64_t *c2_mask) {
+  return implementation_impl().classify(block, c1, c2, c2_mask);
+}
+
+uint64_t escaped_mask(uint64_t escapes, bool *escaped) {
+  // same algorithm as used by simdjson: a sequence of escape characters of odd
+  // length escapes the character which follows it; adding the start bits of
+  // the sequences which begin at odd positions to the escape mask flips the
+  // parity of their end positions, which allows to select the odd-length
+  // sequences with a single mask
+  constexpr uint64_t k_even_bits = 0x5555555555555555ULL;
+  const uint64_t carry = *escaped ? 1 : 0;
+
+  escapes &= ~carry;
+
+  const uint64_t follows_escape = escapes << 1 | carry;
+  const uint64_t odd_sequence_starts = escapes & ~k_even_bits & ~follows_escape;
+  const uint64_t sequences_starting_on_even_bits = odd_sequence_starts + escapes;
+
+  // overflow means that the last sequence continues in the next block
+  *escaped = sequences_starting_on_even_bits < odd_sequence_starts;
+
+  const uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+
+  return (k_even_bits ^ invert_mask) & follows_escape;
+}
+
+const char *rfind(const char *first, const char *last, char c) {
+  return implementation_impl().rfind(first, last, c);
+}
+
+bool is_escaped(const char *first, const char *pos, char escape) {
+  std::size_t count = 0;
+
+  while (pos > first && *--pos == escape) {
+    ++count;
+  }
+
+  return count % 2 == 1;
+}
+
+const char *implementation() { return implementation_impl().name; }
+
+const char *rfind_row_end(const char *first, const char *pos, const char *last,
+                          const std::string &terminator,
+                          const std::string &escape) {
+  assert(!terminator.empty());
+  assert(pos < last);
+
+  const auto size = terminator.size();
+  const auto t = terminator[0];
+  const char *p = pos + 1;
+
+  while ((p = rfind(first, p, t))) {
+    if (p + size <= last && 0 == ::memcmp(p, terminator.data(), size) &&
+        (escape.empty() || !is_escaped(first, p, escape[0]))) {
+      return p + size;
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace scanner
+
+Row_scanner::Row_scanner(const std::string &terminator,
+                         const std::string &escape, bool at_row_start)
+    : m_terminator(terminator),
+      m_escape(escape.empty() ? 0 : escape[0]),
+      m_has_escape(!escape.empty()),
+      m_state_known(at_row_start) {
+  assert(!m_terminator.empty());
+}
+
+const char *Row_scanner::find(const char *first, const char *last,
+                              const char *limit) {
+  const auto size = m_terminator.size();
+  const auto t = m_terminator[0];
+
+  const auto matches = [&](const char *p) {
+    return p + size <= limit && 0 == ::memcmp(p, m_terminator.data(), size);
+  };
+
+  // handle the bytes one by one, until escape state is known
+  while (!m_state_known && first < last) {
+    const auto c = *first++;
+
+    if (m_has_escape && m_escape == c) {
+      m_escaped = !m_escaped;
+    } else {
+      // terminator is ignored, it's not known if it's escaped
+      m_escaped = false;
+      m_state_known = true;
+    }
+  }
+
+  while (last - first >= scanner::k_block_size) {
+    uint64_t escapes = 0;
+    auto candidates = scanner::classify(first, t, m_escape, &escapes);
+
+    if (m_has_escape && (escapes || m_escaped)) {
+      candidates &= ~scanner::escaped_mask(escapes, &m_escaped);
+    }
+
+    while (candidates) {
+      const auto p = first + scanner::count_trailing_zeros(candidates);
+
+      if (matches(p)) {
+        m_escaped = false;
+        return p + size;
+      }
+
+      // clear the lowest bit
+      candidates &= candidates - 1;
+    }
+
+    first += scanner::k_block_size;
+  }
+
+  for (; first < last; ++first) {
+    if (m_has_escape && m_escape == *first) {
+      m_escaped = !m_escaped;
+      continue;
+    }
+
+    if (!m_escaped && t == *first && matches(first)) {
+      return first + size;
+    }
+
+    m_escaped = false;
+  }
+
+  return nullptr;
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_SCANNER_H_
+#define MODULES_UTIL_IMPORT_TABLE_SCANNER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace mysqlsh {
+namespace import_table {
+namespace scanner {
+
+/**
+ * Finds the first byte equal to c in range [first, last).
+ *
+ * @returns Pointer to the matching byte or last if there's none.
+ */
+const char *find(const char *first, const char *last, char c);
+
+/**
+ * Number of bytes processed by classify().
+ */
+constexpr int k_block_size = 64;
+
+/**
+ * Classifies a block of k_block_size bytes, bit N of the result is set if
+ * byte N is equal to c1, bit N of c2_mask is set if byte N is equal to c2.
+ */
+uint64_t classify(const char *block, char c1, char c2, uint64_t *c2_mask);
+
+/**
+ * Given the mask of escape characters in a block of k_block_size bytes,
+ * computes the mask of the escaped characters, resolving the parity of the
+ * sequences of escape characters.
+ *
+ * @param escapes Mask of escape characters.
+ * @param escaped On input: whether the first byte of the block is escaped, on
+ *        output: whether the first byte of the next block is escaped.
+ *
+ * @returns Mask of escaped characters.
+ */
+uint64_t escaped_mask(uint64_t escapes, bool *escaped);
+
+/**
+ * Finds the last byte equal to c in range [first, last).
+ *
+ * @returns Pointer to the matching byte or nullptr if there's none.
+ */
+const char *rfind(const char *first, const char *last, char c);
+
+/**
+ * Checks if byte at the given position is escaped, by counting the escape
+ * characters which precede it (but not before first). Odd number of escape
+ * characters means that the byte is escaped.
+ */
+bool is_escaped(const char *first, const char *pos, char escape);
+
+/**
+ * Name of the implementation selected at runtime: "avx2", "sse2" or "scalar".
+ */
+const char *implementation();
+
+/**
+ * Finds the last unescaped line terminator which starts in range [first, pos],
+ * the range [first, last) holds the data. Data is expected to start at the
+ * beginning of a row.
+ *
+ * @returns Pointer past the terminator or nullptr if there's none.
+ */
+const char *rfind_row_end(const char *first, const char *pos, const char *last,
+                          const std::string &terminator,
+                          const std::string &escape);
+
+}  // namespace scanner
+
+/**
+ * Finds unescaped line terminators in a stream of data, which can be given in
+ * consecutive pieces. Escape state is carried over between the calls to find().
+ */
+class Row_scanner final {
+ public:
+  /**
+   * Creates the scanner.
+   *
+   * @param terminator Line terminator.
+   * @param escape Escape character, can be empty.
+   * @param at_row_start If false, the scanning starts at an unknown position,
+   *        terminators seen before the first non-escape character are ignored,
+   *        as it's not known if they're escaped.
+   */
+  Row_scanner(const std::string &terminator, const std::string &escape,
+              bool at_row_start);
+
+  Row_scanner(const Row_scanner &) = default;
+  Row_scanner(Row_scanner &&) = default;
+
+  Row_scanner &operator=(const Row_scanner &) = default;
+  Row_scanner &operator=(Row_scanner &&) = default;
+
+  ~Row_scanner() = default;
+
+  /**
+   * Finds the first unescaped line terminator which starts in range
+   * [first, last). Bytes in range [last, limit) are only used to match the
+   * terminator which starts before last.
+   *
+   * @returns Pointer past the terminator or nullptr if there's none.
+   */
+  const char *find(const char *first, const char *last, const char *limit);
+
+ private:
+  std::string m_terminator;
+  char m_escape = 0;
+  bool m_has_escape = false;
+  bool m_escaped = false;
+  bool m_state_known = true;
+};
+
+}  // namespace import_table
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_SCANNER_H_
@@ -692,14 +692,9 @@ void Dump_loader::Worker::Load_chunk_task::load(
   loader->m_num_threads_loading++;
 
   shcore::on_leave_scope cleanup([this, loader]() {
-    std::lock_guard<std::mutex> lock(loader->m_tables_being_loaded_mutex);
-    auto it = loader->m_tables_being_loaded.find(key());
-    while (it != loader->m_tables_being_loaded.end() && it->first == key()) {
-      if (it->second == raw_bytes_loaded) {
-        loader->m_tables_being_loaded.erase(it);
-        break;
-      }
-      ++it;
+    {
+      std::lock_guard<std::mutex> lock(loader->m_tables_being_loaded_mutex);
+      loader->m_tables_being_loaded.remove(key(), raw_bytes_loaded);
     }
 
     loader->m_num_threads_loading--;
@@ -1471,13 +1466,13 @@ bool Dump_loader::should_fetch_table_ddl(bool placeholder) const {
 
 bool Dump_loader::handle_table_data() {
   std::unique_ptr<mysqlshdk::storage::IFile> data_file;
+  std::string data_file_name;
 
   bool scheduled = false;
   bool chunked = false;
   size_t index = 0;
   size_t total = 0;
   size_t size = 0;
-  std::unordered_multimap<std::string, size_t> tables_being_loaded;
   std::string schema;
   std::string table;
   std::string partition;
@@ -1487,13 +1482,19 @@ bool Dump_loader::handle_table_data() {
   //       each partition is treated as a different table
 
   do {
+    bool has_chunk = false;
+
     {
+      // workers only briefly hold this lock when they finish loading a chunk,
+      // file is created once it's released, as this may be a remote request
       std::lock_guard<std::mutex> lock(m_tables_being_loaded_mutex);
-      tables_being_loaded = m_tables_being_loaded;
+      has_chunk = m_dump->next_table_chunk(
+          m_tables_being_loaded, &schema, &table, &partition, &chunked, &index,
+          &total, &data_file_name, &size, &options);
     }
-    if (m_dump->next_table_chunk(tables_being_loaded, &schema, &table,
-                                 &partition, &chunked, &index, &total,
-                                 &data_file, &size, &options)) {
+
+    if (has_chunk) {
+      data_file = m_dump->data_file(data_file_name);
       const auto chunk = chunked ? index : -1;
       auto status =
           m_load_log->table_chunk_status(schema, table, partition, chunk);
@@ -1563,8 +1564,10 @@ bool Dump_loader::schedule_table_chunk(
 
   {
     std::lock_guard<std::mutex> lock(m_tables_being_loaded_mutex);
-    m_tables_being_loaded.emplace(
-        schema_table_object_key(schema, table, partition), file->file_size());
+    // size is the same value which is removed once chunk is loaded, using it
+    // also avoids a possible remote request to fetch the file size
+    m_tables_being_loaded.add(schema_table_object_key(schema, table, partition),
+                              size);
   }
 
   log_debug("Scheduling chunk for table %s (%s)",
@@ -2481,7 +2484,7 @@ void Dump_loader::execute_table_ddl_tasks() {
 
   const auto thread_pool_ptr = m_dump->create_thread_pool();
   const auto pool = thread_pool_ptr.get();
-  shcore::Synchronized_queue<std::unique_ptr<Worker::Task>> worker_tasks;
+  shcore::Work_stealing_queue<std::unique_ptr<Worker::Task>> worker_tasks;
 
   const auto handle_ddl_files = [this, pool, &worker_tasks, &ddl_to_execute](
                                     const std::string &s,
@@ -48,6 +48,7 @@
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
 
 namespace mysqlsh {
 
@@ -559,14 +560,14 @@ class Dump_loader {
   uint64_t m_current_weight = 0;
 
   std::mutex m_tables_being_loaded_mutex;
-  std::unordered_multimap<std::string, size_t> m_tables_being_loaded;
+  Dump_reader::Tables_being_loaded m_tables_being_loaded;
   std::atomic<size_t> m_num_threads_loading;
   std::atomic<size_t> m_num_threads_recreating_indexes;
   std::atomic<size_t> m_num_index_retries{0};
 
   Sql_transform m_default_sql_transforms;
 
-  shcore::Synchronized_queue<Worker_event> m_worker_events;
+  shcore::Work_stealing_queue<Worker_event> m_worker_events;
   std::recursive_mutex m_skip_schemas_mutex;
   std::unordered_set<std::string> m_skip_schemas;
   std::unordered_set<std::string> m_skip_tables;
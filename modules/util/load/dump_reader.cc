@@ -383,6 +383,33 @@ std::string Dump_reader::fetch_schema_script(const std::string &schema) const {
   return script;
 }
 
+void Dump_reader::Tables_being_loaded::add(const std::string &key,
+                                          size_t bytes) {
+  auto &info = m_tables[key];
+  info.bytes += bytes;
+  ++info.threads;
+  m_total_bytes += bytes;
+}
+
+void Dump_reader::Tables_being_loaded::remove(const std::string &key,
+                                             size_t bytes) {
+  const auto it = m_tables.find(key);
+
+  if (it == m_tables.end()) {
+    return;
+  }
+
+  assert(it->second.bytes >= bytes);
+  assert(m_total_bytes >= bytes);
+
+  it->second.bytes -= bytes;
+  m_total_bytes -= bytes;
+
+  if (0 == --it->second.threads) {
+    m_tables.erase(it);
+  }
+}
+
 // Proportional chunk scheduling
 //
 // Multiple sessions writing to the same table mean they will be competing for
@@ -403,31 +430,37 @@ std::string Dump_reader::fetch_schema_script(const std::string &schema) const {
 // to load, while bigger threads get more, with the hope that the total time
 // to load all tables is minimized.
 Dump_reader::Candidate Dump_reader::schedule_chunk_proportionally(
-    const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
+    const Tables_being_loaded &tables_being_loaded,
     std::unordered_set<Dump_reader::Table_data_info *> *tables_with_data,
     uint64_t max_concurrent_tables) {
   if (tables_with_data->empty()) return tables_with_data->end();
 
-  std::vector<Candidate> tables_in_progress;
+  // candidates which were previously scheduled, with their available bytes
+  std::vector<std::pair<Candidate, size_t>> tables_in_progress;
 
   // first check if there's any table that's not being loaded
   {
     const auto end = tables_with_data->end();
     auto best = end;
+    size_t best_bytes = 0;
 
     for (auto it = tables_with_data->begin(); it != end; ++it) {
+      const auto bytes = (*it)->bytes_available();
+
       if ((*it)->chunks_consumed) {
-        tables_in_progress.emplace_back(it);
+        tables_in_progress.emplace_back(it, bytes);
       }
 
-      if (tables_being_loaded.find((*it)->key()) == tables_being_loaded.end()) {
+      if (!tables_being_loaded.contains((*it)->key())) {
         // table is better if it's bigger and in the same state as the current
         // best, or if it was previously scheduled and current best was not
         if (best == end ||
-            ((*it)->bytes_available() > (*best)->bytes_available() &&
+            (bytes > best_bytes &&
              !(*it)->chunks_consumed == !(*best)->chunks_consumed) ||
-            ((*it)->chunks_consumed && !(*best)->chunks_consumed))
+            ((*it)->chunks_consumed && !(*best)->chunks_consumed)) {
           best = it;
+          best_bytes = bytes;
+        }
       }
     }
 
@@ -440,51 +473,32 @@ Dump_reader::Candidate Dump_reader::schedule_chunk_proportionally(
   }
 
   // if all available tables are already loaded, then schedule proportionally
-  std::unordered_map<std::string, double> worker_weights;
 
-  // calc ratio of data being loaded per table / total data being loaded
-  double total_bytes_loading = std::accumulate(
-      tables_being_loaded.begin(), tables_being_loaded.end(),
-      static_cast<size_t>(0),
-      [&worker_weights](size_t size,
-                        const std::pair<std::string, size_t> &table_size) {
-        worker_weights[table_size.first] += table_size.second;
-        return size + table_size.second;
-      });
-
-  if (total_bytes_loading > 0) {
-    for (auto &it : worker_weights) {
-      it.second = it.second / total_bytes_loading;
-    }
-  }
-
-  std::vector<std::pair<Candidate, double>> candidate_weights;
+  // ratio of data being loaded per table / total data being loaded
+  const double total_bytes_loading = tables_being_loaded.total_bytes();
 
-  // calc ratio of data available per table / total data available
-  double total_bytes_available = std::accumulate(
+  // ratio of data available per table / total data available
+  const double total_bytes_available = std::accumulate(
       tables_in_progress.begin(), tables_in_progress.end(),
       static_cast<size_t>(0),
-      [](size_t size, auto it) { return size + (*it)->bytes_available(); });
-  if (total_bytes_available > 0) {
-    for (auto it = tables_in_progress.begin(); it != tables_in_progress.end();
-         ++it) {
-      candidate_weights.emplace_back(
-          *it, static_cast<double>((**it)->bytes_available()) /
-                   total_bytes_available);
-    }
-  } else {
+      [](size_t size, const auto &it) { return size + it.second; });
+
+  if (total_bytes_available <= 0) {
     assert(0);
-    return tables_in_progress.front();
+    return tables_in_progress.front().first;
   }
 
   // pick a chunk from the table that has the biggest difference between both
   double best_diff = 0;
-  Candidate best = tables_in_progress.front();
+  Candidate best = tables_in_progress.front().first;
 
-  for (const auto &cand : candidate_weights) {
-    const auto it = worker_weights.find((*cand.first)->key());
-    const auto weight = it == worker_weights.end() ? 0.0 : it->second;
-    const auto d = cand.second - weight;
+  for (const auto &cand : tables_in_progress) {
+    const auto weight =
+        total_bytes_loading > 0
+            ? tables_being_loaded.bytes((*cand.first)->key()) /
+                  total_bytes_loading
+            : 0.0;
+    const auto d = cand.second / total_bytes_available - weight;
 
     if (d > best_diff) {
       best_diff = d;
@@ -496,11 +510,11 @@ Dump_reader::Candidate Dump_reader::schedule_chunk_proportionally(
 }
 
 bool Dump_reader::next_table_chunk(
-    const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
+    const Tables_being_loaded &tables_being_loaded,
     std::string *out_schema, std::string *out_table, std::string *out_partition,
     bool *out_chunked, size_t *out_chunk_index, size_t *out_chunks_total,
-    std::unique_ptr<mysqlshdk::storage::IFile> *out_file,
-    size_t *out_chunk_size, shcore::Dictionary_t *out_options) {
+    std::string *out_file_name, size_t *out_chunk_size,
+    shcore::Dictionary_t *out_options) {
   auto iter = schedule_chunk_proportionally(
       tables_being_loaded, &m_tables_with_data, m_options.threads_count());
 
@@ -526,11 +540,14 @@ bool Dump_reader::next_table_chunk(
           " which is not yet available");
     }
 
-    *out_file = m_dir->file(info->name());
+    *out_file_name = info->name();
     *out_chunk_size = info->size();
     *out_options = (*iter)->owner->options;
 
+    // zero-sized chunks are marked as loaded when consumed
     (*iter)->consume_chunk();
+    on_table_state_changed((*iter)->owner);
+
     if (!(*iter)->has_data_available()) m_tables_with_data.erase(iter);
 
     return true;
@@ -539,42 +556,76 @@ bool Dump_reader::next_table_chunk(
   return false;
 }
 
+std::unique_ptr<mysqlshdk::storage::IFile> Dump_reader::data_file(
+    const std::string &name) const {
+  return m_dir->file(name);
+}
+
 bool Dump_reader::next_deferred_index(
     std::string *out_schema, std::string *out_table,
     compatibility::Deferred_statements::Index_info **out_indexes) {
-  for (auto &schema : m_contents.schemas) {
-    for (auto &table : schema.second->tables) {
-      if ((!m_options.load_data() || table.second->all_data_loaded()) &&
-          !table.second->indexes_scheduled) {
-        table.second->indexes_scheduled = true;
-        *out_schema = schema.second->schema;
-        *out_table = table.second->table;
-        *out_indexes = &table.second->indexes;
-        return true;
-      }
+  while (!m_tables_ready_for_indexes.empty()) {
+    const auto table = m_tables_ready_for_indexes.front();
+    m_tables_ready_for_indexes.pop_front();
+    table->indexes_queued = false;
+
+    if (!table->indexes_scheduled) {
+      table->indexes_scheduled = true;
+      *out_schema = table->schema;
+      *out_table = table->table;
+      *out_indexes = &table->indexes;
+      return true;
     }
   }
+
   return false;
 }
 
 bool Dump_reader::next_table_analyze(std::string *out_schema,
                                      std::string *out_table,
                                      std::vector<Histogram> *out_histograms) {
-  for (auto &schema : m_contents.schemas) {
-    for (auto &table : schema.second->tables) {
-      if ((!m_options.load_data() || table.second->all_data_loaded()) &&
-          table.second->indexes_created && !table.second->analyze_scheduled) {
-        table.second->analyze_scheduled = true;
-        *out_schema = schema.second->schema;
-        *out_table = table.second->table;
-        *out_histograms = table.second->histograms;
-        return true;
-      }
+  while (!m_tables_ready_for_analyze.empty()) {
+    const auto table = m_tables_ready_for_analyze.front();
+    m_tables_ready_for_analyze.pop_front();
+    table->analyze_queued = false;
+
+    if (!table->analyze_scheduled) {
+      table->analyze_scheduled = true;
+      *out_schema = table->schema;
+      *out_table = table->table;
+      *out_histograms = table->histograms;
+      return true;
     }
   }
+
   return false;
 }
 
+void Dump_reader::on_table_state_changed(Table_info *table) {
+  if (m_options.load_data() && !table->all_data_loaded()) {
+    return;
+  }
+
+  if (!table->indexes_scheduled && !table->indexes_queued) {
+    table->indexes_queued = true;
+    m_tables_ready_for_indexes.emplace_back(table);
+  }
+
+  if (table->indexes_created && !table->analyze_scheduled &&
+      !table->analyze_queued) {
+    table->analyze_queued = true;
+    m_tables_ready_for_analyze.emplace_back(table);
+  }
+}
+
+void Dump_reader::on_all_tables_state_changed() {
+  for (const auto &schema : m_contents.schemas) {
+    for (const auto &table : schema.second->tables) {
+      on_table_state_changed(table.second.get());
+    }
+  }
+}
+
 bool Dump_reader::data_available() const { return !m_tables_with_data.empty(); }
 
 bool Dump_reader::work_available() const {
@@ -665,6 +716,9 @@ void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
   }
 
   compute_filtered_data_size();
+
+  // new metadata and data files may have changed the state of any table
+  on_all_tables_state_changed();
 }
 
 uint64_t Dump_reader::add_deferred_statements(
@@ -690,6 +744,8 @@ uint64_t Dump_reader::add_deferred_statements(
       !m_options.load_deferred_indexes() || stmts.index_info.empty();
   t->second->indexes = std::move(stmts.index_info);
 
+  on_table_state_changed(t->second.get());
+
   const auto table_name = schema_object_key(schema, table);
 
   for (const auto &fk : stmts.foreign_keys) {
@@ -1460,6 +1516,7 @@ void Dump_reader::on_chunk_loaded(std::string_view schema,
   for (auto &tdi : t->data_info) {
     if (tdi.partition == partition) {
       ++tdi.chunks_loaded;
+      on_table_state_changed(t);
       return;
     }
   }
@@ -1474,7 +1531,9 @@ void Dump_reader::on_chunk_loaded(std::string_view schema,
 
 void Dump_reader::on_index_end(std::string_view schema,
                                std::string_view table) {
-  find_table(schema, table, "indexes were created")->indexes_created = true;
+  const auto t = find_table(schema, table, "indexes were created");
+  t->indexes_created = true;
+  on_table_state_changed(t);
 }
 
 void Dump_reader::on_analyze_end(std::string_view schema,
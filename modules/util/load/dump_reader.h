@@ -24,6 +24,7 @@
 #ifndef MODULES_UTIL_LOAD_DUMP_READER_H_
 #define MODULES_UTIL_LOAD_DUMP_READER_H_
 
+#include <deque>
 #include <list>
 #include <map>
 #include <memory>
@@ -54,6 +55,44 @@ class Dump_reader {
       std::pair<std::string, std::shared_ptr<mysqlshdk::storage::IFile>>;
   using Files = std::unordered_set<mysqlshdk::storage::IDirectory::File_info>;
 
+  /**
+   * Tracks the tables and partitions which are currently being loaded, along
+   * with the number of bytes and threads used to load each of them.
+   */
+  class Tables_being_loaded final {
+   public:
+    void add(const std::string &key, size_t bytes);
+
+    void remove(const std::string &key, size_t bytes);
+
+    bool contains(const std::string &key) const {
+      return m_tables.find(key) != m_tables.end();
+    }
+
+    size_t bytes(const std::string &key) const {
+      const auto it = m_tables.find(key);
+      return it == m_tables.end() ? 0 : it->second.bytes;
+    }
+
+    size_t threads(const std::string &key) const {
+      const auto it = m_tables.find(key);
+      return it == m_tables.end() ? 0 : it->second.threads;
+    }
+
+    size_t total_bytes() const { return m_total_bytes; }
+
+    bool empty() const { return m_tables.empty(); }
+
+   private:
+    struct Info {
+      size_t bytes = 0;
+      size_t threads = 0;
+    };
+
+    std::unordered_map<std::string, Info> m_tables;
+    size_t m_total_bytes = 0;
+  };
+
   Dump_reader(std::unique_ptr<mysqlshdk::storage::IDirectory> dump_dir,
               const Load_dump_options &options);
 
@@ -146,13 +185,15 @@ class Dump_reader {
                        const std::string &table) const;
 
   bool next_table_chunk(
-      const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
+      const Tables_being_loaded &tables_being_loaded,
       std::string *out_schema, std::string *out_table,
       std::string *out_partition, bool *out_chunked, size_t *out_chunk_index,
-      size_t *out_chunks_total,
-      std::unique_ptr<mysqlshdk::storage::IFile> *out_file,
+      size_t *out_chunks_total, std::string *out_file_name,
       size_t *out_chunk_size, shcore::Dictionary_t *out_options);
 
+  std::unique_ptr<mysqlshdk::storage::IFile> data_file(
+      const std::string &name) const;
+
   struct Histogram {
     std::string column;
     size_t buckets;
@@ -365,6 +406,10 @@ class Dump_reader {
     std::vector<Histogram> histograms;
     bool analyze_scheduled = true;
     bool analyze_finished = true;
+    // whether table is in the queue of tables ready for index creation
+    bool indexes_queued = false;
+    // whether table is in the queue of tables ready to be analyzed
+    bool analyze_queued = false;
     bool has_triggers = false;
 
     std::vector<Table_data_info> data_info;
@@ -493,6 +538,14 @@ class Dump_reader {
   Table_info *find_table(std::string_view schema, std::string_view table,
                          std::string_view context);
 
+  /**
+   * Checks if deferred indexes of the given table can be created or if it can
+   * be analyzed, and if so, adds it to the corresponding queue.
+   */
+  void on_table_state_changed(Table_info *table);
+
+  void on_all_tables_state_changed();
+
   std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
 
   const Load_dump_options &m_options;
@@ -504,6 +557,12 @@ class Dump_reader {
   // Tables and partitions that are ready to be loaded
   std::unordered_set<Table_data_info *> m_tables_with_data;
 
+  // Tables whose deferred indexes can be created
+  std::deque<Table_info *> m_tables_ready_for_indexes;
+
+  // Tables which can be analyzed
+  std::deque<Table_info *> m_tables_ready_for_analyze;
+
   // tables which have data to be loaded (possibly partitioned)
   std::atomic<uint64_t> m_tables_to_load{0};
 
@@ -522,7 +581,7 @@ class Dump_reader {
       std::unordered_set<Dump_reader::Table_data_info *>::iterator;
 
   static Candidate schedule_chunk_proportionally(
-      const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
+      const Tables_being_loaded &tables_being_loaded,
       std::unordered_set<Dump_reader::Table_data_info *> *tables_with_data,
       uint64_t max_concurrent_tables);
 
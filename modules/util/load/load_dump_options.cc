@@ -36,6 +36,7 @@
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/oci/oci_par.h"
+#include "mysqlshdk/libs/storage/backend/object_storage_config.h"
 #include "mysqlshdk/libs/storage/backend/oci_par_directory_config.h"
 #include "mysqlshdk/libs/storage/utils.h"
 #include "mysqlshdk/libs/utils/debug.h"
@@ -143,6 +144,10 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
           .optional("sessionInitSql", &Load_dump_options::m_session_init_sql)
           .optional("handleGrantErrors",
                     &Load_dump_options::set_handle_grant_errors)
+          .optional("parallelDownloads",
+                    &Load_dump_options::m_parallel_downloads)
+          .optional("downloadMemoryLimit",
+                    &Load_dump_options::set_download_memory_limit)
           .include(&Load_dump_options::m_oci_bucket_options)
           .include(&Load_dump_options::m_s3_bucket_options)
           .include(&Load_dump_options::m_blob_storage_options)
@@ -178,6 +183,15 @@ void Load_dump_options::set_max_bytes_per_transaction(
   }
 }
 
+void Load_dump_options::set_download_memory_limit(const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument(
+        "The option 'downloadMemoryLimit' cannot be set to an empty string.");
+  }
+
+  m_download_memory_limit = mysqlshdk::utils::expand_to_bytes(value);
+}
+
 void Load_dump_options::set_progress_file(const std::string &value) {
   m_progress_file = value;
 
@@ -405,16 +419,30 @@ void Load_dump_options::on_unpacked_options() {
   m_s3_bucket_options.throw_on_conflict(m_blob_storage_options);
   m_blob_storage_options.throw_on_conflict(m_oci_bucket_options);
 
+  std::shared_ptr<mysqlshdk::storage::backend::object_storage::Config> config;
+
   if (m_oci_bucket_options) {
-    m_storage_config = m_oci_bucket_options.config();
+    config = m_oci_bucket_options.config();
   }
 
   if (m_s3_bucket_options) {
-    m_storage_config = m_s3_bucket_options.config();
+    config = m_s3_bucket_options.config();
   }
 
   if (m_blob_storage_options) {
-    m_storage_config = m_blob_storage_options.config();
+    config = m_blob_storage_options.config();
+  }
+
+  if (config) {
+    config->set_parallel_downloads(m_parallel_downloads);
+    config->set_download_memory_limit(m_download_memory_limit);
+    m_storage_config = std::move(config);
+  } else if (m_parallel_downloads > 0 || m_download_memory_limit > 0) {
+    throw std::invalid_argument(shcore::str_format(
+        "The '%s' option can only be used when loading from an object "
+        "storage.",
+        m_parallel_downloads > 0 ? "parallelDownloads"
+                                 : "downloadMemoryLimit"));
   }
 
   if (!m_load_data && !m_load_ddl && !m_load_users &&
@@ -152,6 +152,10 @@ class Load_dump_options {
 
   uint64_t dump_wait_timeout_ms() const { return m_wait_dump_timeout_ms; }
 
+  uint64_t parallel_downloads() const { return m_parallel_downloads; }
+
+  uint64_t download_memory_limit() const { return m_download_memory_limit; }
+
   const std::string &character_set() const { return m_character_set; }
 
   bool load_data() const { return m_load_data; }
@@ -231,6 +235,8 @@ class Load_dump_options {
 
   void set_max_bytes_per_transaction(const std::string &value);
 
+  void set_download_memory_limit(const std::string &value);
+
   void set_progress_file(const std::string &file);
 
   void set_handle_grant_errors(const std::string &action);
@@ -297,6 +303,12 @@ class Load_dump_options {
 
   Handle_grant_errors m_handle_grant_errors = Handle_grant_errors::ABORT;
 
+  // number of concurrent ranged requests used to read ahead a dump file
+  uint64_t m_parallel_downloads = 0;
+
+  // maximum number of bytes held by the read-ahead of a dump file
+  uint64_t m_download_memory_limit = 0;
+
   // how many threads are used by the server per one ALTER TABLE ... ADD INDEX
   uint64_t m_threads_per_add_index = 1;
 
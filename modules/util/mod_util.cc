@@ -805,6 +805,11 @@ set <b>fieldsOptionallyEnclosed</b> to true.
 If you specify one separator that is the same as or a prefix of another, LOAD
 DATA INFILE cannot interpret the input properly.
 
+A single compressed file is imported using one thread, unless it is a zstd file
+written in the seekable format (independently compressed frames followed by a
+seek table), in which case it is split into chunks which are imported in
+parallel.
+
 Connection options set in the global session, such as compression, ssl-mode, etc.
 are used in parallel connections.
 
@@ -1145,6 +1150,14 @@ LOAD DATA statement. Supports unit suffixes: k (kilobytes), M (Megabytes), G
 (Gigabytes). Minimum value: 4096. If this option is not specified explicitly,
 the value of the <b>bytesPerChunk</b> dump option is used, but only in case of
 the files with data size greater than <b>1.5 * bytesPerChunk</b>.
+@li <b>parallelDownloads</b>: int (default: 0) - Number of ranged requests which
+are used to concurrently fetch the data of a dump file ahead of the current read
+position, when loading from an object storage. If set to 0, data is fetched by
+the thread which reads the file.
+@li <b>downloadMemoryLimit</b>: string (default: not set) - Maximum amount of
+memory held by the data of a single dump file which is fetched ahead of the
+current read position, when loading from an object storage, supports the same
+unit suffixes as maxBytesPerTransaction. At least one chunk is always fetched.
 @li <b>progressFile</b>: path (default: load-progress.@<server_uuid@>.progress)
 - Stores load progress information in the given local file path.
 @li <b>resetProgress</b>: bool (default: false) - Discards progress information
@@ -1440,7 +1453,20 @@ limit.
 @li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
 otherwise) - Enable or disable dump progress information.
 @li <b>defaultCharacterSet</b>: string (default: "utf8mb4") - Character set used
-for the dump.)*");
+for the dump.
+@li <b>encodeBinaryOnClient</b>: bool (default: false) - Fetch the values of
+binary columns (BINARY, VARBINARY, BLOB and GEOMETRY) as they are and encode
+them on the client, instead of encoding them on the server using TO_BASE64().
+Reduces the load on the server and the amount of data transferred, contents of
+the dump files are the same.
+@li <b>parallelUploads</b>: int (default: 0) - Number of parts of a dump file
+which are uploaded concurrently in the background when dumping to an object
+storage, while the next part is being written. If set to 0, parts are uploaded
+by the thread which writes the file.
+@li <b>uploadMemoryLimit</b>: string (default: not set) - Maximum amount of
+memory held by the parts of a single dump file which are being uploaded in the
+background, supports the same unit suffixes as maxRate. At least one part is
+always uploaded.)*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_OCI_COMMON_OPTIONS, R"*(
 @li <b>osBucketName</b>: string (default: not set) - Use specified OCI bucket
@@ -1501,7 +1527,20 @@ the server.
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_DDL_COMPRESSION, R"*(
 @li <b>compression</b>: string (default: "zstd") - Compression used when writing
-the data dump files, one of: "none", "gzip", "zstd".
+the data dump files, one of: "none", "gzip", "zstd", "lz4".
+@li <b>compressionThreads</b>: int (default: 0) - Maximum number of zstd worker
+threads used to compress a single data file, 0 disables them. Worker threads are
+used only when fewer data chunks remain to be dumped than the number of
+<b>threads</b>, so that the threads which would be idle compress the remaining
+files in parallel.
+@li <b>metricsFormat</b>: string (default: not set) - Collect per-table metrics
+of the data dump: number of chunks, rows, uncompressed bytes and bytes written
+to the files, time spent waiting for the first rows, fetching the rows, encoding
+them, compressing and writing the files and waiting due to <b>maxRate</b>. The
+metrics are written to the "@.metrics.json" file if set to "json", or to the
+"@.metrics.prom" file in the Prometheus text format if set to "prometheus". The
+file is rewritten every 5 seconds while the data is being dumped. The JSON
+format also includes the metrics of each chunk.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_MDS_COMMON_OPTIONS, R"*(
@@ -1719,10 +1758,16 @@ to be overwritten. The output file is created with the following access rights
 used to filter the data being exported.
 @li <b>partitions</b>: list of strings (default: not set) - A list of valid
 partition names used to limit the data export to just the specified partitions.
+@li <b>compressionFrameSize</b>: string (default: not set) - Write the zstd
+compressed data as independently compressed frames, each holding at most the
+given number of uncompressed bytes, followed by a seek table (zstd seekable
+format), which allows the file to be read from any frame. Can only be used if
+the compression option is set to "zstd". Supports the same unit suffixes as
+maxRate.
 
 ${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
 @li <b>compression</b>: string (default: "none") - Compression used when writing
-the data dump files, one of: "none", "gzip", "zstd".
+the data dump files, one of: "none", "gzip", "zstd", "lz4".
 
 ${TOPIC_UTIL_DUMP_OCI_COMMON_OPTIONS}
 
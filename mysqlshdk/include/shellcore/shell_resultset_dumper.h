@@ -90,6 +90,12 @@ class Resultset_printer {
    */
   virtual void raw_print(const std::string &s) = 0;
 
+  /**
+   * Whether consecutive pieces of text given to print() can be merged into a
+   * single call. Raw output can always be merged.
+   */
+  virtual bool can_merge_output() const { return true; }
+
   /**
    * Resets the printer
    */
@@ -182,67 +182,60 @@ Result::~Result() = default;
 
 const IRow *Result::fetch_one() {
   if (_pre_fetched) {
-    if (!_persistent_pre_fetch) {
-      if (!_pre_fetched_rows.empty()) {
-        if (_fetched_row_count > 0)  // free the previously fetched row
-          _pre_fetched_rows.pop_front();
-        if (!_pre_fetched_rows.empty()) {
-          // return the next row, but don't pop it yet otherwise it'll be freed
-          const IRow *row = &_pre_fetched_rows.front();
-          _fetched_row_count++;
-          return row;
-        }
-      }
-    } else {
-      if (_fetched_row_count < _pre_fetched_rows.size()) {
-        return &_pre_fetched_rows[_fetched_row_count++];
-      }
+    if (_fetched_row_count < _pre_fetched_rows.size()) {
+      return &_pre_fetched_rows[_fetched_row_count++];
     }
-    if (_pre_fetched_clear_at_end &&
-        (_fetched_row_count == _pre_fetched_rows.size()))
-      _pre_fetched = false;
 
-  } else {
-    // clear state if we exited a pre_fetch scenario
-    if (_pre_fetched_clear_at_end) {
-      assert(_pre_fetched_rows.size() == 1);
-      _pre_fetched_rows.clear();
-      _pre_fetched_clear_at_end = false;
+    if (!_pre_fetched_clear_at_end) {
+      // rows are stored in a single batch, if they are not persistent, they're
+      // freed once all of them were fetched
+      if (!_persistent_pre_fetch) _pre_fetched_rows.clear();
+
+      return nullptr;
     }
 
-    if (has_resultset()) {
-      // Loads the first row
-      std::shared_ptr<MYSQL_RES> res = _result.lock();
+    // the row fetched by pre_fetch_row() was consumed, continue with the rows
+    // which follow it
+    _pre_fetched = false;
+  }
 
-      if (res) {
-        MYSQL_ROW mysql_row = mysql_fetch_row(res.get());
-        if (mysql_row) {
-          unsigned long *lengths;
-          lengths = mysql_fetch_lengths(res.get());
+  // clear state if we exited a pre_fetch scenario
+  if (_pre_fetched_clear_at_end) {
+    assert(_pre_fetched_rows.size() == 1);
+    _pre_fetched_rows.clear();
+    _pre_fetched_clear_at_end = false;
+  }
 
-          _row->reset(mysql_row, lengths);
+  if (has_resultset()) {
+    // Loads the first row
+    std::shared_ptr<MYSQL_RES> res = _result.lock();
 
-          // Each read row increases the count
-          _fetched_row_count++;
-        } else {
-          _row.reset();
-          if (auto session = _session.lock()) {
-            int code = 0;
-            const char *state;
-            const char *err = session->get_last_error(&code, &state);
-            if (code != 0) throw mysqlshdk::db::Error(err, code, state);
-          }
-        }
+    if (res) {
+      MYSQL_ROW mysql_row = mysql_fetch_row(res.get());
+      if (mysql_row) {
+        unsigned long *lengths;
+        lengths = mysql_fetch_lengths(res.get());
+
+        _row->reset(mysql_row, lengths);
+
+        // Each read row increases the count
+        _fetched_row_count++;
       } else {
         _row.reset();
+        if (auto session = _session.lock()) {
+          int code = 0;
+          const char *state;
+          const char *err = session->get_last_error(&code, &state);
+          if (code != 0) throw mysqlshdk::db::Error(err, code, state);
+        }
       }
     } else {
       _row.reset();
     }
-    return _row.get();
+  } else {
+    _row.reset();
   }
-
-  return nullptr;
+  return _row.get();
 }
 
 bool Result::next_resultset() {
@@ -335,7 +328,7 @@ bool Result::pre_fetch_row() {
 
     if (!has_resultset()) return false;
 
-    _pre_fetched_rows.emplace_back(*fetch_one());
+    _pre_fetched_rows.append(*fetch_one());
     _fetched_row_count = 0;
     _pre_fetched = true;
     _pre_fetched_clear_at_end = true;
@@ -351,8 +344,9 @@ bool Result::pre_fetch_rows(bool persistent) {
     if (!has_resultset()) return false;
     while (auto row = fetch_one()) {
       if (_stop_pre_fetch) return true;
-      _pre_fetched_rows.emplace_back(*row);
+      _pre_fetched_rows.append(*row);
     }
+    _pre_fetched_rows.shrink_to_fit();
     _fetched_row_count = 0;
 
     _pre_fetched = true;
@@ -29,7 +29,6 @@
 
 #include "mysqlshdk/libs/db/result.h"
 
-#include <deque>
 #include <list>
 #include <memory>
 #include <string>
@@ -37,6 +36,8 @@
 
 #include <mysql.h>
 
+#include "mysqlshdk/libs/db/row_batch.h"
+
 namespace mysqlshdk {
 namespace db {
 namespace mysql {
@@ -78,7 +79,7 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
          bool buffered);
   void reset(std::shared_ptr<MYSQL_RES> res);
 
-  std::deque<mysqlshdk::db::Row_copy> _pre_fetched_rows;
+  mysqlshdk::db::Row_batch _pre_fetched_rows;
   // size_t _fetched_row_count = 0;
   // size_t _fetched_warning_count = 0;
   bool _stop_pre_fetch = false;
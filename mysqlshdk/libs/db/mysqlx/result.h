@@ -29,7 +29,6 @@
 
 #include "mysqlshdk/libs/db/result.h"
 
-#include <deque>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -38,7 +37,7 @@
 
 #include "mysqlshdk/libs/db/mysqlx/mysqlxclient_clean.h"
 #include "mysqlshdk/libs/db/mysqlx/row.h"
-#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/db/row_batch.h"
 
 namespace mysqlshdk {
 namespace db {
@@ -85,7 +84,7 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
 
   std::vector<Column> _metadata;
 
-  std::deque<mysqlshdk::db::Row_copy> _pre_fetched_rows;
+  mysqlshdk::db::Row_batch _pre_fetched_rows;
   std::unique_ptr<xcl::XQuery_result> _result;
   mutable std::shared_ptr<Field_names> _field_names;
 
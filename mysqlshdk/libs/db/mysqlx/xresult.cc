@@ -233,25 +233,15 @@ Result::~Result() {
 
 const IRow *Result::fetch_one() {
   if (_pre_fetched) {
-    if (!_persistent_pre_fetch) {
-      if (!_pre_fetched_rows.empty()) {
-        if (_fetched_row_count - m_fetched_before_prefetch >
-            0)  // free the previously fetched row
-          _pre_fetched_rows.pop_front();
-        if (!_pre_fetched_rows.empty()) {
-          // return the next row, but don't pop it yet otherwise it'll be freed
-          const IRow *row = &_pre_fetched_rows.front();
-          _fetched_row_count++;
-          return row;
-        }
-      }
-    } else {
-      if (_fetched_row_count - m_fetched_before_prefetch <
-          _pre_fetched_rows.size()) {
-        return &_pre_fetched_rows[(_fetched_row_count++) -
-                                  m_fetched_before_prefetch];
-      }
+    if (_fetched_row_count - m_fetched_before_prefetch <
+        _pre_fetched_rows.size()) {
+      return &_pre_fetched_rows[(_fetched_row_count++) -
+                                m_fetched_before_prefetch];
     }
+
+    // rows are stored in a single batch, if they are not persistent, they're
+    // freed once all of them were fetched
+    if (!_persistent_pre_fetch) _pre_fetched_rows.clear();
   } else {
     // Loads the first row
     if (_result) {
@@ -288,7 +278,7 @@ bool Result::pre_fetch_rows(bool persistent) {
     while (const ::xcl::XRow *row = _result->get_next_row(&error)) {
       if (_stop_pre_fetch) return true;
       wrapper.reset(row);
-      _pre_fetched_rows.emplace_back(wrapper);
+      _pre_fetched_rows.append(wrapper);
     }
     if (error) {
       std::stringstream msg;
@@ -296,6 +286,7 @@ bool Result::pre_fetch_rows(bool persistent) {
       msg << " while fetching row " << _pre_fetched_rows.size() + 1 << ".";
       throw mysqlshdk::db::Error(msg.str().c_str(), error.error());
     }
+    _pre_fetched_rows.shrink_to_fit();
     _pre_fetched = true;
     m_fetched_before_prefetch = _fetched_row_count;
   }
@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/row_batch.h"
+
+#include <cassert>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace db {
+
+#define FIELD_ERROR(index, msg) \
+  std::invalid_argument(        \
+      shcore::str_format("%s(%u): " msg, __FUNCTION__, index).c_str())
+
+#define FIELD_ERROR1(index, msg, arg) \
+  std::invalid_argument(              \
+      shcore::str_format("%s(%u): " msg, __FUNCTION__, index, arg).c_str())
+
+#define GET_VALIDATE_TYPE(index, TYPE_CHECK)                                \
+  const auto field = validate(index);                                       \
+  if (m_batch->is_null(field)) throw FIELD_ERROR(index, "field is NULL");   \
+  const auto ftype = m_batch->m_types[index];                               \
+  if (!(TYPE_CHECK))                                                        \
+    throw FIELD_ERROR1(index, "field type is %s", to_string(ftype).c_str())
+
+void Row_batch::append(const IRow &row) {
+  const auto num_fields = row.num_fields();
+
+  if (m_rows.empty()) {
+    m_types.clear();
+    m_types.reserve(num_fields);
+
+    for (uint32_t i = 0; i < num_fields; ++i) {
+      m_types.emplace_back(row.get_type(i));
+    }
+  } else if (num_fields != m_types.size()) {
+    throw std::invalid_argument(
+        shcore::str_format("Attempt to append a row with %u fields to a batch "
+                           "of rows with %zu fields",
+                           num_fields, m_types.size()));
+  }
+
+  const auto arena_size = m_arena.size();
+  const auto fields = m_fields;
+
+  m_nulls.resize((m_fields + num_fields + 63) / 64);
+
+  try {
+    append_fields(row);
+  } catch (...) {
+    // remove the partially copied row
+    m_arena.resize(arena_size);
+    m_offsets.resize(fields + 1);
+
+    for (; m_fields > fields; --m_fields) {
+      const auto f = m_fields - 1;
+      m_nulls[f / 64] &= ~(UINT64_C(1) << (f % 64));
+    }
+
+    throw;
+  }
+
+  m_rows.emplace_back(this, m_rows.size());
+}
+
+void Row_batch::append_fields(const IRow &row) {
+  for (uint32_t i = 0, size = row.num_fields(); i < size; ++i) {
+    if (row.is_null(i)) {
+      append_null();
+      continue;
+    }
+
+    // same conversions as in Row_copy
+    switch (m_types[i]) {
+      case Type::Null:
+        append_null();
+        break;
+
+      case Type::Decimal:
+      case Type::Bit: {
+        const auto s = row.get_as_string(i);
+        append_data(s.data(), s.length());
+        break;
+      }
+
+      case Type::Date:
+      case Type::DateTime:
+      case Type::Time:
+      case Type::Geometry:
+      case Type::Json:
+      case Type::Enum:
+      case Type::Set: {
+        const auto s = row.get_string(i);
+        append_data(s.data(), s.length());
+        break;
+      }
+
+      case Type::String:
+      case Type::Bytes: {
+        const auto s = row.get_string_data(i);
+        append_data(s.first, s.second);
+        break;
+      }
+
+      case Type::Integer:
+        append_value(row.get_int(i));
+        break;
+
+      case Type::UInteger:
+        append_value(row.get_uint(i));
+        break;
+
+      case Type::Float:
+        append_value(row.get_float(i));
+        break;
+
+      case Type::Double:
+        append_value(row.get_double(i));
+        break;
+    }
+  }
+}
+
+void Row_batch::clear() {
+  m_types.clear();
+  m_arena.clear();
+  m_offsets.resize(1);
+  m_nulls.clear();
+  m_fields = 0;
+  m_rows.clear();
+}
+
+void Row_batch::shrink_to_fit() {
+  m_arena.shrink_to_fit();
+  m_offsets.shrink_to_fit();
+  m_nulls.shrink_to_fit();
+  m_rows.shrink_to_fit();
+}
+
+void Row_batch::append_data(const char *data, size_t length) {
+  m_arena.insert(m_arena.end(), data, data + length);
+  m_offsets.emplace_back(m_arena.size());
+  ++m_fields;
+}
+
+void Row_batch::append_null() {
+  m_nulls[m_fields / 64] |= UINT64_C(1) << (m_fields % 64);
+  m_offsets.emplace_back(m_arena.size());
+  ++m_fields;
+}
+
+template <typename T>
+T Row_batch::value(size_t field) const {
+  assert(m_offsets[field + 1] - m_offsets[field] == sizeof(T));
+  T v;
+  ::memcpy(&v, m_arena.data() + m_offsets[field], sizeof(T));
+  return v;
+}
+
+uint32_t Row_batch::Row::num_fields() const {
+  return static_cast<uint32_t>(m_batch->m_types.size());
+}
+
+size_t Row_batch::Row::validate(uint32_t index) const {
+  if (index >= num_fields()) throw FIELD_ERROR(index, "index out of bounds");
+  return m_batch->field(m_index, index);
+}
+
+Type Row_batch::Row::get_type(uint32_t index) const {
+  validate(index);
+  return m_batch->m_types[index];
+}
+
+bool Row_batch::Row::is_null(uint32_t index) const {
+  return m_batch->is_null(validate(index));
+}
+
+std::string Row_batch::Row::get_as_string(uint32_t index) const {
+  const auto field = validate(index);
+
+  if (m_batch->is_null(field)) return "NULL";
+
+  switch (m_batch->m_types[index]) {
+    case Type::Null:
+      return "NULL";
+
+    case Type::String:
+    case Type::Bytes:
+    case Type::Decimal:
+    case Type::Date:
+    case Type::DateTime:
+    case Type::Time:
+    case Type::Geometry:
+    case Type::Json:
+    case Type::Enum:
+    case Type::Set:
+    case Type::Bit: {
+      const auto data = m_batch->data(field);
+      return std::string(data.first, data.second);
+    }
+
+    case Type::Integer:
+      return std::to_string(m_batch->value<int64_t>(field));
+
+    case Type::UInteger:
+      return std::to_string(m_batch->value<uint64_t>(field));
+
+    case Type::Float:
+      return std::to_string(m_batch->value<float>(field));
+
+    case Type::Double:
+      return std::to_string(m_batch->value<double>(field));
+  }
+
+  throw std::invalid_argument("Unknown type in field");
+}
+
+int64_t Row_batch::Row::get_int(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::Integer ||
+                            ftype == Type::UInteger || ftype == Type::Decimal));
+
+  if (ftype == Type::UInteger) {
+    const auto u = m_batch->value<uint64_t>(field);
+
+    if (u > LLONG_MAX) {
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    }
+
+    return static_cast<int64_t>(u);
+  } else if (ftype == Type::Decimal) {
+    const auto dec = get_as_string(index);
+
+    if (dec.find('.') != std::string::npos) {
+      throw FIELD_ERROR1(index, "field type is %s", to_string(ftype).c_str());
+    }
+
+    return std::stoll(dec);
+  }
+
+  return m_batch->value<int64_t>(field);
+}
+
+uint64_t Row_batch::Row::get_uint(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::Integer ||
+                            ftype == Type::UInteger || ftype == Type::Decimal));
+
+  if (ftype == Type::Integer) {
+    const auto i = m_batch->value<int64_t>(field);
+
+    if (i < 0) {
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    }
+
+    return static_cast<uint64_t>(i);
+  } else if (ftype == Type::Decimal) {
+    const auto dec = get_as_string(index);
+
+    if (dec.find('.') != std::string::npos) {
+      throw FIELD_ERROR1(index, "field type is %s", to_string(ftype).c_str());
+    }
+
+    if (!dec.empty() && dec[0] == '-') {
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    }
+
+    return std::stoull(dec);
+  }
+
+  return m_batch->value<uint64_t>(field);
+}
+
+std::string Row_batch::Row::get_string(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (is_string_type(ftype)));
+  const auto data = m_batch->data(field);
+  return std::string(data.first, data.second);
+}
+
+std::pair<const char *, size_t> Row_batch::Row::get_string_data(
+    uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::String || ftype == Type::Bytes));
+  return m_batch->data(field);
+}
+
+void Row_batch::Row::get_raw_data(uint32_t index, const char **out_data,
+                                  size_t *out_size) const {
+  const auto field = validate(index);
+
+  if (m_batch->is_null(field)) {
+    *out_data = nullptr;
+    *out_size = 0;
+    return;
+  }
+
+  switch (m_batch->m_types[index]) {
+    case Type::Integer:
+    case Type::UInteger:
+    case Type::Float:
+    case Type::Double:
+      m_raw_data_cache = get_as_string(index);
+      *out_data = m_raw_data_cache.c_str();
+      *out_size = m_raw_data_cache.length();
+      break;
+
+    default:
+      std::tie(*out_data, *out_size) = m_batch->data(field);
+      break;
+  }
+}
+
+float Row_batch::Row::get_float(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::Float || ftype == Type::Decimal ||
+                            ftype == Type::Double));
+
+  switch (ftype) {
+    case Type::Decimal:
+      try {
+        return std::stof(get_as_string(index));
+      } catch (...) {
+        throw FIELD_ERROR(index, "float value out of the allowed range");
+      }
+
+    case Type::Double:
+      return static_cast<float>(m_batch->value<double>(field));
+
+    case Type::Float:
+      return m_batch->value<float>(field);
+
+    default:
+      throw std::logic_error("internal error");
+  }
+}
+
+double Row_batch::Row::get_double(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::Double || ftype == Type::Float ||
+                            ftype == Type::Decimal));
+
+  switch (ftype) {
+    case Type::Decimal:
+      try {
+        return std::stod(get_as_string(index));
+      } catch (...) {
+        throw FIELD_ERROR(index, "double value out of the allowed range");
+      }
+
+    case Type::Float:
+      return static_cast<double>(m_batch->value<float>(field));
+
+    case Type::Double:
+      return m_batch->value<double>(field);
+
+    default:
+      throw std::logic_error("internal error");
+  }
+}
+
+std::tuple<uint64_t, int> Row_batch::Row::get_bit(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::Bit));
+  const auto data = m_batch->data(field);
+  return shcore::string_to_bits({data.first, data.second});
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
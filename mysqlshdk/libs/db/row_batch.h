@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_ROW_BATCH_H_
+#define MYSQLSHDK_LIBS_DB_ROW_BATCH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/mysqlshdk_export.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row.h"
+
+namespace mysqlshdk {
+namespace db {
+
+/**
+ * A self-contained batch of rows which owns its own storage, like Row_copy,
+ * but in a compact form: data of all the fields is stored in a single arena,
+ * each field is described by its offset in the arena, NULL values are tracked
+ * in a bitmap. Copying a row into the batch does not allocate memory for each
+ * of its fields.
+ *
+ * All rows in a batch are expected to have the same field types. Rows are
+ * accessed through Row_batch::Row objects, which implement IRow and remain
+ * valid until the batch is cleared or destroyed.
+ */
+class SHCORE_PUBLIC Row_batch final {
+ public:
+  /**
+   * A row stored in a Row_batch.
+   */
+  class SHCORE_PUBLIC Row final : public IRow {
+   public:
+    Row(const Row_batch *batch, size_t index)
+        : m_batch(batch), m_index(index) {}
+
+    Row(const Row &) = delete;
+    Row(Row &&) = default;
+
+    Row &operator=(const Row &) = delete;
+    Row &operator=(Row &&) = default;
+
+    ~Row() override = default;
+
+    uint32_t num_fields() const override;
+
+    Type get_type(uint32_t index) const override;
+    bool is_null(uint32_t index) const override;
+    std::string get_as_string(uint32_t index) const override;
+
+    std::string get_string(uint32_t index) const override;
+    int64_t get_int(uint32_t index) const override;
+    uint64_t get_uint(uint32_t index) const override;
+    float get_float(uint32_t index) const override;
+    double get_double(uint32_t index) const override;
+    std::pair<const char *, size_t> get_string_data(
+        uint32_t index) const override;
+
+    /**
+     * Provides the data of the given field. Textual fields point into the
+     * storage of the batch. Numeric fields are converted to text, which is
+     * held by the row (like Row_copy does) and remains valid until the next
+     * call to this method on the same row.
+     */
+    void get_raw_data(uint32_t index, const char **out_data,
+                      size_t *out_size) const override;
+    std::tuple<uint64_t, int> get_bit(uint32_t index) const override;
+
+   private:
+    size_t validate(uint32_t index) const;
+
+    const Row_batch *m_batch;
+    size_t m_index;
+    // holds the result of the most recent get_raw_data() call on this row
+    mutable std::string m_raw_data_cache;
+  };
+
+  Row_batch() = default;
+
+  // rows hold a pointer to the batch
+  Row_batch(const Row_batch &) = delete;
+  Row_batch(Row_batch &&) = delete;
+
+  Row_batch &operator=(const Row_batch &) = delete;
+  Row_batch &operator=(Row_batch &&) = delete;
+
+  ~Row_batch() = default;
+
+  /**
+   * Copies the given row into the batch.
+   *
+   * @throws std::invalid_argument if number of fields does not match the rows
+   *         which were already stored
+   */
+  void append(const IRow &row);
+
+  /**
+   * Removes all rows, memory is kept to be reused.
+   */
+  void clear();
+
+  /**
+   * Releases the memory which is not used.
+   */
+  void shrink_to_fit();
+
+  size_t size() const { return m_rows.size(); }
+
+  bool empty() const { return m_rows.empty(); }
+
+  const Row &operator[](size_t index) const { return m_rows[index]; }
+
+  const Row &front() const { return m_rows.front(); }
+
+  const Row &back() const { return m_rows.back(); }
+
+  std::deque<Row>::const_iterator begin() const { return m_rows.begin(); }
+
+  std::deque<Row>::const_iterator end() const { return m_rows.end(); }
+
+  /**
+   * Number of bytes of field data stored in the batch.
+   */
+  size_t data_size() const { return m_arena.size(); }
+
+ private:
+  size_t field(size_t row, uint32_t index) const {
+    return row * m_types.size() + index;
+  }
+
+  bool is_null(size_t field) const {
+    return m_nulls[field / 64] & (UINT64_C(1) << (field % 64));
+  }
+
+  std::pair<const char *, size_t> data(size_t field) const {
+    return {m_arena.data() + m_offsets[field],
+            m_offsets[field + 1] - m_offsets[field]};
+  }
+
+  template <typename T>
+  T value(size_t field) const;
+
+  void append_fields(const IRow &row);
+
+  void append_data(const char *data, size_t length);
+
+  template <typename T>
+  void append_value(T value) {
+    append_data(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+
+  void append_null();
+
+  std::vector<Type> m_types;
+  // data of all fields
+  std::vector<char> m_arena;
+  // offsets of fields, field N is stored in range
+  // [m_offsets[N], m_offsets[N + 1]), NULL values are empty
+  std::vector<uint64_t> m_offsets{0};
+  // bit N is set if field N is NULL
+  std::vector<uint64_t> m_nulls;
+  // number of fields stored so far
+  size_t m_fields = 0;
+  std::deque<Row> m_rows;
+};
+
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_ROW_BATCH_H_
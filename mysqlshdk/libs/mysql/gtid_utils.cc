@@ -23,11 +23,221 @@
 
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 
-#include "mysqlshdk/libs/mysql/replication.h"
+#include <mysqld_error.h>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
 namespace mysql {
 
+namespace {
+
+using Interval = std::pair<uint64_t, uint64_t>;
+using Intervals = std::vector<Interval>;
+
+constexpr std::size_t k_uuid_length = 36;
+
+// transaction numbers are in range [1, 2^63 - 1)
+constexpr uint64_t k_max_gno = std::numeric_limits<int64_t>::max() - 1;
+
+// same error as reported by the server when it's given a malformed set
+[[noreturn]] void throw_malformed(std::string_view gtid_set) {
+  throw shcore::Exception("Malformed GTID set specification '" +
+                              std::string{gtid_set} + "'.",
+                          ER_MALFORMED_GTID_SET_SPECIFICATION);
+}
+
+std::string_view strip(std::string_view s) {
+  constexpr std::string_view k_whitespace = " \t\r\n";
+  const auto first = s.find_first_not_of(k_whitespace);
+
+  if (std::string_view::npos == first) return {};
+
+  return s.substr(first, s.find_last_not_of(k_whitespace) - first + 1);
+}
+
+bool is_uuid(std::string_view s) {
+  if (k_uuid_length != s.size()) return false;
+
+  for (std::size_t i = 0; i < s.size(); ++i) {
+    if (8 == i || 13 == i || 18 == i || 23 == i) {
+      if ('-' != s[i]) return false;
+    } else if (!std::isxdigit(static_cast<unsigned char>(s[i]))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool is_tag(std::string_view s) {
+  // same rules as used by the server
+  if (s.empty() || s.size() > 32 ||
+      std::isdigit(static_cast<unsigned char>(s[0]))) {
+    return false;
+  }
+
+  return std::all_of(s.begin(), s.end(), [](char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || '_' == c;
+  });
+}
+
+bool parse_gno(std::string_view s, uint64_t *gno) {
+  const auto end = s.data() + s.size();
+  const auto result = std::from_chars(s.data(), end, *gno);
+  return std::errc{} == result.ec && end == result.ptr && *gno >= 1 &&
+         *gno <= k_max_gno;
+}
+
+bool parse_interval(std::string_view s, Interval *interval) {
+  if (const auto p = s.find('-'); std::string_view::npos == p) {
+    if (!parse_gno(s, &interval->first)) return false;
+    interval->second = interval->first;
+  } else {
+    if (!parse_gno(strip(s.substr(0, p)), &interval->first) ||
+        !parse_gno(strip(s.substr(p + 1)), &interval->second)) {
+      return false;
+    }
+  }
+
+  return interval->first <= interval->second;
+}
+
+/**
+ * Converts UUID or UUID:tag to the form used as a key.
+ */
+std::string normalize_key(std::string_view key) {
+  const auto p = key.find(':');
+  const auto uuid = strip(key.substr(0, p));
+
+  if (!is_uuid(uuid)) throw_malformed(key);
+
+  auto result = shcore::str_lower(uuid);
+
+  if (std::string_view::npos != p) {
+    const auto tag = strip(key.substr(p + 1));
+
+    if (!is_tag(tag)) throw_malformed(key);
+
+    result += ':';
+    result += shcore::str_lower(tag);
+  }
+
+  return result;
+}
+
+void coalesce(Intervals *intervals) {
+  if (intervals->empty()) return;
+
+  std::sort(intervals->begin(), intervals->end());
+
+  auto last = intervals->begin();
+
+  for (auto it = last + 1; it != intervals->end(); ++it) {
+    if (it->first <= last->second + 1) {
+      last->second = std::max(last->second, it->second);
+    } else {
+      *++last = *it;
+    }
+  }
+
+  intervals->erase(last + 1, intervals->end());
+}
+
+Intervals unite(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  result.reserve(a.size() + b.size());
+
+  std::merge(a.begin(), a.end(), b.begin(), b.end(),
+             std::back_inserter(result));
+  coalesce(&result);
+
+  return result;
+}
+
+Intervals subtract(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  auto other = b.begin();
+
+  for (auto current : a) {
+    // skip intervals which end before the current one
+    while (other != b.end() && other->second < current.first) ++other;
+
+    for (auto it = other; it != b.end() && it->first <= current.second;
+         ++it) {
+      if (it->first > current.first) {
+        result.emplace_back(current.first, it->first - 1);
+      }
+
+      if (it->second >= current.second) {
+        current.first = current.second + 1;
+        break;
+      }
+
+      current.first = it->second + 1;
+    }
+
+    if (current.first <= current.second) result.emplace_back(current);
+  }
+
+  return result;
+}
+
+Intervals intersect(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  auto lhs = a.begin();
+  auto rhs = b.begin();
+
+  while (lhs != a.end() && rhs != b.end()) {
+    const auto first = std::max(lhs->first, rhs->first);
+    const auto last = std::min(lhs->second, rhs->second);
+
+    if (first <= last) result.emplace_back(first, last);
+
+    if (lhs->second < rhs->second) {
+      ++lhs;
+    } else {
+      ++rhs;
+    }
+  }
+
+  return result;
+}
+
+bool contains(const Intervals &a, const Intervals &b) {
+  auto lhs = a.begin();
+
+  for (const auto &interval : b) {
+    while (lhs != a.end() && lhs->second < interval.first) ++lhs;
+
+    // intervals are coalesced, the whole interval needs to fit into a single
+    // interval
+    if (lhs == a.end() || lhs->first > interval.first ||
+        lhs->second < interval.second) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void append_gno(uint64_t gno, std::string *out) {
+  char buffer[std::numeric_limits<uint64_t>::digits10 + 1];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), gno);
+  out->append(buffer, result.ptr);
+}
+
+}  // namespace
+
 std::string to_string(const Gtid_range &range) {
   if (std::get<1>(range) == std::get<2>(range))
     return std::get<0>(range) + ":" + std::to_string(std::get<1>(range));
@@ -40,67 +250,137 @@ uint64_t count(const Gtid_range &range) {
   return std::get<2>(range) - std::get<1>(range) + 1;
 }
 
-Gtid_set &Gtid_set::normalize(const mysqlshdk::mysql::IInstance &server) {
-  if (!m_normalized) {
-    m_normalized = true;
-    m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, '')",
-                                          m_gtid_set);
+Gtid_set Gtid_set::from_string(const std::string &gtid_set) {
+  Gtid_set result;
+  std::string_view text{gtid_set};
+
+  while (!text.empty()) {
+    const auto comma = text.find(',');
+    const auto entry = strip(text.substr(0, comma));
+
+    text = std::string_view::npos == comma ? std::string_view{}
+                                           : text.substr(comma + 1);
+
+    // server ignores empty entries
+    if (entry.empty()) continue;
+
+    auto colon = entry.find(':');
+
+    if (std::string_view::npos == colon) throw_malformed(entry);
+
+    const auto uuid = strip(entry.substr(0, colon));
+
+    if (!is_uuid(uuid)) throw_malformed(entry);
+
+    std::string key = shcore::str_lower(uuid);
+    Intervals *intervals = nullptr;
+
+    while (std::string_view::npos != colon) {
+      const auto next = entry.find(':', colon + 1);
+      const auto token = strip(entry.substr(colon + 1, next - colon - 1));
+
+      if (!token.empty() &&
+          std::isdigit(static_cast<unsigned char>(token[0]))) {
+        Interval interval;
+
+        if (!parse_interval(token, &interval)) throw_malformed(entry);
+
+        if (!intervals) intervals = &result.m_sets[key];
+
+        intervals->emplace_back(interval);
+      } else if (is_tag(token)) {
+        // intervals which follow belong to the tagged set
+        key = shcore::str_lower(uuid);
+        key += ':';
+        key += shcore::str_lower(token);
+        intervals = nullptr;
+      } else {
+        throw_malformed(entry);
+      }
+
+      colon = next;
+    }
   }
-  return *this;
+
+  for (auto &set : result.m_sets) {
+    coalesce(&set.second);
+  }
+
+  return result;
 }
 
-Gtid_set &Gtid_set::intersect(const Gtid_set &other,
-                              const mysqlshdk::mysql::IInstance &server) {
-  // a /\ b = a - (a - b)
-  m_gtid_set = server.queryf_one_string(
-      0, "", "SELECT gtid_subtract(?, gtid_subtract(?, ?))", other.m_gtid_set,
-      other.m_gtid_set, m_gtid_set);
+void Gtid_set::add(const std::string &uuid, const Intervals &intervals) {
+  if (intervals.empty()) return;
 
-  return *this;
+  auto &target = m_sets[uuid];
+  target = target.empty() ? intervals : unite(target, intervals);
 }
 
-Gtid_set &Gtid_set::subtract(const Gtid_set &other,
-                             const mysqlshdk::mysql::IInstance &server) {
-  m_normalized = true;
-  m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, ?)",
-                                        m_gtid_set, other.m_gtid_set);
+Gtid_set &Gtid_set::intersect(const Gtid_set &other) {
+  for (auto it = m_sets.begin(); it != m_sets.end();) {
+    const auto o = other.m_sets.find(it->first);
+
+    if (other.m_sets.end() != o) {
+      it->second = mysql::intersect(it->second, o->second);
+    } else {
+      it->second.clear();
+    }
+
+    if (it->second.empty()) {
+      it = m_sets.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
   return *this;
 }
 
-Gtid_set &Gtid_set::add(const Gtid &gtid) {
-  if (m_gtid_set.empty()) {
-    m_normalized = true;
-    m_gtid_set = gtid;
-  } else {
-    m_normalized = false;
-    m_gtid_set += "," + gtid;
+Gtid_set &Gtid_set::subtract(const Gtid_set &other) {
+  if (this == &other) {
+    m_sets.clear();
+    return *this;
+  }
+
+  for (const auto &o : other.m_sets) {
+    const auto it = m_sets.find(o.first);
+
+    if (m_sets.end() == it) continue;
+
+    it->second = mysql::subtract(it->second, o.second);
+
+    if (it->second.empty()) m_sets.erase(it);
   }
 
   return *this;
 }
 
+Gtid_set &Gtid_set::add(const Gtid &gtid) {
+  return add(from_string(gtid));
+}
+
 Gtid_set &Gtid_set::add(const Gtid_set &other) {
-  if (m_gtid_set.empty()) {
-    m_normalized = other.m_normalized;
-    m_gtid_set = other.m_gtid_set;
-  } else if (other.m_gtid_set.empty()) {
+  if (m_sets.empty()) {
+    m_sets = other.m_sets;
   } else {
-    m_normalized = false;
-    m_gtid_set += "," + other.m_gtid_set;
+    for (const auto &o : other.m_sets) {
+      add(o.first, o.second);
+    }
   }
 
   return *this;
 }
 
 Gtid_set &Gtid_set::add(const Gtid_range &range) {
-  if (m_gtid_set.empty()) {
-    m_normalized = true;
-    m_gtid_set = to_string(range);
-  } else {
-    m_normalized = false;
-    m_gtid_set += "," + to_string(range);
+  Interval interval{std::get<1>(range), std::get<2>(range)};
+
+  if (interval.first < 1 || interval.first > interval.second ||
+      interval.second > k_max_gno) {
+    throw_malformed(to_string(range));
   }
 
+  add(normalize_key(std::get<0>(range)), Intervals{interval});
+
   return *this;
 }
 
@@ -108,34 +388,71 @@ Gtid_set Gtid_set::get_gtids_from(const std::string &uuid) const {
   mysqlshdk::mysql::Gtid_set matches;
 
   if (!uuid.empty()) {
-    enumerate_ranges(
-        [&matches, &uuid](const mysqlshdk::mysql::Gtid_range &range) {
-          if (std::get<0>(range) == uuid) {
-            matches.add(range);
-          }
-        });
+    if (const auto it = m_sets.find(shcore::str_lower(uuid));
+        m_sets.end() != it) {
+      matches.m_sets.emplace(*it);
+    }
   }
 
   return matches;
 }
 
-bool Gtid_set::contains(const Gtid_set &other,
-                        const mysqlshdk::mysql::IInstance &server) const {
-  return server.queryf_one_int(0, 0, "SELECT gtid_subtract(?, ?) = ''",
-                               other.m_gtid_set, m_gtid_set) != 0;
+bool Gtid_set::contains(const Gtid_set &other) const {
+  for (const auto &o : other.m_sets) {
+    const auto it = m_sets.find(o.first);
+
+    if (m_sets.end() == it || !mysql::contains(it->second, o.second)) {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 uint64_t Gtid_set::count() const {
-  if (!m_normalized)
-    throw std::invalid_argument("Can't get count of un-normalized Gtid_set");
-
   uint64_t count = 0;
-  enumerate_ranges([&count](const Gtid_range &range) {
-    count += mysqlshdk::mysql::count(range);
-  });
+
+  for (const auto &set : m_sets) {
+    for (const auto &interval : set.second) {
+      count += interval.second - interval.first + 1;
+    }
+  }
+
   return count;
 }
 
+std::string Gtid_set::str() const {
+  // same format as used by the server: UUID:intervals:tag:intervals,\nUUID...
+  std::string result;
+  std::string_view previous_uuid;
+
+  for (const auto &set : m_sets) {
+    const auto uuid = std::string_view{set.first}.substr(0, k_uuid_length);
+
+    if (uuid != previous_uuid) {
+      if (!result.empty()) result += ",\n";
+
+      result += uuid;
+      previous_uuid = uuid;
+    }
+
+    // append the tag, including the separator
+    result += std::string_view{set.first}.substr(k_uuid_length);
+
+    for (const auto &interval : set.second) {
+      result += ':';
+      append_gno(interval.first, &result);
+
+      if (interval.first != interval.second) {
+        result += '-';
+        append_gno(interval.second, &result);
+      }
+    }
+  }
+
+  return result;
+}
+
 void Gtid_set::enumerate(const std::function<void(const Gtid &)> &fn) const {
   enumerate_ranges([&fn](const Gtid_range &range) {
     std::string prefix = std::get<0>(range) + ":";
@@ -146,36 +463,11 @@ void Gtid_set::enumerate(const std::function<void(const Gtid &)> &fn) const {
 
 void Gtid_set::enumerate_ranges(
     const std::function<void(const Gtid_range &)> &fn) const {
-  if (!m_normalized)
-    throw std::invalid_argument("Can't enumerate un-normalized Gtid_set");
-
-  shcore::str_itersplit(
-      m_gtid_set,
-      [&fn](const std::string &s) {
-        if (const auto p = s.find(':'); p != std::string::npos) {
-          const auto offs = (s.front() == '\n') ? 1 : 0;
-          // strip \n from previous range as in range,\nrange
-          const auto prefix = s.substr(offs, p - offs);
-
-          shcore::str_itersplit(
-              s.substr(p + 1),
-              [&fn, &prefix](const std::string &ss) {
-                uint64_t begin, end;
-                switch (sscanf(&ss[0], "%" PRIu64 "-%" PRIu64, &begin, &end)) {
-                  case 2:
-                    fn(std::make_tuple(Gtid(prefix), begin, end));
-                    break;
-                  case 1:
-                    fn(std::make_tuple(Gtid(prefix), begin, begin));
-                    break;
-                }
-                return true;
-              },
-              ":");
-        }
-        return true;
-      },
-      ",");
+  for (const auto &set : m_sets) {
+    for (const auto &interval : set.second) {
+      fn(std::make_tuple(Gtid(set.first), interval.first, interval.second));
+    }
+  }
 }
 
 }  // namespace mysql
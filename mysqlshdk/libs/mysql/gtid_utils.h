@@ -24,9 +24,13 @@
 #ifndef MYSQLSHDK_LIBS_MYSQL_GTID_UTILS_H_
 #define MYSQLSHDK_LIBS_MYSQL_GTID_UTILS_H_
 
+#include <cstdint>
 #include <functional>
+#include <map>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/mysql/instance.h"
 
@@ -39,91 +43,95 @@ using Gtid_range = std::tuple<std::string, uint64_t, uint64_t>;
 std::string to_string(const Gtid_range &range);
 uint64_t count(const Gtid_range &range);
 
+/**
+ * A set of GTIDs, held as a sorted map of UUIDs (or UUID:tag pairs) to the
+ * sorted and coalesced intervals of transaction numbers. All operations are
+ * executed locally, without contacting the server.
+ *
+ * The text representation is the same as the one used by the server, text
+ * produced by the server is parsed and written back without any changes.
+ */
 class Gtid_set {
  public:
-  Gtid_set() : m_normalized(true) {}
+  Gtid_set() = default;
 
-  explicit Gtid_set(const Gtid_range &range) : m_normalized(true) {
-    add(range);
-  }
+  explicit Gtid_set(const Gtid_range &range) { add(range); }
 
-  static Gtid_set from_string(const std::string &gtid_set) {
-    return Gtid_set(gtid_set, false);
-  }
+  /**
+   * Parses the given text, which uses the same syntax as the GTID sets
+   * accepted by the server.
+   *
+   * @throws shcore::Exception (ER_MALFORMED_GTID_SET_SPECIFICATION) if the
+   *         text is malformed
+   */
+  static Gtid_set from_string(const std::string &gtid_set);
 
   static Gtid_set from_normalized_string(const std::string &gtid_set) {
-    return Gtid_set(gtid_set, true);
+    return from_string(gtid_set);
   }
 
   static Gtid_set from_gtid_executed(
       const mysqlshdk::mysql::IInstance &server) {
-    return Gtid_set(
-        server.queryf_one_string(0, "", "select @@global.gtid_executed"), true);
+    return from_string(
+        server.queryf_one_string(0, "", "select @@global.gtid_executed"));
   }
 
   static Gtid_set from_gtid_purged(const mysqlshdk::mysql::IInstance &server) {
-    return Gtid_set(
-        server.queryf_one_string(0, "", "select @@global.gtid_purged"), true);
+    return from_string(
+        server.queryf_one_string(0, "", "select @@global.gtid_purged"));
   }
 
   static Gtid_set from_received_transaction_set(
       const mysqlshdk::mysql::IInstance &server, const std::string &channel) {
-    return Gtid_set(server.queryf_one_string(
-                        0, "",
-                        "select received_transaction_set"
-                        " from performance_schema.replication_connection_status"
-                        " where channel_name=?",
-                        channel),
-                    true);
+    return from_string(server.queryf_one_string(
+        0, "",
+        "select received_transaction_set"
+        " from performance_schema.replication_connection_status"
+        " where channel_name=?",
+        channel));
   }
 
-  Gtid_set &normalize(const mysqlshdk::mysql::IInstance &server);
-
-  Gtid_set &subtract(const Gtid_set &other,
-                     const mysqlshdk::mysql::IInstance &server);
+  Gtid_set &subtract(const Gtid_set &other);
   Gtid_set &add(const Gtid &gtid);
   Gtid_set &add(const Gtid_set &other);
   Gtid_set &add(const Gtid_range &gtids);
 
-  Gtid_set &intersect(const Gtid_set &other,
-                      const mysqlshdk::mysql::IInstance &server);
+  Gtid_set &intersect(const Gtid_set &other);
 
   Gtid_set get_gtids_from(const std::string &uuid) const;
 
-  bool contains(const Gtid_set &other,
-                const mysqlshdk::mysql::IInstance &server) const;
+  bool contains(const Gtid_set &other) const;
 
   void enumerate(const std::function<void(const Gtid &)> &fn) const;
 
   void enumerate_ranges(
       const std::function<void(const Gtid_range &)> &fn) const;
 
-  bool empty() const { return m_gtid_set.empty(); }
+  bool empty() const { return m_sets.empty(); }
 
   uint64_t count() const;
 
-  operator std::string() const { return m_gtid_set; }
+  operator std::string() const { return str(); }
 
-  inline const std::string &str() const { return m_gtid_set; }
+  std::string str() const;
 
   bool operator==(const Gtid_set &other) const {
-    if (!m_normalized || !other.m_normalized)
-      throw std::invalid_argument("Can't compare un-normalized Gtid_set");
-    return m_gtid_set == other.m_gtid_set;
+    return m_sets == other.m_sets;
   }
 
   bool operator!=(const Gtid_set &other) const {
-    if (!m_normalized || !other.m_normalized)
-      throw std::invalid_argument("Can't compare un-normalized Gtid_set");
-    return m_gtid_set != other.m_gtid_set;
+    return m_sets != other.m_sets;
   }
 
  private:
-  std::string m_gtid_set;
-  bool m_normalized;
+  // closed interval of transaction numbers
+  using Interval = std::pair<uint64_t, uint64_t>;
+  using Intervals = std::vector<Interval>;
+
+  void add(const std::string &uuid, const Intervals &intervals);
 
-  Gtid_set(const std::string &gtid_set, bool normalized)
-      : m_gtid_set(gtid_set), m_normalized(normalized) {}
+  // UUID or UUID:tag -> sorted, non-adjacent intervals
+  std::map<std::string, Intervals> m_sets;
 };
 
 // TODO(alfredo) move pure gtid related functions from replication.h
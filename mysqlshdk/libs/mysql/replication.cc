@@ -827,34 +827,21 @@ std::string get_total_gtid_set(
           "))), '')");
 }
 
-Gtid_set_relation compare_gtid_sets(const mysqlshdk::mysql::IInstance &server,
-                                    const std::string &gtidset_a,
+Gtid_set_relation compare_gtid_sets(const std::string &gtidset_a,
                                     const std::string &gtidset_b,
                                     std::string *out_missing_from_a,
                                     std::string *out_missing_from_b) {
-  if (out_missing_from_a) *out_missing_from_a = gtidset_b;
-  if (out_missing_from_b) *out_missing_from_b = gtidset_a;
+  const auto a = Gtid_set::from_string(gtidset_a);
+  const auto b = Gtid_set::from_string(gtidset_b);
 
-  if (gtidset_a.empty()) {
-    if (gtidset_b.empty())
-      return Gtid_set_relation::EQUAL;
-    else
-      return Gtid_set_relation::CONTAINED;
-  } else if (gtidset_b.empty()) {
-    return Gtid_set_relation::CONTAINS;
-  }
+  auto a_sub_b = a;
+  a_sub_b.subtract(b);
 
-  // Set some session tempvars for caching
-  server.executef("SET @gtidset_a=?", gtidset_a);
-  server.executef("SET @gtidset_b=?", gtidset_b);
+  auto b_sub_a = b;
+  b_sub_a.subtract(a);
 
-  std::string a_sub_b = server.queryf_one_string(
-      0, "", "SELECT GTID_SUBTRACT(@gtidset_a, @gtidset_b)");
-  std::string b_sub_a = server.queryf_one_string(
-      0, "", "SELECT GTID_SUBTRACT(@gtidset_b, @gtidset_a)");
-
-  if (out_missing_from_a) *out_missing_from_a = b_sub_a;
-  if (out_missing_from_b) *out_missing_from_b = a_sub_b;
+  if (out_missing_from_a) *out_missing_from_a = b_sub_a.str();
+  if (out_missing_from_b) *out_missing_from_b = a_sub_b.str();
 
   if (a_sub_b.empty() && b_sub_a.empty()) {
     return Gtid_set_relation::EQUAL;
@@ -863,10 +850,9 @@ Gtid_set_relation compare_gtid_sets(const mysqlshdk::mysql::IInstance &server,
   } else if (!a_sub_b.empty() && b_sub_a.empty()) {
     return Gtid_set_relation::CONTAINS;
   } else {
-    std::string ab_intersection =
-        server.queryf_one_string(0, "",
-                                 "SELECT GTID_SUBTRACT(@gtidset_a, "
-                                 "GTID_SUBTRACT(@gtidset_a, @gtidset_b))");
+    auto ab_intersection = a;
+    ab_intersection.intersect(b);
+
     if (ab_intersection.empty())
       return Gtid_set_relation::DISJOINT;
     else
@@ -891,7 +877,6 @@ std::string to_string(Replica_gtid_state state) {
 }
 
 void compute_joining_replica_gtid_state(
-    const mysqlshdk::mysql::IInstance &instance,
     const mysqlshdk::mysql::Gtid_set &primary_gtids,
     const std::vector<mysqlshdk::mysql::Gtid_set> &purged_gtids,
     const mysqlshdk::mysql::Gtid_set &joiner_gtids,
@@ -911,32 +896,30 @@ void compute_joining_replica_gtid_state(
     auto gtids = purged_gtids.begin();
     completely_purged_gtids = *gtids;
     for (++gtids; gtids != purged_gtids.end(); ++gtids) {
-      completely_purged_gtids.intersect(*gtids, instance);
+      completely_purged_gtids.intersect(*gtids);
     }
   }
 
   // compute missing and errant trxs
   *out_missing_gtids = primary_gtids;
-  out_missing_gtids->subtract(joiner_gtids, instance);
+  out_missing_gtids->subtract(joiner_gtids);
 
   *out_errant_gtids = joiner_gtids;
-  out_errant_gtids->subtract(primary_gtids, instance);
+  out_errant_gtids->subtract(primary_gtids);
 
   // from the missing trxs, check what's non-recoverable
   *out_unrecoverable_gtids = *out_missing_gtids;
-  out_unrecoverable_gtids->intersect(completely_purged_gtids, instance);
+  out_unrecoverable_gtids->intersect(completely_purged_gtids);
 
   // missing gtids that are recoverable
-  out_missing_gtids->subtract(*out_unrecoverable_gtids, instance);
+  out_missing_gtids->subtract(*out_unrecoverable_gtids);
 
   // from the errant trxs, check what's allowed (e.g. VCLEs)
   *out_allowed_errant_gtids = Gtid_set();
   for (const auto &uuid : allowed_errant_uuids) {
     out_allowed_errant_gtids->add(out_errant_gtids->get_gtids_from(uuid));
   }
-  out_allowed_errant_gtids->normalize(instance);
-
-  out_errant_gtids->subtract(*out_allowed_errant_gtids, instance);
+  out_errant_gtids->subtract(*out_allowed_errant_gtids);
 }
 
 Replica_gtid_state check_replica_gtid_state(
@@ -947,13 +930,11 @@ Replica_gtid_state check_replica_gtid_state(
   auto master_gtid = get_executed_gtid_set(master);
   auto master_purged_gtid = get_purged_gtid_set(master);
 
-  return check_replica_gtid_state(master, master_gtid, master_purged_gtid,
-                                  slave_gtid, out_missing_gtids,
-                                  out_errant_gtids);
+  return check_replica_gtid_state(master_gtid, master_purged_gtid, slave_gtid,
+                                  out_missing_gtids, out_errant_gtids);
 }
 
 Replica_gtid_state check_replica_gtid_state(
-    const mysqlshdk::mysql::IInstance &instance,
     const std::string &master_gtidset, const std::string &master_purged_gtidset,
     const std::string &slave_gtidset, std::string *out_missing_gtids,
     std::string *out_errant_gtids) {
@@ -968,9 +949,8 @@ Replica_gtid_state check_replica_gtid_state(
     return Replica_gtid_state::NEW;
   }
 
-  Gtid_set_relation rel =
-      compare_gtid_sets(instance, master_gtidset, slave_gtidset,
-                        out_errant_gtids, out_missing_gtids);
+  Gtid_set_relation rel = compare_gtid_sets(
+      master_gtidset, slave_gtidset, out_errant_gtids, out_missing_gtids);
 
   switch (rel) {
     case Gtid_set_relation::INTERSECTS:
@@ -985,11 +965,8 @@ Replica_gtid_state check_replica_gtid_state(
       // If purged has more gtids than the executed on the slave
       // it means some data will not be recoverable
       if (master_purged_gtidset.empty() ||
-          instance
-              .queryf("SELECT GTID_SUBTRACT(?, ?) = ''", master_purged_gtidset,
-                      slave_gtidset)
-              ->fetch_one_or_throw()
-              ->get_int(0)) {
+          Gtid_set::from_string(slave_gtidset)
+              .contains(Gtid_set::from_string(master_purged_gtidset))) {
         return Replica_gtid_state::RECOVERABLE;
       } else {
         return Replica_gtid_state::IRRECOVERABLE;
@@ -305,7 +305,6 @@ std::string get_total_gtid_set(
 size_t estimate_gtid_set_size(const std::string &gtid_set);
 
 void compute_joining_replica_gtid_state(
-    const mysqlshdk::mysql::IInstance &instance,
     const mysqlshdk::mysql::Gtid_set &primary_gtids,
     const std::vector<mysqlshdk::mysql::Gtid_set> &purged_gtids,
     const mysqlshdk::mysql::Gtid_set &joiner_gtids,
@@ -323,8 +322,7 @@ enum class Gtid_set_relation {
   DISJOINT     // nothing in common
 };
 
-Gtid_set_relation compare_gtid_sets(const mysqlshdk::mysql::IInstance &server,
-                                    const std::string &gtidset_a,
+Gtid_set_relation compare_gtid_sets(const std::string &gtidset_a,
                                     const std::string &gtidset_b,
                                     std::string *out_missing_from_a = nullptr,
                                     std::string *out_missing_from_b = nullptr);
@@ -350,7 +348,6 @@ Replica_gtid_state check_replica_gtid_state(
     std::string *out_errant_gtids = nullptr);
 
 Replica_gtid_state check_replica_gtid_state(
-    const mysqlshdk::mysql::IInstance &instance,
     const std::string &master_gtidset, const std::string &master_purged_gtidset,
     const std::string &slave_gtidset, std::string *out_missing_gtids = nullptr,
     std::string *out_errant_gtids = nullptr);
@@ -23,8 +23,12 @@
 
 #include "mysqlshdk/libs/storage/backend/object_storage.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
 #include <iterator>
 
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/rest/error_codes.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 
@@ -164,6 +168,11 @@ Object::Object(const Config_ptr &config, const std::string &name,
       m_prefix(prefix),
       m_container(config->container()),
       m_max_part_size(config->part_size()),
+      m_parallel_uploads(config->parallel_uploads()),
+      m_upload_memory_limit(config->upload_memory_limit()),
+      m_parallel_downloads(config->parallel_downloads()),
+      m_download_chunk_size(config->download_chunk_size()),
+      m_download_memory_limit(config->download_memory_limit()),
       m_writer{},
       m_reader{} {}
 
@@ -172,6 +181,16 @@ void Object::set_max_part_size(size_t new_size) {
   m_max_part_size = new_size;
 }
 
+void Object::set_parallel_uploads(size_t count) {
+  assert(!is_open());
+  m_parallel_uploads = count;
+}
+
+void Object::set_parallel_downloads(size_t count) {
+  assert(!is_open());
+  m_parallel_downloads = count;
+}
+
 void Object::open(storage::Mode mode) {
   switch (mode) {
     case Mode::READ:
@@ -386,12 +405,18 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
       incoming_offset += MY_MAX_PART_SIZE;
     }
 
-    try {
-      m_parts.push_back(m_object->m_container->upload_part(
-          m_multipart, m_parts.size() + 1, part, MY_MAX_PART_SIZE));
-    } catch (const rest::Response_error &error) {
-      abort_multipart_upload("failure uploading part", error.format());
-      throw rest::to_exception(error);
+    if (is_pipelined()) {
+      std::string data;
+
+      if (part == m_buffer.data()) {
+        data = std::move(m_buffer);
+      } else {
+        data.assign(part, MY_MAX_PART_SIZE);
+      }
+
+      queue_part(std::move(data));
+    } else {
+      upload_part(part, MY_MAX_PART_SIZE);
     }
 
     m_buffer.clear();
@@ -412,9 +437,17 @@ void Object::Writer::close() {
   if (m_is_multipart) {
     // MULTIPART UPLOAD STARTED: Sends last part if any and commits the upload
     try {
-      if (!m_buffer.empty()) {
-        m_parts.push_back(m_object->m_container->upload_part(
-            m_multipart, m_parts.size() + 1, m_buffer.data(), m_buffer.size()));
+      if (is_pipelined()) {
+        if (!m_buffer.empty()) {
+          queue_part(std::move(m_buffer));
+          m_buffer.clear();
+        }
+
+        // all parts need to be uploaded before the upload is committed
+        wait_for_uploads();
+        stop_upload_threads();
+      } else if (!m_buffer.empty()) {
+        upload_part(m_buffer.data(), m_buffer.size());
       }
 
       m_object->m_container->commit_multipart_upload(m_multipart, m_parts);
@@ -444,6 +477,8 @@ void Object::Writer::close() {
 
 void Object::Writer::reset() {
   // clean up
+  stop_upload_threads();
+
   m_is_multipart = false;
   m_buffer.clear();
   m_parts.clear();
@@ -480,6 +515,182 @@ void Object::Writer::abort_multipart_upload(const char *context,
   }
 }
 
+void Object::Writer::upload_part(const char *data, std::size_t size) {
+  try {
+    m_parts.push_back(m_object->m_container->upload_part(
+        m_multipart, m_parts.size() + 1, data, size));
+  } catch (const rest::Response_error &error) {
+    abort_multipart_upload("failure uploading part", error.format());
+    throw rest::to_exception(error);
+  }
+}
+
+void Object::Writer::queue_part(std::string &&data) {
+  rethrow_upload_error();
+
+  if (m_upload_threads.empty()) {
+    for (std::size_t i = 0; i < m_object->m_parallel_uploads; ++i) {
+      m_upload_threads.emplace_back(
+          mysqlsh::spawn_scoped_thread([this]() { upload_queued_parts(); }));
+    }
+  }
+
+  const auto size = data.size();
+  const auto memory_limit = m_object->m_upload_memory_limit;
+
+  {
+    std::unique_lock lock(m_upload_mutex);
+
+    // wait until there's room for another part, at least one part is always
+    // allowed, even if it does not fit within the memory limit
+    m_part_uploaded.wait(lock, [this, size, memory_limit]() {
+      return m_upload_error || 0 == m_parts_in_flight ||
+             (m_parts_in_flight < m_object->m_parallel_uploads &&
+              (0 == memory_limit || m_bytes_in_flight + size <= memory_limit));
+    });
+
+    if (!m_upload_error) {
+      // reserve the slot for this part, so that the parts are in order
+      Pending_part part;
+      part.index = m_parts.size();
+      part.data = std::move(data);
+
+      m_parts.emplace_back();
+      m_parts.back().part_num = part.index + 1;
+
+      ++m_parts_in_flight;
+      m_bytes_in_flight += size;
+      m_pending_parts.emplace_back(std::move(part));
+    }
+  }
+
+  m_part_queued.notify_one();
+
+  rethrow_upload_error();
+}
+
+void Object::Writer::upload_queued_parts() {
+  // REST services cannot be shared between threads, each thread is using its
+  // own container
+  const auto container = m_object->m_container->config()->container();
+
+  while (true) {
+    Pending_part part;
+
+    {
+      std::unique_lock lock(m_upload_mutex);
+
+      m_part_queued.wait(lock, [this]() {
+        return m_stop_uploads || !m_pending_parts.empty();
+      });
+
+      if (m_pending_parts.empty()) {
+        return;
+      }
+
+      part = std::move(m_pending_parts.front());
+      m_pending_parts.pop_front();
+
+      if (m_upload_error) {
+        // upload has already failed, this part is not going to be used
+        --m_parts_in_flight;
+        m_bytes_in_flight -= part.data.size();
+        m_part_uploaded.notify_all();
+        continue;
+      }
+    }
+
+    Multipart_object_part uploaded;
+    std::exception_ptr error;
+
+    try {
+      uploaded = container->upload_part(m_multipart, part.index + 1,
+                                        part.data.data(), part.data.size());
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    {
+      std::lock_guard lock(m_upload_mutex);
+
+      if (error) {
+        if (!m_upload_error) {
+          m_upload_error = std::move(error);
+        }
+      } else {
+        m_parts[part.index] = std::move(uploaded);
+      }
+
+      --m_parts_in_flight;
+      m_bytes_in_flight -= part.data.size();
+    }
+
+    m_part_uploaded.notify_all();
+  }
+}
+
+void Object::Writer::wait_for_uploads() {
+  {
+    std::unique_lock lock(m_upload_mutex);
+    m_part_uploaded.wait(lock, [this]() { return 0 == m_parts_in_flight; });
+  }
+
+  rethrow_upload_error();
+}
+
+void Object::Writer::stop_upload_threads() {
+  if (m_upload_threads.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard lock(m_upload_mutex);
+
+    m_stop_uploads = true;
+
+    for (const auto &part : m_pending_parts) {
+      --m_parts_in_flight;
+      m_bytes_in_flight -= part.data.size();
+    }
+
+    m_pending_parts.clear();
+  }
+
+  m_part_queued.notify_all();
+
+  for (auto &thread : m_upload_threads) {
+    thread.join();
+  }
+
+  m_upload_threads.clear();
+
+  std::lock_guard lock(m_upload_mutex);
+  m_stop_uploads = false;
+}
+
+void Object::Writer::rethrow_upload_error() {
+  std::exception_ptr error;
+
+  {
+    std::lock_guard lock(m_upload_mutex);
+    std::swap(error, m_upload_error);
+  }
+
+  if (!error) {
+    return;
+  }
+
+  try {
+    std::rethrow_exception(error);
+  } catch (const rest::Response_error &e) {
+    abort_multipart_upload("failure uploading part", e.format());
+    throw rest::to_exception(e);
+  } catch (const std::exception &e) {
+    abort_multipart_upload("failure uploading part", e.what());
+    throw;
+  }
+}
+
 Object::Reader::Reader(Object *owner) : File_handler(owner), m_offset(0) {
   try {
     m_size = m_object->m_container->head_object(m_object->full_path().real());
@@ -497,8 +708,21 @@ Object::Reader::Reader(Object *owner) : File_handler(owner), m_offset(0) {
   } catch (const rest::Connection_error &error) {
     throw shcore::Exception::runtime_error(error.what());
   }
+
+  if (is_prefetching()) {
+    m_max_chunks = m_object->m_parallel_downloads;
+
+    if (const auto limit = m_object->m_download_memory_limit; limit > 0) {
+      // validated by Config::set_download_chunk_size()
+      assert(m_object->m_download_chunk_size > 0);
+      m_max_chunks = std::max<std::size_t>(
+          1, std::min(m_max_chunks, limit / m_object->m_download_chunk_size));
+    }
+  }
 }
 
+Object::Reader::~Reader() { stop_fetch_threads(); }
+
 off64_t Object::Reader::seek(off64_t offset) {
   const off64_t fsize = m_size;
   m_offset = std::min(offset, fsize);
@@ -510,6 +734,14 @@ off64_t Object::Reader::tell() const {
 }
 
 ssize_t Object::Reader::read(void *buffer, size_t length) {
+  if (is_prefetching()) {
+    return read_prefetched(buffer, length);
+  } else {
+    return read_direct(buffer, length);
+  }
+}
+
+ssize_t Object::Reader::read_direct(void *buffer, size_t length) {
   const size_t first = m_offset;
   const size_t last_unbounded = m_offset + length - 1;
   const off64_t fsize = m_size;
@@ -535,6 +767,181 @@ ssize_t Object::Reader::read(void *buffer, size_t length) {
   return read;
 }
 
+ssize_t Object::Reader::read_prefetched(void *buffer, size_t length) {
+  const off64_t fsize = m_size;
+
+  if (m_offset >= fsize) return 0;
+
+  if (m_chunks.empty() ||
+      m_chunks.front()->offset + static_cast<off64_t>(m_chunk_consumed) !=
+          m_offset) {
+    // first read or seek() outside of the read-ahead window, start over
+    discard_chunks();
+    m_next_chunk = m_offset;
+  }
+
+  if (m_fetch_threads.empty()) {
+    for (std::size_t i = 0; i < m_object->m_parallel_downloads; ++i) {
+      m_fetch_threads.emplace_back(mysqlsh::spawn_scoped_thread(
+          [this, path = m_object->full_path().real()]() {
+            fetch_chunks(path);
+          }));
+    }
+  }
+
+  const auto target = reinterpret_cast<char *>(buffer);
+  size_t read = 0;
+
+  while (read < length && m_offset < fsize) {
+    schedule_chunks();
+
+    std::shared_ptr<Chunk> chunk;
+
+    {
+      std::unique_lock lock(m_fetch_mutex);
+      chunk = m_chunks.front();
+      m_chunk_fetched.wait(lock, [&chunk]() { return chunk->ready; });
+    }
+
+    if (chunk->error) {
+      discard_chunks();
+
+      try {
+        std::rethrow_exception(chunk->error);
+      } catch (const rest::Response_error &error) {
+        throw rest::to_exception(error);
+      }
+    }
+
+    const auto bytes =
+        std::min(chunk->data.size() - m_chunk_consumed, length - read);
+
+    memcpy(target + read, chunk->data.data() + m_chunk_consumed, bytes);
+
+    read += bytes;
+    m_offset += bytes;
+    m_chunk_consumed += bytes;
+
+    if (m_chunk_consumed == chunk->data.size()) {
+      if (chunk->data.size() < chunk->size) {
+        // got less data than expected, the read-ahead is no longer valid
+        discard_chunks();
+        break;
+      }
+
+      std::lock_guard lock(m_fetch_mutex);
+      m_chunks.pop_front();
+      m_chunk_consumed = 0;
+    }
+  }
+
+  return read;
+}
+
+void Object::Reader::schedule_chunks() {
+  const off64_t fsize = m_size;
+  const off64_t chunk_size = m_object->m_download_chunk_size;
+  bool scheduled = false;
+
+  {
+    std::lock_guard lock(m_fetch_mutex);
+
+    while (m_chunks.size() < m_max_chunks && m_next_chunk < fsize) {
+      auto chunk = std::make_shared<Chunk>();
+      chunk->offset = m_next_chunk;
+      chunk->size = std::min(chunk_size, fsize - m_next_chunk);
+
+      m_next_chunk += chunk->size;
+
+      m_chunks.emplace_back(chunk);
+      m_scheduled_chunks.emplace_back(std::move(chunk));
+
+      scheduled = true;
+    }
+  }
+
+  if (scheduled) {
+    m_chunk_scheduled.notify_all();
+  }
+}
+
+void Object::Reader::discard_chunks() {
+  // chunks which are being fetched are going to be released by the
+  // background threads
+  std::lock_guard lock(m_fetch_mutex);
+  m_scheduled_chunks.clear();
+  m_chunks.clear();
+  m_chunk_consumed = 0;
+}
+
+void Object::Reader::fetch_chunks(const std::string &path) {
+  // REST services cannot be shared between threads, each thread is using its
+  // own container
+  const auto container = m_object->m_container->config()->container();
+
+  while (true) {
+    std::shared_ptr<Chunk> chunk;
+
+    {
+      std::unique_lock lock(m_fetch_mutex);
+
+      m_chunk_scheduled.wait(lock, [this]() {
+        return m_stop_fetching || !m_scheduled_chunks.empty();
+      });
+
+      if (m_stop_fetching) {
+        return;
+      }
+
+      chunk = std::move(m_scheduled_chunks.front());
+      m_scheduled_chunks.pop_front();
+    }
+
+    std::string data(chunk->size, '\0');
+    rest::Static_char_ref_buffer rbuffer(data.data(), data.size());
+    std::exception_ptr error;
+    size_t read = 0;
+
+    try {
+      read = container->get_object(path, &rbuffer, chunk->offset,
+                                   chunk->offset + chunk->size - 1);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    data.resize(read);
+
+    {
+      std::lock_guard lock(m_fetch_mutex);
+      chunk->data = std::move(data);
+      chunk->error = std::move(error);
+      chunk->ready = true;
+    }
+
+    m_chunk_fetched.notify_all();
+  }
+}
+
+void Object::Reader::stop_fetch_threads() {
+  if (m_fetch_threads.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard lock(m_fetch_mutex);
+    m_stop_fetching = true;
+    m_scheduled_chunks.clear();
+  }
+
+  m_chunk_scheduled.notify_all();
+
+  for (auto &thread : m_fetch_threads) {
+    thread.join();
+  }
+
+  m_fetch_threads.clear();
+}
+
 }  // namespace object_storage
 }  // namespace backend
 }  // namespace storage
@@ -24,9 +24,15 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_H_
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
@@ -268,12 +274,29 @@ class Object : public mysqlshdk::storage::IFile {
    */
   void set_max_part_size(size_t new_size);
 
+  /**
+   * Use this function to customize the number of parts of a multipart upload
+   * which are uploaded in the background (0 - synchronous uploads).
+   */
+  void set_parallel_uploads(size_t count);
+
+  /**
+   * Use this function to customize the number of concurrent ranged requests
+   * used to read ahead of the current offset (0 - synchronous reads).
+   */
+  void set_parallel_downloads(size_t count);
+
  protected:
   std::string m_name;
   std::string m_prefix;
   std::unique_ptr<Container> m_container;
   std::optional<Mode> m_open_mode;
   size_t m_max_part_size;
+  size_t m_parallel_uploads;
+  size_t m_upload_memory_limit;
+  size_t m_parallel_downloads;
+  size_t m_download_chunk_size;
+  size_t m_download_memory_limit;
 
   /**
    * Base class for the Read and Write Object handlers
@@ -303,15 +326,65 @@ class Object : public mysqlshdk::storage::IFile {
     void close();
 
    private:
+    struct Pending_part {
+      std::size_t index = 0;
+      std::string data;
+    };
+
     void reset();
 
     void abort_multipart_upload(const char *context,
                                 const std::string &error = {});
 
+    bool is_pipelined() const { return m_object->m_parallel_uploads > 0; }
+
+    /**
+     * Uploads the given part using the writing thread.
+     */
+    void upload_part(const char *data, std::size_t size);
+
+    /**
+     * Queues the given part to be uploaded in the background, blocks if the
+     * maximum number of in-flight parts or the memory limit is reached.
+     */
+    void queue_part(std::string &&data);
+
+    /**
+     * Executed by the background threads, uploads the queued parts.
+     */
+    void upload_queued_parts();
+
+    /**
+     * Waits until all the queued parts are uploaded.
+     */
+    void wait_for_uploads();
+
+    /**
+     * Stops the background threads, parts which were not uploaded yet are
+     * discarded.
+     */
+    void stop_upload_threads();
+
+    /**
+     * If any of the background uploads has failed, aborts the multipart upload
+     * and throws the error.
+     */
+    void rethrow_upload_error();
+
     std::string m_buffer;
     bool m_is_multipart;
     Multipart_object m_multipart;
     std::vector<Multipart_object_part> m_parts;
+
+    std::mutex m_upload_mutex;
+    std::condition_variable m_part_queued;
+    std::condition_variable m_part_uploaded;
+    std::deque<Pending_part> m_pending_parts;
+    std::size_t m_parts_in_flight = 0;
+    std::size_t m_bytes_in_flight = 0;
+    bool m_stop_uploads = false;
+    std::exception_ptr m_upload_error;
+    std::vector<std::thread> m_upload_threads;
   };
 
   /**
@@ -320,14 +393,66 @@ class Object : public mysqlshdk::storage::IFile {
   class Reader : public File_handler {
    public:
     explicit Reader(Object *owner);
-    ~Reader() override = default;
+    ~Reader() override;
 
     off64_t seek(off64_t offset);
     off64_t tell() const;
     ssize_t read(void *buffer, size_t length);
 
    private:
+    struct Chunk {
+      off64_t offset = 0;
+      std::size_t size = 0;
+      std::string data;
+      bool ready = false;
+      std::exception_ptr error;
+    };
+
+    bool is_prefetching() const { return m_object->m_parallel_downloads > 0; }
+
+    /**
+     * Reads the data using the reading thread.
+     */
+    ssize_t read_direct(void *buffer, size_t length);
+
+    /**
+     * Reads the data from the chunks fetched by the read-ahead.
+     */
+    ssize_t read_prefetched(void *buffer, size_t length);
+
+    /**
+     * Schedules the next chunks to be fetched, up to the configured limits.
+     */
+    void schedule_chunks();
+
+    /**
+     * Discards all the prefetched chunks.
+     */
+    void discard_chunks();
+
+    /**
+     * Executed by the background threads, fetches the scheduled chunks.
+     */
+    void fetch_chunks(const std::string &path);
+
+    void stop_fetch_threads();
+
     off64_t m_offset;
+
+    std::mutex m_fetch_mutex;
+    std::condition_variable m_chunk_scheduled;
+    std::condition_variable m_chunk_fetched;
+    // chunks in the read-ahead window, in order
+    std::deque<std::shared_ptr<Chunk>> m_chunks;
+    // chunks which were not yet picked up by the background threads
+    std::deque<std::shared_ptr<Chunk>> m_scheduled_chunks;
+    // offset of the next chunk to be scheduled
+    off64_t m_next_chunk = 0;
+    // number of bytes of the first chunk which were already read
+    std::size_t m_chunk_consumed = 0;
+    std::size_t m_max_chunks = 0;
+    bool m_stop_fetching = false;
+    std::vector<std::thread> m_fetch_threads;
   };
 
   std::unique_ptr<Writer> m_writer;
@@ -43,6 +43,15 @@ Config::Config(const Object_storage_options &options, std::size_t part_size)
   assert(!m_container_name.empty());
 }
 
+void Config::set_download_chunk_size(std::size_t size) {
+  if (0 == size) {
+    throw std::invalid_argument(
+        "The size of a download chunk must be greater than 0.");
+  }
+
+  m_download_chunk_size = size;
+}
+
 std::string Config::describe_url(const std::string &url) const {
   return "prefix='" + url + "'";
 }
@@ -58,6 +58,57 @@ class Config : public storage::Config, public rest::Signed_rest_service_config {
   std::size_t part_size() const { return m_part_size; }
   void set_part_size(std::size_t size) { m_part_size = size; }
 
+  /**
+   * Number of parts of a multipart upload which can be uploaded concurrently
+   * in the background, while the writer continues to buffer the next part.
+   *
+   * If set to 0, parts are uploaded synchronously by the writing thread.
+   */
+  std::size_t parallel_uploads() const { return m_parallel_uploads; }
+  void set_parallel_uploads(std::size_t count) { m_parallel_uploads = count; }
+
+  /**
+   * Maximum number of bytes held by the parts which are being uploaded in the
+   * background (0 - limited only by the number of parallel uploads). At least
+   * one part is always allowed to be uploaded.
+   */
+  std::size_t upload_memory_limit() const { return m_upload_memory_limit; }
+  void set_upload_memory_limit(std::size_t limit) {
+    m_upload_memory_limit = limit;
+  }
+
+  /**
+   * Number of ranged requests which are used to concurrently fetch the data
+   * ahead of the current read position of an object.
+   *
+   * If set to 0, data is fetched synchronously by the reading thread.
+   */
+  std::size_t parallel_downloads() const { return m_parallel_downloads; }
+  void set_parallel_downloads(std::size_t count) {
+    m_parallel_downloads = count;
+  }
+
+  /**
+   * Size of a single ranged request issued by the read-ahead, must be greater
+   * than 0.
+   *
+   * @throws std::invalid_argument If size is 0.
+   */
+  std::size_t download_chunk_size() const { return m_download_chunk_size; }
+  void set_download_chunk_size(std::size_t size);
+
+  /**
+   * Maximum number of bytes held by the read-ahead (0 - limited only by the
+   * number of parallel downloads). At least one chunk is always fetched.
+   */
+  std::size_t download_memory_limit() const { return m_download_memory_limit; }
+  void set_download_memory_limit(std::size_t limit) {
+    m_download_memory_limit = limit;
+  }
+
+  // 8 MB
+  static constexpr std::size_t DEFAULT_DOWNLOAD_CHUNK_SIZE = 8 * 1024 * 1024;
+
   virtual const std::string &hash() const = 0;
 
   virtual std::unique_ptr<Container> container() const = 0;
@@ -68,6 +119,11 @@ class Config : public storage::Config, public rest::Signed_rest_service_config {
   std::string m_container_name;
   std::string m_config_file;
   std::size_t m_part_size;
+  std::size_t m_parallel_uploads = 0;
+  std::size_t m_upload_memory_limit = 0;
+  std::size_t m_parallel_downloads = 0;
+  std::size_t m_download_chunk_size = DEFAULT_DOWNLOAD_CHUNK_SIZE;
+  std::size_t m_download_memory_limit = 0;
 
  private:
   std::string describe_url(const std::string &url) const override;
@@ -27,6 +27,7 @@
 #include <utility>
 
 #include "mysqlshdk/libs/storage/compression/gz_file.h"
+#include "mysqlshdk/libs/storage/compression/lz4_file.h"
 #include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -36,10 +37,11 @@ namespace storage {
 
 namespace {
 
-#define COMPRESSIONS     \
-  X(NONE, "none", "")    \
-  X(GZIP, "gzip", ".gz") \
-  X(ZSTD, "zstd", ".zst")
+#define COMPRESSIONS      \
+  X(NONE, "none", "")     \
+  X(GZIP, "gzip", ".gz")  \
+  X(ZSTD, "zstd", ".zst") \
+  X(LZ4, "lz4", ".lz4")
 
 }  // namespace
 
@@ -156,6 +158,10 @@ std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c) {
       result = std::make_unique<compression::Zstd_file>(std::move(file));
       break;
 
+    case Compression::LZ4:
+      result = std::make_unique<compression::Lz4_file>(std::move(file));
+      break;
+
     default:
       throw std::logic_error("Unhandled compression type: " + to_string(c));
   }
@@ -32,7 +32,7 @@
 namespace mysqlshdk {
 namespace storage {
 
-enum class Compression { NONE, GZIP, ZSTD };
+enum class Compression { NONE, GZIP, ZSTD, LZ4 };
 
 class Compressed_file : public IFile {
  public:
@@ -66,6 +66,11 @@ class Compressed_file : public IFile {
   bool is_compressed() const override { return true; }
   bool is_local() const override;
 
+  /**
+   * Whether seek() to an uncompressed offset is supported.
+   */
+  virtual bool is_seekable() const { return false; }
+
   /**
    * Provides the number of compressed bytes read/written by the most recent IO
    * operation.
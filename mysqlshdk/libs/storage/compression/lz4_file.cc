@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/compression/lz4_file.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "mysqlshdk/libs/storage/backend/file.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+namespace {
+
+// input is compressed in pieces of this size, LZ4F_compressUpdate() requires
+// the output buffer to be big enough to hold the worst case result
+constexpr size_t k_write_chunk_size = 1 << 20;
+
+// size of the compressed data read from the underlying file at once
+constexpr size_t k_read_chunk_size = 4 << 20;
+
+void check(size_t status, const char *context) {
+  if (LZ4F_isError(status)) {
+    throw std::runtime_error(std::string(context) + ": " +
+                             LZ4F_getErrorName(status));
+  }
+}
+
+}  // namespace
+
+Lz4_file::Lz4_file(std::unique_ptr<IFile> file)
+    : Compressed_file(std::move(file)) {
+  // same settings as the defaults of the lz4 command line utility
+  std::memset(&m_preferences, 0, sizeof(m_preferences));
+  m_preferences.frameInfo.blockSizeID = LZ4F_max4MB;
+  m_preferences.frameInfo.blockMode = LZ4F_blockIndependent;
+  m_preferences.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+}
+
+Lz4_file::~Lz4_file() {
+  try {
+    if (is_open()) do_close();
+  } catch (const std::runtime_error &e) {
+    log_error("Failed to close lz4 compressed file: %s", e.what());
+  }
+}
+
+ssize_t Lz4_file::read(void *buffer, size_t length) {
+  return (*this.*m_read_f)(static_cast<uint8_t *>(buffer), length);
+}
+
+ssize_t Lz4_file::do_read(uint8_t *buffer, size_t length) {
+  size_t offset = 0;
+
+  start_io();
+
+  while (offset < length) {
+    if (m_buffer_pos == m_buffer_end) {
+      const auto bytes_read = file()->read(m_buffer.data(), m_buffer.size());
+
+      if (bytes_read < 0) {
+        throw std::runtime_error("lz4.read: error reading compressed data");
+      }
+
+      if (0 == bytes_read) {
+        break;
+      }
+
+      m_buffer_pos = 0;
+      m_buffer_end = bytes_read;
+    }
+
+    size_t out_size = length - offset;
+    size_t in_size = m_buffer_end - m_buffer_pos;
+
+    check(LZ4F_decompress(m_dctx, buffer + offset, &out_size,
+                          m_buffer.data() + m_buffer_pos, &in_size, nullptr),
+          "lz4.read");
+
+    m_buffer_pos += in_size;
+    offset += out_size;
+    update_io(in_size);
+  }
+
+  finish_io();
+
+  m_offset += offset;
+
+  // number of bytes being returned
+  return offset;
+}
+
+ssize_t Lz4_file::do_read_mmap(uint8_t *buffer, size_t length) {
+  auto *mfile = static_cast<backend::File *>(file());
+  size_t offset = 0;
+
+  start_io();
+
+  while (offset < length) {
+    size_t in_size = 0;
+    const auto in = mfile->mmap_will_read(&in_size);
+
+    if (0 == in_size) break;
+
+    size_t out_size = length - offset;
+
+    check(LZ4F_decompress(m_dctx, buffer + offset, &out_size, in, &in_size,
+                          nullptr),
+          "lz4.read");
+
+    mfile->mmap_did_read(in_size);
+    offset += out_size;
+    update_io(in_size);
+  }
+
+  finish_io();
+
+  m_offset += offset;
+
+  // number of bytes being returned
+  return offset;
+}
+
+ssize_t Lz4_file::write(const void *buffer, size_t length) {
+  auto data = static_cast<const uint8_t *>(buffer);
+  auto left = length;
+
+  start_io();
+
+  while (left > 0) {
+    const auto chunk = std::min(left, k_write_chunk_size);
+    size_t available = 0;
+    const auto out = output_buffer(
+        LZ4F_compressBound(chunk, &m_preferences), &available);
+    const auto bytes =
+        LZ4F_compressUpdate(m_cctx, out, available, data, chunk, nullptr);
+    check(bytes, "lz4.write");
+    output_written(bytes);
+
+    data += chunk;
+    left -= chunk;
+  }
+
+  finish_io();
+
+  m_offset += length;
+
+  return length;
+}
+
+uint8_t *Lz4_file::output_buffer(size_t length, size_t *available) {
+  if (m_write_mmap) {
+    const auto out = static_cast<backend::File *>(file())->mmap_will_write(
+        length, available);
+
+    if (!out) {
+      throw std::runtime_error("Error reserving space on mmapped file");
+    }
+
+    return reinterpret_cast<uint8_t *>(out);
+  } else {
+    assert(m_buffer.size() >= length);
+    *available = m_buffer.size();
+    return m_buffer.data();
+  }
+}
+
+void Lz4_file::output_written(size_t length) {
+  if (m_write_mmap) {
+    static_cast<backend::File *>(file())->mmap_did_write(length, nullptr);
+  } else if (length > 0 && file()->write(m_buffer.data(), length) < 0) {
+    throw std::runtime_error("lz4.write: error writing compressed data");
+  }
+
+  update_io(length);
+}
+
+bool Lz4_file::flush() {
+  size_t available = 0;
+
+  start_io();
+
+  const auto out = output_buffer(LZ4F_compressBound(0, &m_preferences),
+                                 &available);
+  const auto bytes = LZ4F_flush(m_cctx, out, available, nullptr);
+  check(bytes, "lz4.write");
+  output_written(bytes);
+
+  finish_io();
+
+  return file()->flush();
+}
+
+void Lz4_file::write_finish() {
+  size_t available = 0;
+
+  start_io();
+
+  const auto out = output_buffer(LZ4F_compressBound(0, &m_preferences),
+                                 &available);
+  const auto bytes = LZ4F_compressEnd(m_cctx, out, available, nullptr);
+  check(bytes, "lz4.write");
+  output_written(bytes);
+
+  finish_io();
+}
+
+void Lz4_file::init_write() {
+  check(LZ4F_createCompressionContext(&m_cctx, LZ4F_VERSION),
+        "lz4 compression context init failed");
+
+  auto *mfile = dynamic_cast<backend::File *>(file());
+
+  // try to enable mmap if available
+  if (mfile && mfile->mmap_will_write(0, nullptr)) {
+    log_debug("mmap() enabled for file %s",
+              mfile->full_path().masked().c_str());
+    m_write_mmap = true;
+  } else {
+    m_write_mmap = false;
+    // the biggest output is produced when compressing a whole chunk, frame
+    // header and footer are smaller than that
+    m_buffer.resize(LZ4F_compressBound(k_write_chunk_size, &m_preferences));
+  }
+
+  size_t available = 0;
+
+  start_io();
+
+  const auto out = output_buffer(LZ4F_HEADER_SIZE_MAX, &available);
+  const auto bytes =
+      LZ4F_compressBegin(m_cctx, out, available, &m_preferences);
+  check(bytes, "lz4.write");
+  output_written(bytes);
+
+  finish_io();
+}
+
+void Lz4_file::init_read() {
+  check(LZ4F_createDecompressionContext(&m_dctx, LZ4F_VERSION),
+        "lz4 decompression context init failed");
+
+  auto *mfile = dynamic_cast<backend::File *>(file());
+
+  // try to enable mmap if available
+  if (mfile && mfile->mmap_will_read(nullptr)) {
+    log_debug("mmap() enabled for file %s",
+              mfile->full_path().masked().c_str());
+    m_read_f = &Lz4_file::do_read_mmap;
+  } else {
+    m_read_f = &Lz4_file::do_read;
+    m_buffer.resize(k_read_chunk_size);
+  }
+
+  m_buffer_pos = 0;
+  m_buffer_end = 0;
+}
+
+void Lz4_file::open(Mode m) {
+  if (!file()->is_open()) {
+    file()->open(m);
+  }
+
+  switch (m) {
+    case Mode::READ:
+      init_read();
+      break;
+    case Mode::WRITE:
+      init_write();
+      break;
+    case Mode::APPEND:
+      throw std::invalid_argument("append not supported for lz4 file");
+  }
+
+  m_open_mode = m;
+  m_offset = 0;
+}
+
+bool Lz4_file::is_open() const {
+  return m_open_mode.has_value() && file()->is_open();
+}
+
+void Lz4_file::close() { do_close(); }
+
+void Lz4_file::do_close() {
+  assert(is_open());
+
+  // contexts are released and the state is reset even if finishing the frame
+  // fails, so that they're not leaked and the file is not closed twice
+  shcore::Scoped_callback cleanup([this]() {
+    if (m_dctx) LZ4F_freeDecompressionContext(m_dctx);
+    m_dctx = nullptr;
+    m_read_f = nullptr;
+
+    if (m_cctx) LZ4F_freeCompressionContext(m_cctx);
+    m_cctx = nullptr;
+
+    m_open_mode.reset();
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+  });
+
+  if (Mode::WRITE == *m_open_mode) {
+    write_finish();
+  }
+
+  cleanup.call();
+
+  if (file()->is_open()) {
+    file()->close();
+  }
+}
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
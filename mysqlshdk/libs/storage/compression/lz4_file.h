@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_COMPRESSION_LZ4_FILE_H_
+#define MYSQLSHDK_LIBS_STORAGE_COMPRESSION_LZ4_FILE_H_
+
+#include <lz4frame.h>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+/**
+ * Reads and writes files in the LZ4 frame format, compatible with the lz4
+ * command line utility.
+ */
+class Lz4_file : public Compressed_file {
+ public:
+  Lz4_file() = delete;
+
+  explicit Lz4_file(std::unique_ptr<IFile> file);
+
+  Lz4_file(const Lz4_file &other) = delete;
+  Lz4_file(Lz4_file &&other) = default;
+
+  Lz4_file &operator=(const Lz4_file &other) = delete;
+  Lz4_file &operator=(Lz4_file &&other) = default;
+
+  ~Lz4_file() override;
+
+  void open(Mode m) override;
+  bool is_open() const override;
+  void close() override;
+
+  off64_t seek(off64_t) override {
+    throw std::logic_error("Lz4_file::seek() - not supported");
+  }
+
+  off64_t tell() const override { return m_offset; }
+
+  bool flush() override;
+
+  ssize_t read(void *buffer, size_t length) override;
+  ssize_t write(const void *buffer, size_t length) override;
+
+ private:
+  void init_read();
+  void init_write();
+  void write_finish();
+
+  void do_close();
+
+  /**
+   * Provides a buffer for the compressed data, which is able to hold at least
+   * the given number of bytes.
+   */
+  uint8_t *output_buffer(size_t length, size_t *available);
+
+  /**
+   * Writes the given number of compressed bytes stored in the output buffer.
+   */
+  void output_written(size_t length);
+
+  ssize_t do_read(uint8_t *buffer, size_t length);
+  ssize_t do_read_mmap(uint8_t *buffer, size_t length);
+
+  ssize_t (Lz4_file::*m_read_f)(uint8_t *, size_t) = nullptr;
+  bool m_write_mmap = false;
+
+  size_t m_offset = 0;
+
+  LZ4F_cctx *m_cctx = nullptr;
+  LZ4F_dctx *m_dctx = nullptr;
+  LZ4F_preferences_t m_preferences;
+  // compressed data: output when writing, input when reading
+  std::vector<uint8_t> m_buffer;
+  // when reading, range [m_buffer_pos, m_buffer_end) holds the input
+  size_t m_buffer_pos = 0;
+  size_t m_buffer_end = 0;
+  std::optional<Mode> m_open_mode;
+};
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_COMPRESSION_LZ4_FILE_H_
@@ -24,16 +24,73 @@
 #include "mysqlshdk/libs/storage/compression/zstd_file.h"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <utility>
 
 #include "mysqlshdk/libs/storage/backend/file.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 
 namespace mysqlshdk {
 namespace storage {
 namespace compression {
 
+namespace {
+
+// zstd seekable format, see:
+// contrib/seekable_format/zstd_seekable_compression_format.md
+constexpr uint32_t k_skippable_frame_magic = 0x184D2A5E;
+constexpr uint32_t k_seekable_magic = 0x8F92EAB1;
+constexpr size_t k_skippable_frame_header_size = 8;
+constexpr size_t k_seek_table_entry_size = 8;
+constexpr size_t k_seek_table_checksum_size = 4;
+constexpr size_t k_seek_table_footer_size = 9;
+constexpr uint8_t k_seek_table_checksum_flag = 0x80;
+constexpr uint8_t k_seek_table_reserved_bits = 0x7C;
+// sizes in the seek table are 32-bit values, compressed frame can be slightly
+// bigger than the uncompressed one
+constexpr size_t k_max_frame_size = 1 << 30;
+
+uint8_t *write_le32(uint32_t value, uint8_t *out) {
+  for (int i = 0; i < 4; ++i) {
+    *out++ = static_cast<uint8_t>(value >> (8 * i));
+  }
+
+  return out;
+}
+
+uint32_t read_le32(const uint8_t *in) {
+  uint32_t value = 0;
+
+  for (int i = 0; i < 4; ++i) {
+    value |= static_cast<uint32_t>(in[i]) << (8 * i);
+  }
+
+  return value;
+}
+
+void read_at(IFile *file, off64_t offset, uint8_t *buffer, size_t length) {
+  if (file->seek(offset) < 0) {
+    throw std::runtime_error("zstd.read: failed to seek in " +
+                             file->full_path().masked());
+  }
+
+  while (length > 0) {
+    const auto bytes = file->read(buffer, length);
+
+    if (bytes <= 0) {
+      throw std::runtime_error("zstd.read: failed to read the seek table of " +
+                               file->full_path().masked());
+    }
+
+    buffer += bytes;
+    length -= bytes;
+  }
+}
+
+}  // namespace
+
 Zstd_file::Zstd_file(std::unique_ptr<IFile> file)
     : Compressed_file(std::move(file)) {}
 
@@ -63,12 +120,49 @@ Zstd_file::Buf_view Zstd_file::peek(const size_t length) {
 }
 
 ssize_t Zstd_file::read(void *buffer, size_t length) {
+  auto data = static_cast<uint8_t *>(buffer);
+  size_t replayed = 0;
+
+  if (m_offset < m_history_end) {
+    // data preceding the current position of the stream was requested
+    const auto history_begin = m_history_end - m_history.size();
+    assert(m_offset >= history_begin);
+
+    replayed = std::min<uint64_t>(length, m_history_end - m_offset);
+    ::memcpy(data, m_history.data() + (m_offset - history_begin), replayed);
+    m_offset += replayed;
+
+    if (replayed == length) return replayed;
+  }
+
   ZSTD_outBuffer obuf;
-  obuf.dst = buffer;
-  obuf.size = length;
+  obuf.dst = data + replayed;
+  obuf.size = length - replayed;
   obuf.pos = 0;
 
-  return (*this.*m_read_f)(&obuf);
+  const auto bytes = (*this.*m_read_f)(&obuf);
+
+  m_history_end = m_offset;
+
+  if (is_seekable()) remember(data + replayed, bytes);
+
+  return replayed + bytes;
+}
+
+void Zstd_file::remember(const uint8_t *data, size_t length) {
+  if (length >= HISTORY) {
+    m_history.assign(data + length - HISTORY, data + length);
+    return;
+  }
+
+  // history is trimmed once it's twice as big as needed, so that the data is
+  // not moved on every read
+  if (m_history.size() + length > 2 * HISTORY) {
+    m_history.erase(m_history.begin(),
+                    m_history.end() - (HISTORY - length));
+  }
+
+  m_history.insert(m_history.end(), data, data + length);
 }
 
 ssize_t Zstd_file::do_read(ZSTD_outBuffer *obuf) {
@@ -141,9 +235,34 @@ ssize_t Zstd_file::write(const void *buffer, size_t length) {
   ibuf.pos = 0;
   ibuf.src = buffer;
 
-  m_offset += length;
+  if (!m_max_frame_size) {
+    m_offset += length;
+
+    return (*this.*m_write_f)(&ibuf, ZSTD_e_continue);
+  }
+
+  // split the data into frames
+  auto data = static_cast<const uint8_t *>(buffer);
+  auto left = length;
+
+  while (left > 0) {
+    ibuf.size = std::min(left, m_max_frame_size - m_frame_size);
+    ibuf.pos = 0;
+    ibuf.src = data;
+
+    (*this.*m_write_f)(&ibuf, ZSTD_e_continue);
+
+    m_offset += ibuf.size;
+    m_frame_size += ibuf.size;
+    data += ibuf.size;
+    left -= ibuf.size;
 
-  return (*this.*m_write_f)(&ibuf, ZSTD_e_continue);
+    if (m_frame_size >= m_max_frame_size) {
+      end_frame();
+    }
+  }
+
+  return length;
 }
 
 bool Zstd_file::flush() {
@@ -158,6 +277,15 @@ bool Zstd_file::flush() {
 }
 
 void Zstd_file::write_finish() {
+  if (m_max_frame_size) {
+    if (m_frame_size > 0 || m_written_frames.empty()) {
+      end_frame();
+    }
+
+    write_seek_table();
+    return;
+  }
+
   ZSTD_inBuffer ibuf;
   ibuf.size = 0;
   ibuf.pos = 0;
@@ -166,6 +294,55 @@ void Zstd_file::write_finish() {
   (*this.*m_write_f)(&ibuf, ZSTD_e_end);
 }
 
+void Zstd_file::end_frame() {
+  ZSTD_inBuffer ibuf;
+  ibuf.size = 0;
+  ibuf.pos = 0;
+  ibuf.src = nullptr;
+
+  (*this.*m_write_f)(&ibuf, ZSTD_e_end);
+
+  m_written_frames.push_back(
+      Frame{m_frame_compressed_offset, m_offset - m_frame_size});
+  m_frame_compressed_offset = m_compressed_offset;
+  m_frame_size = 0;
+}
+
+void Zstd_file::write_seek_table() {
+  const auto frames = m_written_frames.size();
+  const auto table_size =
+      frames * k_seek_table_entry_size + k_seek_table_footer_size;
+  std::vector<uint8_t> table(k_skippable_frame_header_size + table_size);
+  auto p = write_le32(k_skippable_frame_magic, table.data());
+  p = write_le32(static_cast<uint32_t>(table_size), p);
+
+  for (size_t i = 0; i < frames; ++i) {
+    const auto &begin = m_written_frames[i];
+    const auto end = i + 1 < frames ? m_written_frames[i + 1]
+                                    : Frame{m_compressed_offset, m_offset};
+
+    p = write_le32(
+        static_cast<uint32_t>(end.compressed_offset - begin.compressed_offset),
+        p);
+    p = write_le32(static_cast<uint32_t>(end.uncompressed_offset -
+                                         begin.uncompressed_offset),
+                   p);
+  }
+
+  p = write_le32(static_cast<uint32_t>(frames), p);
+  // no checksums
+  *p++ = 0;
+  p = write_le32(k_seekable_magic, p);
+
+  assert(p == table.data() + table.size());
+
+  if (file()->write(table.data(), table.size()) < 0) {
+    throw std::runtime_error("zstd.write: error writing the seek table");
+  }
+
+  m_written_frames.clear();
+}
+
 ssize_t Zstd_file::do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
   ZSTD_outBuffer obuf;
 
@@ -191,6 +368,7 @@ ssize_t Zstd_file::do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
         throw std::runtime_error("zstd.write: error writing compressed data");
 
       update_io(obuf.pos);
+      m_compressed_offset += obuf.pos;
 
       obuf.pos = 0;
     }
@@ -227,6 +405,7 @@ ssize_t Zstd_file::do_write_mmap(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
                                ZSTD_getErrorName(status));
     } else {
       update_io(obuf.pos);
+      m_compressed_offset += obuf.pos;
       obuf.dst = mfile->mmap_did_write(obuf.pos, &obuf.size);
       obuf.pos = 0;
     }
@@ -247,10 +426,25 @@ void Zstd_file::init_write() {
     }
     ZSTD_initCStream(m_cctx, m_clevel);
 
+    if (m_workers > 0) {
+      const auto status =
+          ZSTD_CCtx_setParameter(m_cctx, ZSTD_c_nbWorkers, m_workers);
+
+      if (ZSTD_isError(status)) {
+        // library was built without multithreading support
+        log_debug("Could not use %d zstd workers for file %s: %s", m_workers,
+                  full_path().masked().c_str(), ZSTD_getErrorName(status));
+        m_workers = 0;
+      }
+    }
+
     auto *mfile = dynamic_cast<backend::File *>(file());
 
-    // try to enable mmap if available
-    if (mfile && mfile->mmap_will_write(0, nullptr)) {
+    // try to enable mmap if available, seek table is written directly to the
+    // file, which is not possible if it's mmapped; workers can flush multiple
+    // compressed jobs at once, which may not fit in the mmapped area
+    if (!m_max_frame_size && !m_workers && mfile &&
+        mfile->mmap_will_write(0, nullptr)) {
       log_debug("mmap() enabled for file %s",
                 mfile->full_path().masked().c_str());
       m_write_f = &Zstd_file::do_write_mmap;
@@ -291,6 +485,11 @@ void Zstd_file::open(Mode m) {
       init_read();
       break;
     case Mode::WRITE:
+      m_compressed_offset = 0;
+      m_frame_compressed_offset = 0;
+      m_frame_size = 0;
+      m_written_frames.clear();
+      m_seek_table.clear();
       init_write();
       break;
     case Mode::APPEND:
@@ -299,6 +498,8 @@ void Zstd_file::open(Mode m) {
 
   m_open_mode = m;
   m_offset = 0;
+  m_history.clear();
+  m_history_end = 0;
 }
 
 bool Zstd_file::is_open() const {
@@ -307,6 +508,160 @@ bool Zstd_file::is_open() const {
 
 void Zstd_file::close() { do_close(); }
 
+size_t Zstd_file::file_size() const {
+  if (is_seekable()) {
+    return m_seek_table.back().uncompressed_offset;
+  }
+
+  return Compressed_file::file_size();
+}
+
+void Zstd_file::set_max_frame_size(size_t bytes) {
+  assert(!is_open());
+  m_max_frame_size = std::min(bytes, k_max_frame_size);
+}
+
+void Zstd_file::set_workers(int workers) {
+  assert(!is_open());
+  m_workers = std::max(workers, 0);
+}
+
+bool Zstd_file::load_seek_table() {
+  assert(!is_open());
+
+  m_seek_table.clear();
+
+  const auto opened = !file()->is_open();
+
+  if (opened) {
+    file()->open(Mode::READ);
+  }
+
+  shcore::on_leave_scope restore([this, opened]() {
+    if (opened) {
+      file()->close();
+    } else {
+      file()->seek(0);
+    }
+  });
+
+  const auto size = file()->file_size();
+
+  if (size < k_skippable_frame_header_size + k_seek_table_footer_size) {
+    return false;
+  }
+
+  uint8_t footer[k_seek_table_footer_size];
+  read_at(file(), size - k_seek_table_footer_size, footer, sizeof(footer));
+
+  if (read_le32(footer + 5) != k_seekable_magic ||
+      (footer[4] & k_seek_table_reserved_bits)) {
+    return false;
+  }
+
+  const uint64_t frames = read_le32(footer);
+  const auto entry_size =
+      k_seek_table_entry_size +
+      ((footer[4] & k_seek_table_checksum_flag) ? k_seek_table_checksum_size
+                                                : 0);
+  const auto table_size = frames * entry_size + k_seek_table_footer_size;
+
+  if (size < k_skippable_frame_header_size + table_size) {
+    return false;
+  }
+
+  std::vector<uint8_t> table(k_skippable_frame_header_size + table_size -
+                             k_seek_table_footer_size);
+  const auto table_offset = size - k_skippable_frame_header_size - table_size;
+  read_at(file(), table_offset, table.data(), table.size());
+
+  if (read_le32(table.data()) != k_skippable_frame_magic ||
+      read_le32(table.data() + 4) != table_size) {
+    return false;
+  }
+
+  Frame frame{0, 0};
+  const uint8_t *entry = table.data() + k_skippable_frame_header_size;
+
+  m_seek_table.reserve(frames + 1);
+
+  for (uint64_t i = 0; i < frames; ++i, entry += entry_size) {
+    m_seek_table.emplace_back(frame);
+    frame.compressed_offset += read_le32(entry);
+    frame.uncompressed_offset += read_le32(entry + 4);
+  }
+
+  if (frame.compressed_offset != table_offset) {
+    m_seek_table.clear();
+    throw std::runtime_error("zstd.read: seek table of " +
+                             full_path().masked() + " is corrupted");
+  }
+
+  m_seek_table.emplace_back(frame);
+
+  log_debug("Loaded seek table of %s, %zu frames",
+            full_path().masked().c_str(), static_cast<size_t>(frames));
+
+  return true;
+}
+
+off64_t Zstd_file::seek(off64_t offset) {
+  if (!is_seekable()) {
+    throw std::logic_error("Zstd_file::seek() - not supported");
+  }
+
+  assert(m_dctx);
+
+  const uint64_t target =
+      std::min<uint64_t>(std::max<off64_t>(offset, 0), file_size());
+  // frame which holds the target offset
+  auto frame = std::upper_bound(
+      m_seek_table.begin(), std::prev(m_seek_table.end()), target,
+      [](uint64_t t, const Frame &f) { return t < f.uncompressed_offset; });
+  --frame;
+
+  if (target <= m_history_end && target + m_history.size() >= m_history_end) {
+    // target is within the recently decompressed data, which is going to be
+    // replayed
+    m_offset = target;
+    return 0;
+  }
+
+  // continue from the current position of the stream
+  m_offset = m_history_end;
+
+  if (m_offset < frame->uncompressed_offset || m_offset > target) {
+    // restart decompression at the beginning of the frame
+    if (file()->seek(frame->compressed_offset) < 0) {
+      throw std::runtime_error("zstd.read: failed to seek in " +
+                               full_path().masked());
+    }
+
+    m_buffer.clear();
+    m_decompress_read_size = ZSTD_initDStream(m_dctx);
+    m_offset = frame->uncompressed_offset;
+    m_history.clear();
+    m_history_end = m_offset;
+  }
+
+  // decompress the data preceding the target offset
+  discard(target - m_offset);
+
+  return 0;
+}
+
+void Zstd_file::discard(size_t length) {
+  std::vector<uint8_t> buffer(std::min<size_t>(length, CHUNK));
+
+  while (length > 0) {
+    const auto bytes = read(buffer.data(), std::min(length, buffer.size()));
+
+    if (bytes <= 0) break;
+
+    length -= bytes;
+  }
+}
+
 void Zstd_file::do_close() {
   assert(is_open());
 
@@ -58,18 +58,60 @@ class Zstd_file : public Compressed_file {
   bool is_open() const override;
   void close() override;
 
-  off64_t seek(off64_t) override {
-    throw std::logic_error("Zstd_file::seek() - not supported");
-  }
+  /**
+   * Seeks to the given uncompressed offset, supported only if seek table was
+   * loaded.
+   */
+  off64_t seek(off64_t offset) override;
 
   off64_t tell() const override { return m_offset; }
 
+  /**
+   * Uncompressed size if seek table was loaded, compressed size otherwise.
+   */
+  size_t file_size() const override;
+
   bool flush() override;
 
   ssize_t read(void *buffer, size_t length) override;
   ssize_t write(const void *buffer, size_t length) override;
 
+  /**
+   * Writes the data as independently compressed frames, each one holding at
+   * most the given number of uncompressed bytes, followed by a seek table
+   * (zstd seekable format). Needs to be called before the file is opened for
+   * writing, 0 writes a single frame.
+   */
+  void set_max_frame_size(size_t bytes);
+
+  /**
+   * Loads the seek table if the file is in zstd seekable format. Needs to be
+   * called before the file is opened for reading.
+   *
+   * @returns true if seek table was loaded.
+   */
+  bool load_seek_table();
+
+  bool is_seekable() const override { return !m_seek_table.empty(); }
+
+  /**
+   * Sets the number of worker threads used to compress the data, 0 means that
+   * the data is compressed by the calling thread. Needs to be called before the
+   * file is opened for writing.
+   */
+  void set_workers(int workers);
+
+  /**
+   * Number of worker threads used to compress the data.
+   */
+  int workers() const { return m_workers; }
+
  private:
+  struct Frame {
+    uint64_t compressed_offset;
+    uint64_t uncompressed_offset;
+  };
+
   struct Buf_view {
     uint8_t *ptr;
     size_t length;
@@ -77,6 +119,10 @@ class Zstd_file : public Compressed_file {
 
   static constexpr const size_t CHUNK = 1 << 15;
 
+  // number of the most recently decompressed bytes which are kept, so that
+  // short backward seeks do not restart the decompression of a frame
+  static constexpr const size_t HISTORY = 2 * CHUNK;
+
   static constexpr bool is_power_of_2(size_t x) {
     return ((x - 1) & x) == 0 && (x != 0);
   }
@@ -100,6 +146,12 @@ class Zstd_file : public Compressed_file {
   void init_read();
   void init_write();
   void write_finish();
+  void end_frame();
+  void write_seek_table();
+
+  void discard(size_t length);
+
+  void remember(const uint8_t *data, size_t length);
 
   void do_close();
 
@@ -117,9 +169,24 @@ class Zstd_file : public Compressed_file {
   ZSTD_CStream *m_cctx = nullptr;
   ZSTD_DStream *m_dctx = nullptr;
   int m_clevel = 1;
+  int m_workers = 0;
   std::vector<uint8_t> m_buffer;
   size_t m_decompress_read_size = 0;
   std::optional<Mode> m_open_mode;
+
+  // seekable format
+  size_t m_max_frame_size = 0;
+  size_t m_frame_size = 0;
+  uint64_t m_compressed_offset = 0;
+  uint64_t m_frame_compressed_offset = 0;
+  std::vector<Frame> m_written_frames;
+  // beginning of each frame, followed by the end of data
+  std::vector<Frame> m_seek_table;
+  // tail of the decompressed data, ends at m_history_end, which is the
+  // position of the decompression stream; m_offset is lower than that when
+  // the data is replayed after a backward seek
+  std::vector<uint8_t> m_history;
+  uint64_t m_history_end = 0;
 };
 
 }  // namespace compression
@@ -32,11 +32,11 @@ namespace utils {
 
 constexpr int k_micro = 1000000;
 
-void Rate_limit::throttle(int64_t bytes) {
+std::chrono::milliseconds Rate_limit::throttle(int64_t bytes) {
   m_now = std::chrono::high_resolution_clock::now();
   std::chrono::duration<double, std::micro> diff = m_now - m_last;
   if (diff.count() < 0) {
-    return;
+    return {};
   }
 
   int64_t allowed_bytes =
@@ -45,7 +45,7 @@ void Rate_limit::throttle(int64_t bytes) {
 
   if (bytes <= allowed_bytes) {
     m_unused_bytes = allowed_bytes - bytes;
-    return;
+    return {};
   }
 
   auto over_sent = bytes - allowed_bytes;
@@ -53,7 +53,10 @@ void Rate_limit::throttle(int64_t bytes) {
 
   m_last += std::chrono::duration<long, std::micro>(sleep_us);
 
-  shcore::sleep_ms(sleep_us / 1000);
+  const std::chrono::milliseconds sleep{sleep_us / 1000};
+  shcore::sleep_ms(sleep.count());
+
+  return sleep;
 }
 } /* namespace utils */
 } /* namespace mysqlshdk */
@@ -50,7 +50,12 @@ class Rate_limit final {
 
   bool enabled() { return m_bytes_limit > 0; }
 
-  void throttle(int64_t bytes);
+  /**
+   * Sleeps if the given number of bytes exceeds the limit.
+   *
+   * @returns Time spent sleeping.
+   */
+  std::chrono::milliseconds throttle(int64_t bytes);
 
  private:
   int64_t m_bytes_limit = 0;
@@ -25,6 +25,7 @@
 #define MYSQLSHDK_LIBS_UTILS_SYNCHRONIZED_QUEUE_H_
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <deque>
@@ -24,8 +24,16 @@
 #ifndef MYSQLSHDK_LIBS_UTILS_THREADS_H_
 #define MYSQLSHDK_LIBS_UTILS_THREADS_H_
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <thread>
 #include <utility>
@@ -77,6 +85,185 @@ OutputT map_reduce(InputIter begin, InputIter end, MapF map, ReduceF reduce) {
   return result;
 }
 
+/**
+ * Outcome of a single call made by fan_out().
+ */
+template <class R>
+struct Fan_out_result {
+  std::optional<R> value;
+  // set if the call has thrown or did not finish before the deadline
+  std::exception_ptr error;
+  bool timed_out = false;
+
+  /**
+   * Provides the value, rethrows the error if the call has failed.
+   */
+  const R &get() const {
+    if (error) std::rethrow_exception(error);
+    return *value;
+  }
+};
+
+// maximum number of calls abandoned by fan_out() which may be still running in
+// the background, once it's reached deadlines are not enforced until some of
+// these calls finish
+inline constexpr std::size_t k_max_abandoned_fan_out_calls = 16;
+
+namespace detail {
+
+// number of calls abandoned by fan_out() which are still running
+inline std::atomic<std::size_t> g_abandoned_fan_out_calls{0};
+
+template <class R, class T, class F>
+struct Fan_out_state {
+  Fan_out_state(const std::vector<T> &i, F &&f)
+      : items(i),
+        fn(std::move(f)),
+        results(i.size()),
+        started(i.size()),
+        finished(i.size(), false),
+        pending(i.size()) {}
+
+  std::mutex mutex;
+  // notified when a call is started or finished
+  std::condition_variable changed;
+  const std::vector<T> items;
+  F fn;
+  std::vector<Fan_out_result<R>> results;
+  std::vector<std::optional<std::chrono::steady_clock::time_point>> started;
+  std::vector<bool> finished;
+  std::size_t next = 0;
+  std::size_t pending;
+};
+
+template <class R, class T, class F>
+void fan_out_worker(const std::shared_ptr<Fan_out_state<R, T, F>> &state) {
+  std::unique_lock lock{state->mutex};
+
+  while (state->next < state->items.size()) {
+    const auto i = state->next++;
+    state->started[i] = std::chrono::steady_clock::now();
+    // caller needs to know when the deadline of this call expires
+    state->changed.notify_all();
+
+    lock.unlock();
+
+    Fan_out_result<R> result;
+
+    try {
+      result.value = state->fn(state->items[i]);
+    } catch (...) {
+      result.error = std::current_exception();
+    }
+
+    lock.lock();
+
+    if (state->finished[i]) {
+      // deadline has expired, caller has already started a replacement thread
+      --g_abandoned_fan_out_calls;
+      return;
+    }
+
+    state->results[i] = std::move(result);
+    state->finished[i] = true;
+    --state->pending;
+    state->changed.notify_all();
+  }
+}
+
+}  // namespace detail
+
+/**
+ * Calls fn for each of the given items, using at most max_threads threads at
+ * once, and waits until all the calls are finished. Results are returned in
+ * the same order as the items, regardless of the order in which the calls
+ * finish.
+ *
+ * If deadline is not zero, a call which takes longer than that is reported as
+ * failed (timed_out is set) and it's left running in the background, a new
+ * thread takes its place. fn and the items are copied, fn must not refer to
+ * anything which may be destroyed once this function returns. The abandoned
+ * call holds its copy of the item (i.e. a session) until it returns, at most
+ * k_max_abandoned_fan_out_calls such calls exist in the whole process, once
+ * there are that many, expired calls are waited for until some of them finish.
+ */
+template <class R, class T, class F>
+std::vector<Fan_out_result<R>> fan_out(const std::vector<T> &items, F fn,
+                                       std::size_t max_threads,
+                                       std::chrono::milliseconds deadline) {
+  using State = detail::Fan_out_state<R, T, F>;
+
+  if (items.empty()) return {};
+
+  const auto state = std::make_shared<State>(items, std::move(fn));
+  const auto spawn = [&state]() {
+    mysqlsh::spawn_scoped_thread([state]() { detail::fan_out_worker(state); })
+        .detach();
+  };
+
+  const auto threads =
+      std::min(std::max<std::size_t>(max_threads, 1), items.size());
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    spawn();
+  }
+
+  std::unique_lock lock{state->mutex};
+
+  while (state->pending > 0) {
+    if (deadline.count() <= 0) {
+      state->changed.wait(lock);
+      continue;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    std::optional<std::chrono::steady_clock::time_point> wake_up;
+
+    for (std::size_t i = 0; i < items.size(); ++i) {
+      if (state->finished[i] || !state->started[i]) continue;
+
+      const auto expires = *state->started[i] + deadline;
+
+      if (expires > now) {
+        if (!wake_up || expires < *wake_up) wake_up = expires;
+        continue;
+      }
+
+      if (++detail::g_abandoned_fan_out_calls > k_max_abandoned_fan_out_calls) {
+        // too many calls are still running in the background, the deadline is
+        // checked again later
+        --detail::g_abandoned_fan_out_calls;
+
+        const auto retry = now + std::min<std::chrono::milliseconds>(
+                                     deadline, std::chrono::milliseconds{100});
+
+        if (!wake_up || retry < *wake_up) wake_up = retry;
+        continue;
+      }
+
+      auto &result = state->results[i];
+      result.error = std::make_exception_ptr(std::runtime_error(
+          "Timed out after " + std::to_string(deadline.count()) + "ms"));
+      result.timed_out = true;
+
+      state->finished[i] = true;
+      --state->pending;
+
+      if (state->next < items.size()) spawn();
+    }
+
+    if (0 == state->pending) break;
+
+    if (wake_up) {
+      state->changed.wait_until(lock, *wake_up);
+    } else {
+      state->changed.wait(lock);
+    }
+  }
+
+  return state->results;
+}
+
 }  // namespace utils
 }  // namespace mysqlshdk
 
@@ -29,6 +29,10 @@
 #include <regex>
 #include <stdexcept>
 
+#ifdef _WIN32
+#include <windows.h>
+#endif  // _WIN32
+
 #include "mysqlshdk/libs/utils/strformat.h"
 
 namespace shcore {
@@ -153,4 +157,32 @@ std::chrono::system_clock::time_point rfc3339_to_time_point(
   return ret;
 }
 
+std::chrono::nanoseconds process_cpu_time() {
+#ifdef _WIN32
+  FILETIME creation, exit, kernel, user;
+
+  if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel,
+                       &user)) {
+    return std::chrono::nanoseconds::zero();
+  }
+
+  // FILETIME is expressed in 100-nanosecond intervals
+  const auto to_ns = [](const FILETIME &ft) {
+    return std::chrono::nanoseconds(
+        ((static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime) *
+        100);
+  };
+
+  return to_ns(kernel) + to_ns(user);
+#else   // !_WIN32
+  timespec ts;
+
+  if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts)) {
+    return std::chrono::nanoseconds::zero();
+  }
+
+  return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+#endif  // !_WIN32
+}
+
 }  // namespace shcore
@@ -54,6 +54,12 @@ std::string time_point_to_rfc3339(
 std::chrono::system_clock::time_point rfc3339_to_time_point(
     const std::string &s);
 
+/**
+ * Provides CPU time (user and system) consumed by all threads of the current
+ * process, zero if it cannot be obtained.
+ */
+std::chrono::nanoseconds process_cpu_time();
+
 }  // namespace shcore
 
 #endif  // MYSQLSHDK_LIBS_UTILS_UTILS_TIME_H_
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
+#define MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+namespace shcore {
+
+namespace detail {
+
+/**
+ * Index of the calling thread, assigned on the first call, used to select the
+ * shard of a Work_stealing_queue.
+ */
+inline std::size_t work_stealing_thread_index() {
+  static std::atomic<std::size_t> s_next_index{0};
+  thread_local const std::size_t t_index = s_next_index++;
+  return t_index;
+}
+
+}  // namespace detail
+
+/**
+ * Multiple producer, multiple consumer queue with the same interface as
+ * Synchronized_queue, meant to be used by pools of many worker threads.
+ *
+ * Items are held in a number of shards, each one with its own mutex, a thread
+ * pushes to and pops from its own shard, stealing from the other shards when
+ * its own one does not hold any item of the highest pending priority. Items
+ * are always popped in the order of priorities, FIFO order is kept for items
+ * pushed by the same thread.
+ *
+ * Idle consumers sleep on a condition variable, which is only notified if
+ * there are any sleeping consumers, waking up one consumer per pushed item.
+ */
+template <class T>
+class Work_stealing_queue final {
+ public:
+  Work_stealing_queue() : Work_stealing_queue(default_shards()) {}
+
+  /**
+   * Creates the queue.
+   *
+   * @param shards Number of shards, should be close to the number of threads
+   *        which use the queue.
+   */
+  explicit Work_stealing_queue(std::size_t shards)
+      : m_shard_count(std::max<std::size_t>(1, shards)),
+        m_shards(std::make_unique<Shard[]>(m_shard_count)) {}
+
+  Work_stealing_queue(const Work_stealing_queue &other) = delete;
+  Work_stealing_queue(Work_stealing_queue &&other) = delete;
+
+  Work_stealing_queue &operator=(const Work_stealing_queue &other) = delete;
+  Work_stealing_queue &operator=(Work_stealing_queue &&other) = delete;
+
+  ~Work_stealing_queue() = default;
+
+  template <class U = T>
+  void push(U &&r, Queue_priority p = Queue_priority::MEDIUM) {
+    unsynchronized_push(std::forward<U>(r), level(map_priority(p)));
+    wake_one();
+  }
+
+  T pop() {
+    claim(nullptr);
+    return take();
+  }
+
+  std::optional<T> try_pop(std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    if (claim(&deadline)) {
+      return take();
+    }
+
+    return {};
+  }
+
+  /**
+   * Method that push to the queue n guard objects that signals to consumer
+   * threads to complete operation. Guard objects have the lowest priority,
+   * they are popped once all the other items are consumed.
+   *
+   * @param n number of consumer threads.
+   */
+  void shutdown(int64_t n) {
+    for (int64_t i = 0; i < n; i++) {
+      unsynchronized_push(T(), level(k_shutdown_priority));
+    }
+
+    wake_all();
+  }
+
+  size_t size() const { return m_size; }
+
+ private:
+  using Priority_t = std::underlying_type_t<Queue_priority>;
+
+  static constexpr Priority_t map_priority(Queue_priority p) {
+    return static_cast<Priority_t>(p);
+  }
+
+  static constexpr std::size_t level(Priority_t p) {
+    return k_max_priority - p;
+  }
+
+  static std::size_t default_shards() {
+    return std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1,
+                                   k_max_default_shards);
+  }
+
+  static constexpr Priority_t k_shutdown_priority = 0;
+  static constexpr Priority_t k_max_priority =
+      map_priority(Queue_priority::HIGH);
+  static constexpr std::size_t k_levels = k_max_priority + 1;
+  static constexpr std::size_t k_max_default_shards = 64;
+
+  // each shard is placed in a separate cache line
+  struct alignas(64) Shard {
+    std::mutex mutex;
+    std::array<std::deque<T>, k_levels> queues;
+    // allows to skip empty shards without locking them
+    std::atomic<std::size_t> size{0};
+  };
+
+  inline Shard &own_shard() const {
+    return m_shards[detail::work_stealing_thread_index() % m_shard_count];
+  }
+
+  template <class U>
+  void unsynchronized_push(U &&u, std::size_t l) {
+    {
+      auto &shard = own_shard();
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.queues[l].emplace_back(std::forward<U>(u));
+      ++shard.size;
+      ++m_level_size[l];
+    }
+
+    // item is counted once it's stored, so a claimed item can always be taken
+    ++m_size;
+  }
+
+  /**
+   * Reserves one of the stored items for the calling thread, waits until an
+   * item is available or deadline passes (if given).
+   */
+  bool claim(const std::chrono::steady_clock::time_point *deadline) {
+    if (try_claim()) {
+      return true;
+    }
+
+    std::unique_lock<std::mutex> lock(m_wait_mutex);
+    bool claimed = false;
+
+    ++m_waiting;
+
+    while (!(claimed = try_claim())) {
+      if (!deadline) {
+        m_item_ready.wait(lock);
+      } else if (std::cv_status::timeout ==
+                 m_item_ready.wait_until(lock, *deadline)) {
+        claimed = try_claim();
+        break;
+      }
+    }
+
+    --m_waiting;
+
+    return claimed;
+  }
+
+  bool try_claim() {
+    auto size = m_size.load();
+
+    while (size > 0) {
+      if (m_size.compare_exchange_weak(size, size - 1)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * Takes the item with the highest priority, trying the own shard first.
+   * Needs to be preceded by a successful claim().
+   */
+  T take() {
+    const auto &own = own_shard();
+    const auto first = static_cast<std::size_t>(&own - m_shards.get());
+
+    while (true) {
+      for (std::size_t l = 0; l < k_levels; ++l) {
+        if (0 == m_level_size[l]) {
+          continue;
+        }
+
+        for (std::size_t i = 0; i < m_shard_count; ++i) {
+          auto &shard = m_shards[(first + i) % m_shard_count];
+
+          if (0 == shard.size) {
+            continue;
+          }
+
+          std::lock_guard<std::mutex> lock(shard.mutex);
+          auto &queue = shard.queues[l];
+
+          if (!queue.empty()) {
+            auto r = std::move(queue.front());
+            queue.pop_front();
+            --shard.size;
+            --m_level_size[l];
+            return r;
+          }
+        }
+      }
+
+      // other threads took the items which were seen while the levels were
+      // checked, an item for this claim is still stored, try again
+      std::this_thread::yield();
+    }
+  }
+
+  void wake_one() {
+    // a sleeping consumer increases m_waiting before it checks m_size, which
+    // was already increased here, so notification is not lost
+    if (m_waiting > 0) {
+      std::lock_guard<std::mutex> lock(m_wait_mutex);
+      m_item_ready.notify_one();
+    }
+  }
+
+  void wake_all() {
+    std::lock_guard<std::mutex> lock(m_wait_mutex);
+    m_item_ready.notify_all();
+  }
+
+  const std::size_t m_shard_count;
+  std::unique_ptr<Shard[]> m_shards;
+
+  // number of stored items which were not claimed yet
+  std::atomic<std::size_t> m_size{0};
+  // number of stored items per level
+  std::array<std::atomic<std::size_t>, k_levels> m_level_size{};
+
+  std::mutex m_wait_mutex;
+  std::condition_variable m_item_ready;
+  std::atomic<std::size_t> m_waiting{0};
+};
+
+}  // namespace shcore
+
+#endif  // MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
@@ -27,13 +27,15 @@
 #include <algorithm>
 #include <cinttypes>
 #include <deque>
+#include <string_view>
 
 #include "ext/linenoise-ng/include/linenoise.h"
 #include "mysqlshdk/include/shellcore/base_shell.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/db/column.h"
-#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/db/row_batch.h"
 #include "mysqlshdk/libs/utils/dtoa.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_encoding.h"  // base64 encoding utilities
 #include "mysqlshdk/libs/utils/utils_json.h"
@@ -47,6 +49,9 @@
 // in order to calculate column widths
 static constexpr const int k_pre_fetch_result_rows = 1000;
 
+// size of the blocks of output passed to the printer
+static constexpr const size_t k_output_block_size = 64 * 1024;
+
 namespace mysqlsh {
 
 /* Calculates the required buffer size and display size considering:
@@ -222,7 +227,7 @@ std::tuple<size_t, size_t> get_utf8_sizes(const char *text, size_t length,
 
 namespace {
 
-enum class ResultFormat { VERTICAL, TABBED, TABLE };
+enum class ResultFormat { VERTICAL, TABLE };
 
 class Field_formatter {
  public:
@@ -237,11 +242,6 @@ class Field_formatter {
     m_zerofill = column.is_zerofill() ? column.get_length() : 0;
 
     switch (m_format) {
-      case ResultFormat::TABBED:
-        m_flags = Print_flags(Print_flag::PRINT_0_AS_ESC);
-        m_flags.set(Print_flag::PRINT_CTRL);
-        m_align_right = false;
-        break;
       case ResultFormat::VERTICAL:
         m_flags = Print_flags(Print_flag::PRINT_0_AS_SPC);
         m_align_right = false;
@@ -366,7 +366,8 @@ class Field_formatter {
     return true;
   }
 
-  const std::string &str() const { return m_buffer; }
+  // the formatted value may be terminated before the end of the buffer
+  const char *c_str() const { return m_buffer.c_str(); }
   size_t get_max_display_length() const { return m_max_display_length; }
   size_t get_max_buffer_length() const { return m_max_buffer_length; }
 
@@ -463,6 +464,12 @@ class Console_printer : public Resultset_printer {
     m_console->raw_print(s, mysqlsh::Output_stream::STDOUT, false);
   }
 
+  bool can_merge_output() const override {
+    // when JSON wrapping is enabled, each call to print() produces a separate
+    // JSON document
+    return mysqlsh::current_shell_options()->get().wrap_json == "off";
+  }
+
  private:
   std::shared_ptr<IConsole> m_console;
 };
@@ -488,6 +495,204 @@ class String_printer : public Resultset_printer {
   std::string m_output;
 };
 
+/**
+ * Collects the text produced while dumping the rows and passes it to the
+ * printer in big blocks, instead of calling the printer for each piece of each
+ * field.
+ */
+class Buffered_output final {
+ public:
+  explicit Buffered_output(Resultset_printer *printer)
+      : m_printer(printer), m_merge(printer->can_merge_output()) {
+    m_buffer.reserve(k_output_block_size + MAX_DISPLAY_LENGTH);
+  }
+
+  Buffered_output(const Buffered_output &) = delete;
+  Buffered_output(Buffered_output &&) = delete;
+
+  Buffered_output &operator=(const Buffered_output &) = delete;
+  Buffered_output &operator=(Buffered_output &&) = delete;
+
+  ~Buffered_output() {
+    try {
+      flush();
+    } catch (const std::exception &e) {
+      log_error("Failed to print the result: %s", e.what());
+    }
+  }
+
+  /**
+   * Same as Resultset_printer::print().
+   */
+  void print(std::string_view s) {
+    if (m_merge && !has_nul(s)) {
+      append(s, false);
+    } else {
+      flush();
+      m_printer->print(std::string{s});
+    }
+  }
+
+  void print(char c) { print(std::string_view{&c, 1}); }
+
+  /**
+   * Same as Resultset_printer::raw_print().
+   */
+  void raw_print(std::string_view s) {
+    if (!has_nul(s)) {
+      append(s, true);
+    } else {
+      flush();
+      m_printer->raw_print(std::string{s});
+    }
+  }
+
+  void flush() {
+    if (m_buffer.empty()) return;
+
+    if (m_raw) {
+      m_printer->raw_print(m_buffer);
+    } else {
+      m_printer->print(m_buffer);
+    }
+
+    m_buffer.clear();
+  }
+
+ private:
+  static bool has_nul(std::string_view s) {
+    // printer may stop at the first NUL character, such text is not merged
+    return std::string_view::npos != s.find('\0');
+  }
+
+  void append(std::string_view s, bool raw) {
+    // if output cannot be merged, raw and formatted text cannot be mixed
+    if (!m_merge && raw != m_raw) flush();
+
+    m_raw = raw;
+    m_buffer.append(s);
+
+    if (m_buffer.size() >= k_output_block_size) flush();
+  }
+
+  Resultset_printer *m_printer;
+  const bool m_merge;
+  bool m_raw = true;
+  std::string m_buffer;
+};
+
+/**
+ * Writes a field in the tabbed format, without the column formatting.
+ *
+ * Control characters are escaped, unless the escaped value is longer than
+ * MAX_DISPLAY_LENGTH, in which case it's written as is.
+ */
+void put_tabbed(const mysqlshdk::db::IRow *row, size_t index,
+                const mysqlshdk::db::Column &column, Buffered_output *out) {
+  using mysqlshdk::db::Type;
+
+  if (row->is_null(index)) {
+    out->print("NULL");
+    return;
+  }
+
+  const auto type = column.get_type();
+  std::string tmp;
+  std::string_view data;
+
+  if (column.is_numeric()) {
+    if (Type::Integer == type) {
+      tmp = std::to_string(row->get_int(index));
+    } else if (Type::UInteger == type) {
+      tmp = std::to_string(row->get_uint(index));
+    } else if (Type::Float == type) {
+      tmp = shcore::ftoa(row->get_float(index));
+    } else if (Type::Double == type) {
+      tmp = shcore::dtoa(row->get_double(index));
+    } else {
+      tmp = row->get_as_string(index);
+    }
+
+    if (column.is_zerofill() && column.get_length() > tmp.length()) {
+      tmp.insert(0, column.get_length() - tmp.length(), '0');
+    }
+
+    out->print(tmp);
+    return;
+  }
+
+  if (Type::Bit == type) {
+    const auto [bit_value, bit_size] = row->get_bit(index);
+    out->print(shcore::bits_to_string_hex(bit_value, bit_size));
+    return;
+  }
+
+  if (Type::Bytes == type) {
+    const auto [ptr, length] = row->get_string_data(index);
+
+    if (2 + 2 * length > MAX_DISPLAY_LENGTH) {
+      out->print({ptr, length});
+    } else {
+      out->print(shcore::string_to_hex({ptr, length}));
+    }
+
+    return;
+  }
+
+  if (Type::String == type) {
+    const auto [ptr, length] = row->get_string_data(index);
+    data = {ptr, length};
+  } else {
+    tmp = row->get_as_string(index);
+    data = tmp;
+  }
+
+  const auto needs_escape = [](char c) {
+    return '\0' == c || '\t' == c || '\n' == c || '\\' == c;
+  };
+
+  const auto escapes =
+      static_cast<size_t>(std::count_if(data.begin(), data.end(), needs_escape));
+
+  if (0 == escapes || data.length() + escapes > MAX_DISPLAY_LENGTH) {
+    out->print(data);
+    return;
+  }
+
+  size_t begin = 0;
+
+  for (size_t i = 0; i < data.length(); ++i) {
+    const auto c = data[i];
+
+    if (needs_escape(c)) {
+      out->print(data.substr(begin, i - begin));
+      out->print('\\');
+
+      switch (c) {
+        case '\0':
+          out->print('0');
+          break;
+
+        case '\t':
+          out->print('t');
+          break;
+
+        case '\n':
+          out->print('n');
+          break;
+
+        default:
+          out->print(c);
+          break;
+      }
+
+      begin = i + 1;
+    }
+  }
+
+  out->print(data.substr(begin));
+}
+
 }  // namespace
 
 Resultset_dumper_base::Resultset_dumper_base(
@@ -606,7 +811,7 @@ void dump_json_row(shcore::JSON_dumper *dumper,
   dumper->start_object();
 
   for (size_t col_index = 0; col_index < metadata.size(); col_index++) {
-    auto column = metadata[col_index];
+    const auto &column = metadata[col_index];
 
     dumper->append_string(column.get_column_label());
     auto type = column.get_type();
@@ -668,16 +873,18 @@ size_t Resultset_dumper_base::dump_documents(bool is_doc_result) {
 
   if (!row) return row_count;
 
-  if (as_array) m_printer->raw_print("[\n");
+  Buffered_output out{m_printer.get()};
+
+  if (as_array) out.raw_print("[\n");
   while (row) {
     shcore::JSON_dumper dumper(
         pretty, mysqlsh::current_shell_options()->get().binary_limit);
 
     if (row_count > 0) {
       if (as_array)
-        m_printer->raw_print(",\n");
+        out.raw_print(",\n");
       else
-        m_printer->raw_print("\n");
+        out.raw_print("\n");
     }
 
     if (is_doc_result)
@@ -685,13 +892,13 @@ size_t Resultset_dumper_base::dump_documents(bool is_doc_result) {
     else
       dump_json_row(&dumper, metadata, row);
 
-    m_printer->raw_print(dumper.str());
+    out.raw_print(dumper.str());
 
     row_count++;
     row = m_result->fetch_one();
   }
-  m_printer->raw_print("\n");
-  if (as_array) m_printer->raw_print("]\n");
+  out.raw_print("\n");
+  if (as_array) out.raw_print("]\n");
 
   return row_count;
 }
@@ -703,31 +910,20 @@ size_t Resultset_dumper_base::dump_tabbed() {
 
   if (!row) return row_index;
 
-  size_t index = 0;
-  size_t field_count = metadata.size();
-  std::vector<std::string> formats(field_count, "%-");
-  std::vector<Field_formatter> fmt;
-
-  // Prints the initial separator line and the column headers
-  for (index = 0; index < field_count; index++) {
-    auto column = metadata[index];
+  const size_t field_count = metadata.size();
+  Buffered_output out{m_printer.get()};
 
-    fmt.emplace_back(ResultFormat::TABBED, column);
-    m_printer->print(column.get_column_label().c_str());
-    m_printer->print(index < (field_count - 1) ? "\t" : "\n");
+  // Prints the column headers
+  for (size_t index = 0; index < field_count; index++) {
+    out.print(metadata[index].get_column_label());
+    out.print(index < (field_count - 1) ? '\t' : '\n');
   }
 
   // Now prints the records
   while (row && !m_cancelled) {
     for (size_t field_index = 0; field_index < field_count; field_index++) {
-      auto column = metadata[field_index];
-      if (fmt[field_index].put(row, field_index)) {
-        m_printer->print(fmt[field_index].str());
-      } else {
-        mysqlshdk::db::is_string_type(column.get_type());
-        m_printer->print(row->get_string(field_index));
-      }
-      m_printer->print(field_index < (field_count - 1) ? "\t" : "\n");
+      put_tabbed(row, field_index, metadata[field_index], &out);
+      out.print(field_index < (field_count - 1) ? '\t' : '\n');
     }
 
     row = m_result->fetch_one();
@@ -757,6 +953,23 @@ size_t Resultset_dumper_base::format_vertical(bool has_header, bool align_right,
     fmt.emplace_back(ResultFormat::VERTICAL, column);
   }
 
+  // labels do not change between the rows
+  std::vector<std::string> labels;
+
+  for (const auto &column : metadata) {
+    std::string padding(max_col_len - column.get_column_label().size(), ' ');
+    std::string label = column.get_column_label() + ": ";
+
+    if (align_right) {
+      label = padding + label;
+    } else {
+      label += padding;
+    }
+
+    labels.emplace_back(std::move(label));
+  }
+
+  Buffered_output out{m_printer.get()};
   auto row = m_result->fetch_one();
   size_t row_index = 0;
   while (row && !m_cancelled) {
@@ -765,29 +978,18 @@ size_t Resultset_dumper_base::format_vertical(bool has_header, bool align_right,
                                std::to_string(row_index + 1) + ". row " +
                                star_separator + "\n";
 
-      m_printer->print(row_header);
+      out.print(row_header);
     }
 
     for (size_t col_index = 0; col_index < metadata.size(); col_index++) {
-      auto column = metadata[col_index];
-
-      std::string padding(max_col_len - column.get_column_label().size(), ' ');
-      std::string label = column.get_column_label() + ": ";
-
-      if (align_right) {
-        label = padding + label;
-      } else {
-        label += padding;
-      }
-
-      m_printer->print(label);
+      out.print(labels[col_index]);
       if (fmt[col_index].put(row, col_index)) {
-        m_printer->print(fmt[col_index].str());
+        out.print(fmt[col_index].c_str());
       } else {
-        assert(mysqlshdk::db::is_string_type(column.get_type()));
-        m_printer->print(row->get_string(col_index));
+        assert(mysqlshdk::db::is_string_type(metadata[col_index].get_type()));
+        out.print(row->get_string(col_index));
       }
-      m_printer->raw_print("\n");
+      out.raw_print("\n");
     }
 
     row = m_result->fetch_one();
@@ -904,7 +1106,7 @@ size_t Resultset_dumper_base::dump_json(const std::string &item_label,
 size_t Resultset_dumper_base::dump_table() {
   const auto &metadata = m_result->get_metadata();
   std::vector<Field_formatter> fmt;
-  std::vector<mysqlshdk::db::Row_copy> pre_fetched_rows;
+  mysqlshdk::db::Row_batch pre_fetched_rows;
   size_t num_records = 0;
   const size_t field_count = metadata.size();
   if (field_count == 0) return 0;
@@ -916,11 +1118,10 @@ size_t Resultset_dumper_base::dump_table() {
     fmt.emplace_back(ResultFormat::TABLE, column);
   }
 
-  pre_fetched_rows.reserve(k_pre_fetch_result_rows);
   {
     auto row = m_result->fetch_one();
     while (row && !m_cancelled) {
-      pre_fetched_rows.emplace_back(*row);
+      pre_fetched_rows.append(*row);
 
       for (size_t field_index = 0; field_index < field_count; field_index++) {
         fmt[field_index].process(row, field_index);
@@ -935,6 +1136,7 @@ size_t Resultset_dumper_base::dump_table() {
 
   //-----------
 
+  Buffered_output out{m_printer.get()};
   size_t index = 0;
 
   std::string separator("+");
@@ -946,40 +1148,40 @@ size_t Resultset_dumper_base::dump_table() {
   separator.append("\n");
 
   // Prints the initial separator line and the column headers
-  m_printer->print(separator);
-  m_printer->print("| ");
+  out.print(separator);
+  out.print("| ");
   for (index = 0; index < field_count; index++) {
     std::string format = "%-";
     format.append(std::to_string(fmt[index].get_max_display_length()));
     format.append((index == field_count - 1) ? "s |\n" : "s | ");
     auto column = metadata[index];
-    m_printer->print(
+    out.print(
         shcore::str_format(format.c_str(), column.get_column_label().c_str()));
   }
-  m_printer->print(separator);
+  out.print(separator);
 
   // Print pre-fetched records
   for (const auto &row : pre_fetched_rows) {
     ++num_records;
-    m_printer->print("| ");
+    out.print("| ");
 
     for (size_t field_index = 0; field_index < field_count; field_index++) {
       if (fmt[field_index].put(&row, field_index)) {
-        m_printer->print(fmt[field_index].str());
+        out.print(fmt[field_index].c_str());
       } else {
         assert(mysqlshdk::db::is_string_type(metadata[field_index].get_type()));
         if (row.get_type(field_index) == mysqlshdk::db::Type::Bytes) {
           const char *data;
           size_t length;
           std::tie(data, length) = row.get_string_data(field_index);
-          m_printer->print(shcore::string_to_hex({data, length}));
+          out.print(shcore::string_to_hex({data, length}));
         } else {
-          m_printer->print(row.get_as_string(field_index));
+          out.print(row.get_as_string(field_index));
         }
       }
-      if (field_index < field_count - 1) m_printer->print(" | ");
+      if (field_index < field_count - 1) out.print(" | ");
     }
-    m_printer->print(" |\n");
+    out.print(" |\n");
 
     if (m_cancelled) break;
   }
@@ -988,23 +1190,23 @@ size_t Resultset_dumper_base::dump_table() {
     auto row = m_result->fetch_one();
     while (row && !m_cancelled) {
       ++num_records;
-      m_printer->print("| ");
+      out.print("| ");
 
       for (size_t field_index = 0; field_index < field_count; field_index++) {
         if (fmt[field_index].put(row, field_index)) {
-          m_printer->print(fmt[field_index].str());
+          out.print(fmt[field_index].c_str());
         } else {
           assert(
               mysqlshdk::db::is_string_type(metadata[field_index].get_type()));
-          m_printer->print(row->get_as_string(field_index));
+          out.print(row->get_as_string(field_index));
         }
-        if (field_index < field_count - 1) m_printer->print(" | ");
+        if (field_index < field_count - 1) out.print(" | ");
       }
-      m_printer->print(" |\n");
+      out.print(" |\n");
       row = m_result->fetch_one();
     }
   }
-  m_printer->print(separator);
+  out.print(separator);
 
   return num_records;
 }
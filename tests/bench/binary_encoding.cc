@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/dialect_dump_writer.h"
+#include "modules/util/dump/encoder.h"
+#include "modules/util/dump/text_dump_writer.h"
+#include "modules/util/import_table/dialect.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row_batch.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using mysqlsh::dump::Dump_writer;
+using mysqlshdk::db::Column;
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Row_batch;
+using mysqlshdk::db::Type;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+using Encoding_type = mysqlsh::dump::Dump_writer::Encoding_type;
+
+Column column(const std::string &name, Type type) {
+  return Column("def", "bench", "blobs", "blobs", name, name, 0, 0, type, 63,
+                false, false, Type::Bytes == type);
+}
+
+// same as the output of TO_BASE64(): lines of 76 characters
+std::string server_base64(const std::string &data) {
+  std::string encoded(mysqlsh::dump::encoder::base64_length(data.size()),
+                      '\0');
+  mysqlsh::dump::encoder::base64(data.data(), data.size(), encoded.data());
+
+  std::string result;
+
+  for (size_t offset = 0; offset < encoded.size(); offset += 76) {
+    if (offset) result += '\n';
+    result += encoded.substr(offset, 76);
+  }
+
+  return result;
+}
+
+struct Table {
+  std::vector<Column> metadata;
+  std::vector<Encoding_type> encoding;
+  Row_batch rows;
+};
+
+// (id, blob) rows, blobs are fetched either as TO_BASE64() or raw
+void generate(size_t count, Table *server, Table *client) {
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> size(0, 4096);
+  std::uniform_int_distribution<> byte(0, 255);
+
+  server->metadata = {column("id", Type::Integer),
+                      column("data", Type::String)};
+  server->encoding = {Encoding_type::NONE, Encoding_type::BASE64};
+
+  client->metadata = {column("id", Type::Integer),
+                      column("data", Type::Bytes)};
+  client->encoding = {Encoding_type::NONE, Encoding_type::ENCODE_BASE64};
+
+  for (size_t i = 0; i < count; ++i) {
+    std::string data(size(gen), '\0');
+
+    for (auto &c : data) {
+      c = static_cast<char>(byte(gen));
+    }
+
+    const auto id = static_cast<int64_t>(i);
+
+    server->rows.append(Mutable_row({Type::Integer, Type::String}, id,
+                                    server_base64(data)));
+    client->rows.append(Mutable_row({Type::Integer, Type::Bytes}, id, data));
+  }
+}
+
+std::string write(Dump_writer *writer, const Table &table, double *seconds) {
+  Memory_file file{""};
+  file.open(Mode::WRITE);
+
+  writer->set_output_file(&file);
+
+  const auto t_start = std::chrono::steady_clock::now();
+
+  writer->open();
+  writer->write_preamble(table.metadata, table.encoding);
+
+  for (const auto &row : table.rows) {
+    writer->write_row(&row);
+  }
+
+  writer->write_postamble();
+  writer->close();
+
+  const auto t_end = std::chrono::steady_clock::now();
+  *seconds = std::chrono::duration<double>(t_end - t_start).count();
+
+  file.close();
+
+  return file.content();
+}
+
+template <typename F>
+void run(const std::string &name, const Table &server, const Table &client,
+         F &&make_writer) {
+  double t_server = 0;
+  const auto server_output = write(make_writer().get(), server, &t_server);
+
+  double t_client = 0;
+  const auto client_output = write(make_writer().get(), client, &t_client);
+
+  if (server_output != client_output) {
+    throw std::runtime_error(name + ": outputs are different");
+  }
+
+  const auto mbytes = server_output.size() / 1000.0 / 1000.0;
+
+  std::cout << "# " << name << ": " << mbytes << " Mbytes written, "
+            << "TO_BASE64() " << mbytes / t_server << " Mbytes/s, "
+            << "client encoding " << mbytes / t_client << " Mbytes/s\n";
+}
+
+}  // namespace
+
+int main() {
+  constexpr size_t k_rows = 50000;
+
+  Table server;
+  Table client;
+  generate(k_rows, &server, &client);
+
+  std::cout << "# implementation: " << mysqlsh::dump::encoder::implementation()
+            << "\n";
+  std::cout << "# fetched: TO_BASE64() "
+            << server.rows.data_size() / 1000.0 / 1000.0
+            << " Mbytes, client encoding "
+            << client.rows.data_size() / 1000.0 / 1000.0 << " Mbytes\n";
+
+  run("default dialect", server, client, []() {
+    return std::make_unique<mysqlsh::dump::Default_dump_writer>();
+  });
+
+  run("csv dialect", server, client, []() {
+    return std::make_unique<mysqlsh::dump::Csv_dump_writer>();
+  });
+
+  run("custom dialect", server, client, []() {
+    auto dialect = mysqlsh::import_table::Dialect::default_();
+    dialect.lines_terminated_by = "\r\n";
+    return std::make_unique<mysqlsh::dump::Text_dump_writer>(dialect);
+  });
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using mysqlshdk::storage::Compression;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+// resembles the contents of a TSV dump chunk
+std::string generate_data(size_t size) {
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> words(1, 8);
+  std::uniform_int_distribution<> word(0, 63);
+  std::uniform_int_distribution<> number(0, 1000000);
+
+  std::vector<std::string> dictionary;
+
+  for (int i = 0; i < 64; ++i) {
+    dictionary.emplace_back("word" + std::to_string(i * 7919 % 1000));
+  }
+
+  std::string data;
+  data.reserve(size + 1024);
+
+  for (size_t id = 1; data.size() < size; ++id) {
+    data += std::to_string(id);
+    data += '\t';
+    data += std::to_string(number(gen));
+    data += '\t';
+
+    for (int i = words(gen); i > 0; --i) {
+      data += dictionary[word(gen)];
+      if (i > 1) data += ' ';
+    }
+
+    data += "\t2024-01-01 00:00:00\n";
+  }
+
+  return data;
+}
+
+std::string read_file(const std::string &path) {
+  std::ifstream in(path, std::ios::binary);
+
+  if (!in) {
+    throw std::runtime_error("Cannot open " + path);
+  }
+
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+template <typename F>
+double measure(F &&f) {
+  const auto t_start = std::chrono::steady_clock::now();
+  f();
+  const auto t_end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(t_end - t_start).count();
+}
+
+void run(const std::string &name, const std::string &data, Compression c) {
+  constexpr size_t k_io_size = 64 * 1024;
+
+  auto memory = std::make_unique<Memory_file>("");
+  auto *raw = memory.get();
+  auto file = mysqlshdk::storage::make_file(std::move(memory), c);
+
+  const auto t_compress = measure([&]() {
+    file->open(Mode::WRITE);
+
+    for (size_t offset = 0; offset < data.size(); offset += k_io_size) {
+      file->write(data.data() + offset,
+                  std::min(k_io_size, data.size() - offset));
+    }
+
+    file->close();
+  });
+
+  const auto compressed_size = raw->content().size();
+  std::string buffer(k_io_size, '\0');
+  size_t decompressed_size = 0;
+
+  const auto t_decompress = measure([&]() {
+    file->open(Mode::READ);
+
+    ssize_t bytes;
+
+    while ((bytes = file->read(buffer.data(), buffer.size())) > 0) {
+      decompressed_size += bytes;
+    }
+
+    file->close();
+  });
+
+  if (decompressed_size != data.size()) {
+    throw std::runtime_error(name + ": " + to_string(c) +
+                             " roundtrip produced a different size");
+  }
+
+  const auto mbytes = data.size() / 1000.0 / 1000.0;
+
+  std::cout << "# " << name << " " << to_string(c) << ": ratio "
+            << static_cast<double>(data.size()) / compressed_size
+            << ", compression " << mbytes / t_compress << " Mbytes/s"
+            << ", decompression " << mbytes / t_decompress << " Mbytes/s\n";
+}
+
+}  // namespace
+
+// Usage: bench_compression [dump chunk files (uncompressed)...]
+int main(int argc, char **argv) {
+  constexpr size_t k_size = 64 * 1024 * 1024;
+
+  std::vector<std::pair<std::string, std::string>> inputs;
+
+  if (argc > 1) {
+    for (int i = 1; i < argc; ++i) {
+      inputs.emplace_back(argv[i], read_file(argv[i]));
+    }
+  } else {
+    inputs.emplace_back("generated", generate_data(k_size));
+  }
+
+  for (const auto &input : inputs) {
+    for (const auto c : {Compression::GZIP, Compression::ZSTD,
+                         Compression::LZ4}) {
+      run(input.first, input.second, c);
+    }
+  }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/mysql/gtid_utils.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/mysql/instance.h"
+
+namespace {
+
+using mysqlshdk::mysql::Gtid_set;
+
+// GTID set similar to the ones found in long-lived topologies: many UUIDs,
+// each one with some gaps
+std::string generate(int uuids, int intervals, int offset) {
+  std::string result;
+  char uuid[40];
+
+  for (int u = 0; u < uuids; ++u) {
+    snprintf(uuid, sizeof(uuid), "%08x-8803-11eb-af3d-a1178d81dccc", u * 7);
+
+    if (!result.empty()) result += ",\n";
+
+    result += uuid;
+
+    for (int i = 0; i < intervals; ++i) {
+      const auto start = i * 1000 + offset + 1;
+      result += ':' + std::to_string(start) + '-' + std::to_string(start + 500);
+    }
+  }
+
+  return result;
+}
+
+template <typename F>
+void run(const std::string &name, int iterations, F &&f) {
+  const auto start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < iterations; ++i) {
+    f();
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto seconds = std::chrono::duration<double>(end - start).count();
+
+  std::cout << "# " << name << ": " << seconds / iterations * 1000.0 * 1000.0
+            << " us/op" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  // optional URI of a server, used to compare with the GTID functions
+  const std::string uri = argc > 1 ? argv[1] : "";
+  const int uuids = argc > 2 ? std::atoi(argv[2]) : 1000;
+  const int intervals = argc > 3 ? std::atoi(argv[3]) : 10;
+  const int iterations = 100;
+
+  const auto text_a = generate(uuids, intervals, 0);
+  const auto text_b = generate(uuids, intervals, 250);
+  const auto a = Gtid_set::from_string(text_a);
+  const auto b = Gtid_set::from_string(text_b);
+
+  std::cout << "# UUIDs: " << uuids << ", intervals: " << intervals
+            << ", text size: " << text_a.size() << " bytes" << std::endl;
+
+  run("parse", iterations, [&text_a]() { Gtid_set::from_string(text_a); });
+  run("str()", iterations, [&a]() { a.str(); });
+  run("add()", iterations, [&a, &b]() { Gtid_set(a).add(b); });
+  run("subtract()", iterations, [&a, &b]() { Gtid_set(a).subtract(b); });
+  run("intersect()", iterations, [&a, &b]() { Gtid_set(a).intersect(b); });
+  run("contains()", iterations, [&a, &b]() { a.contains(b); });
+  run("parse + subtract() + str()", iterations, [&text_a, &text_b]() {
+    Gtid_set::from_string(text_a)
+        .subtract(Gtid_set::from_string(text_b))
+        .str();
+  });
+
+  if (!uri.empty()) {
+    auto session = mysqlshdk::db::mysql::Session::create();
+    session->connect(mysqlshdk::db::Connection_options(uri));
+    mysqlshdk::mysql::Instance server(session);
+
+    // the way Gtid_set used to compute the results
+    run("server: gtid_subtract()", iterations, [&server, &text_a, &text_b]() {
+      server.queryf_one_string(0, "", "SELECT gtid_subtract(?, ?)", text_a,
+                               text_b);
+    });
+    run("server: intersect", iterations, [&server, &text_a, &text_b]() {
+      server.queryf_one_string(0, "",
+                               "SELECT gtid_subtract(?, gtid_subtract(?, ?))",
+                               text_b, text_b, text_a);
+    });
+    run("server: contains", iterations, [&server, &text_a, &text_b]() {
+      server.queryf_one_int(0, 0, "SELECT gtid_subtract(?, ?) = ''", text_b,
+                            text_a);
+    });
+
+    if (server.queryf_one_string(0, "", "SELECT gtid_subtract(?, ?)", text_a,
+                                 text_b) != Gtid_set(a).subtract(b).str()) {
+      std::cerr << "Results of subtract() differ" << std::endl;
+      return 1;
+    }
+
+    session->close();
+  }
+
+  return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/include/shellcore/shell_resultset_dumper.h"
+#include "mysqlshdk/libs/db/mutable_result.h"
+
+namespace {
+
+using mysqlshdk::db::Mutable_result;
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Type;
+
+// discards the output, counts the calls and bytes
+class Null_printer : public mysqlsh::Resultset_printer {
+ public:
+  void print(const std::string &s) override {
+    ++calls;
+    bytes += s.size();
+  }
+
+  void println(const std::string &s) override { print(s + "\n"); }
+
+  void raw_print(const std::string &s) override { print(s); }
+
+  void reset() override {
+    calls = 0;
+    bytes = 0;
+  }
+
+  size_t calls = 0;
+  size_t bytes = 0;
+};
+
+class Bench_writer : public mysqlsh::Resultset_writer {
+ public:
+  Bench_writer(mysqlshdk::db::IResult *target, const std::string &format,
+               Null_printer *printer)
+      : Resultset_writer(target, std::unique_ptr<Null_printer>(printer),
+                         "off", format) {}
+
+  size_t dump(const std::string &format) {
+    if ("table" == format) return dump_table();
+    if ("tabbed" == format) return dump_tabbed();
+    if ("vertical" == format) return dump_vertical();
+    return dump_documents(false);
+  }
+};
+
+std::unique_ptr<Mutable_result> make_result(int rows) {
+  std::vector<mysqlshdk::db::Column> metadata;
+  std::vector<Type> types;
+
+  for (int c = 0; c < 10; ++c) {
+    const auto type = c % 2 ? Type::String : Type::Integer;
+    metadata.emplace_back(
+        Mutable_result::make_column("column_" + std::to_string(c), type));
+    types.emplace_back(type);
+  }
+
+  auto result = std::make_unique<Mutable_result>(metadata);
+
+  for (int r = 0; r < rows; ++r) {
+    auto row = std::make_unique<Mutable_row>(types);
+
+    for (int c = 0; c < 10; ++c) {
+      if (c % 2) {
+        row->set_field(c, "some text\tvalue " + std::to_string(r * c));
+      } else {
+        row->set_field(c, static_cast<int64_t>(r) * c);
+      }
+    }
+
+    result->add_row(std::move(row));
+  }
+
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int rows = argc > 1 ? std::atoi(argv[1]) : 1000000;
+
+  mysqlsh::Scoped_shell_options options(
+      std::make_shared<mysqlsh::Shell_options>(0, nullptr));
+
+  const auto result = make_result(rows);
+
+  for (const auto format :
+       {"table", "tabbed", "vertical", "json/raw", "json/array", "json"}) {
+    result->reset();
+
+    const auto printer = new Null_printer();
+    Bench_writer writer{result.get(), format, printer};
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto count = writer.dump(format);
+    const auto end = std::chrono::steady_clock::now();
+    const auto seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << "# " << format << ": " << count / seconds << " rows/s, "
+              << printer->bytes / seconds / (1024 * 1024) << " MB/s, "
+              << printer->calls << " calls to the printer" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/row_batch.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+// counts the memory which is currently allocated
+namespace {
+
+std::atomic<size_t> g_allocated{0};
+
+// keeps the requested size in front of the allocated block
+constexpr size_t k_header = alignof(std::max_align_t);
+
+}  // namespace
+
+void *operator new(size_t size) {
+  const auto p = static_cast<char *>(std::malloc(size + k_header));
+  if (!p) throw std::bad_alloc();
+  *reinterpret_cast<size_t *>(p) = size;
+  g_allocated += size;
+  return p + k_header;
+}
+
+void operator delete(void *ptr) noexcept {
+  if (!ptr) return;
+  const auto p = static_cast<char *>(ptr) - k_header;
+  g_allocated -= *reinterpret_cast<size_t *>(p);
+  std::free(p);
+}
+
+void operator delete(void *ptr, size_t) noexcept { operator delete(ptr); }
+
+namespace {
+
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Row_batch;
+using mysqlshdk::db::Row_copy;
+using mysqlshdk::db::Type;
+
+std::deque<Mutable_row> narrow_rows() {
+  const std::vector<Type> types = {Type::Integer, Type::Integer, Type::String};
+  std::deque<Mutable_row> rows;
+
+  for (int i = 0; i < 1000; ++i) {
+    rows.emplace_back(types, i, i * 7, "name " + std::to_string(i));
+  }
+
+  return rows;
+}
+
+std::deque<Mutable_row> wide_rows() {
+  std::vector<Type> types;
+
+  for (int i = 0; i < 10; ++i) {
+    types.emplace_back(Type::Integer);
+    types.emplace_back(Type::String);
+    types.emplace_back(Type::Double);
+  }
+
+  std::deque<Mutable_row> rows;
+
+  for (int i = 0; i < 1000; ++i) {
+    auto &row = rows.emplace_back(types);
+
+    for (uint32_t f = 0; f < types.size(); f += 3) {
+      row.set_field(f, static_cast<int64_t>(i * f));
+      // some of the values are NULL
+      if (i % 5) row.set_field(f + 1, std::string(i % 50, 'x'));
+      row.set_field(f + 2, i * 0.5);
+    }
+  }
+
+  return rows;
+}
+
+template <typename F>
+void run(const std::string &name, size_t count,
+         const std::deque<Mutable_row> &source, F &&buffer) {
+  const auto allocated = g_allocated.load();
+  const auto t_start = std::chrono::steady_clock::now();
+
+  const auto holder = buffer(count, source);
+
+  const auto t_end = std::chrono::steady_clock::now();
+  const auto t_int_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(t_end - t_start);
+  const auto memory = g_allocated.load() - allocated;
+
+  std::cout << "# " << name << ": " << count << " rows @ " << t_int_ms.count()
+            << "ms, " << memory / 1024 / 1024 << " Mbytes, "
+            << memory / count << " bytes/row\n";
+}
+
+}  // namespace
+
+int main() {
+  constexpr size_t k_rows = 1000000;
+
+  const auto copy = [](size_t count, const std::deque<Mutable_row> &source) {
+    // same as the previous implementation of mysql::Result::buffer()
+    auto rows = std::make_unique<std::deque<Row_copy>>();
+
+    for (size_t i = 0; i < count; ++i) {
+      rows->emplace_back(source[i % source.size()]);
+    }
+
+    return rows;
+  };
+
+  const auto batch = [](size_t count, const std::deque<Mutable_row> &source) {
+    auto rows = std::make_unique<Row_batch>();
+
+    for (size_t i = 0; i < count; ++i) {
+      rows->append(source[i % source.size()]);
+    }
+
+    rows->shrink_to_fit();
+
+    return rows;
+  };
+
+  const auto narrow = narrow_rows();
+  run("narrow Row_copy", k_rows, narrow, copy);
+  run("narrow Row_batch", k_rows, narrow, batch);
+
+  const auto wide = wide_rows();
+  run("wide Row_copy", k_rows, wide, copy);
+  run("wide Row_batch", k_rows, wide, batch);
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// python_context.h includes Python.h so it needs to be the first include
+#ifdef HAVE_PYTHON
+#include "mysqlshdk/include/scripting/python_context.h"
+#include "mysqlshdk/include/scripting/python_utils.h"
+#endif  // HAVE_PYTHON
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "modules/devapi/base_resultset.h"
+#include "mysqlshdk/include/scripting/object_registry.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/db/mutable_result.h"
+#include "mysqlshdk/shellcore/shell_console.h"
+
+#ifdef HAVE_V8
+#include "mysqlshdk/include/scripting/jscript_context.h"
+
+namespace shcore {
+extern void JScript_context_init();
+extern void JScript_context_fini();
+}  // namespace shcore
+#endif  // HAVE_V8
+
+namespace {
+
+using mysqlshdk::db::Mutable_result;
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Type;
+
+// same as ClassicResult, backed by rows held in memory
+class Bench_result : public mysqlsh::ShellBaseResult {
+ public:
+  explicit Bench_result(std::shared_ptr<Mutable_result> result)
+      : m_result(std::move(result)) {
+    expose("fetchAll", &Bench_result::fetch_all);
+  }
+
+  std::string class_name() const override { return "BenchResult"; }
+
+  mysqlshdk::db::IResult *get_result() const override {
+    return m_result.get();
+  }
+
+  bool has_data() const override { return true; }
+
+  shcore::Array_t fetch_all() const {
+    auto array = shcore::make_array();
+
+    while (auto record = fetch_one_row()) {
+      array->push_back(
+          shcore::Value(std::shared_ptr<mysqlsh::Row>(record.release())));
+    }
+
+    return array;
+  }
+
+  void rewind() { m_result->reset(); }
+
+ protected:
+  const std::vector<mysqlshdk::db::Column> &get_metadata() const override {
+    return m_result->get_metadata();
+  }
+
+  std::string get_protocol() const override { return "mysql"; }
+
+ private:
+  std::shared_ptr<Mutable_result> m_result;
+};
+
+std::shared_ptr<Bench_result> wide_result(int rows, int columns) {
+  std::vector<mysqlshdk::db::Column> metadata;
+  std::vector<Type> types;
+
+  for (int c = 0; c < columns; ++c) {
+    const auto type = c % 2 ? Type::String : Type::Integer;
+    metadata.emplace_back(
+        Mutable_result::make_column("c" + std::to_string(c), type));
+    types.emplace_back(type);
+  }
+
+  auto result = std::make_shared<Mutable_result>(metadata);
+
+  for (int r = 0; r < rows; ++r) {
+    auto row = std::make_unique<Mutable_row>(types);
+
+    for (int c = 0; c < columns; ++c) {
+      if (c % 2) {
+        row->set_field(c, "value " + std::to_string(r + c));
+      } else {
+        row->set_field(c, static_cast<int64_t>(r) * c);
+      }
+    }
+
+    result->add_row(std::move(row));
+  }
+
+  return std::make_shared<Bench_result>(std::move(result));
+}
+
+template <typename F>
+void run(const char *name, const std::shared_ptr<Bench_result> &result,
+         int rows, int iterations, F &&f) {
+  double total = 0;
+
+  for (int i = 0; i < iterations; ++i) {
+    result->rewind();
+
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+
+    total += std::chrono::duration<double>(end - start).count();
+  }
+
+  std::cout << "# " << name << ": " << total / iterations << " s, "
+            << rows * iterations / total << " rows/s" << std::endl;
+}
+
+bool print(void *, const char *text) {
+  std::cerr << text;
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const int rows = argc > 1 ? std::atoi(argv[1]) : 100000;
+  const int columns = argc > 2 ? std::atoi(argv[2]) : 50;
+  const int iterations = 5;
+
+  shcore::Interpreter_delegate deleg(nullptr, print, nullptr, print, print);
+  mysqlsh::Scoped_shell_options options(
+      std::make_shared<mysqlsh::Shell_options>(0, nullptr));
+  mysqlsh::Scoped_console console(
+      std::make_shared<mysqlsh::Shell_console>(&deleg));
+
+  const auto result = wide_result(rows, columns);
+  const auto value = shcore::Value(
+      std::static_pointer_cast<shcore::Object_bridge>(result));
+
+  std::cout << "# rows: " << rows << ", columns: " << columns << std::endl;
+
+  run("C++ fetchAll()", result, rows, iterations,
+      [&result]() { result->fetch_all(); });
+
+#ifdef HAVE_V8
+  {
+    shcore::JScript_context_init();
+
+    shcore::Object_registry registry;
+    shcore::JScript_context js(&registry);
+
+    js.set_global("result", value);
+
+    run("JS fetchAll()", result, rows, iterations,
+        [&js]() { js.execute("result.fetchAll().length"); });
+
+    run("JS fetchAll(), field access", result, rows, iterations, [&js]() {
+      js.execute(
+          "var sum = 0; for (const row of result.fetchAll()) sum += row.c0;");
+    });
+  }
+
+  shcore::JScript_context_fini();
+#endif  // HAVE_V8
+
+#ifdef HAVE_PYTHON
+  {
+    shcore::Python_context py(false);
+    shcore::WillEnterPython lock;
+
+    py.set_global("result", value);
+
+    run("Python fetch_all()", result, rows, iterations,
+        [&py]() { py.execute("len(result.fetch_all())"); });
+
+    run("Python fetch_all(), field access", result, rows, iterations, [&py]() {
+      py.execute("sum(row.c0 for row in result.fetch_all())");
+    });
+  }
+#endif  // HAVE_PYTHON
+
+  return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/chunk_file.h"
+#include "modules/util/import_table/scanner.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace {
+
+using mysqlsh::import_table::Row_scanner;
+
+std::string generate_data(const std::string &field_separator,
+                          const std::string &line_terminator, size_t size) {
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> field_length(1, 40);
+  std::uniform_int_distribution<> chars('a', 'z');
+  std::uniform_int_distribution<> special(0, 99);
+
+  std::string data;
+  data.reserve(size + 1024);
+
+  while (data.size() < size) {
+    for (int f = 0; f < 8; ++f) {
+      if (f) data += field_separator;
+
+      for (int i = field_length(gen); i > 0; --i) {
+        const auto s = special(gen);
+
+        if (s == 0) {
+          data += "\\\\";
+        } else if (s == 1) {
+          data += '\\';
+          data += line_terminator;
+        } else {
+          data += static_cast<char>(chars(gen));
+        }
+      }
+    }
+
+    data += line_terminator;
+  }
+
+  return data;
+}
+
+// previous implementation: std::string::find() + check of a preceding byte
+size_t count_rows_string_find(const std::string &data,
+                              const std::string &needle, char escape) {
+  size_t rows = 0;
+  auto p = data.find(needle);
+
+  while (p != std::string::npos) {
+    if (!(p > 0 && data[p - 1] == escape)) ++rows;
+
+    p = data.find(needle, p + needle.size());
+  }
+
+  return rows;
+}
+
+// previous implementation of the chunker: byte-by-byte search
+size_t count_rows_byte_by_byte(const std::string &data,
+                               const std::string &needle, char escape) {
+  mysqlsh::import_table::Find_context<char> context{};
+  size_t rows = 0;
+  auto first = data.begin();
+  const auto last = data.end();
+
+  while (first != last) {
+    first = mysqlsh::import_table::find(first, last, needle.begin(),
+                                        needle.end(), &context);
+
+    if (context.needle_found && !(context.preceding_element_set &&
+                                  context.preceding_element == escape)) {
+      ++rows;
+    }
+
+    context.preceding_element_set = true;
+    context.preceding_element = context.last_element;
+  }
+
+  return rows;
+}
+
+size_t count_rows_scanner(const std::string &data, const std::string &needle,
+                          const std::string &escape) {
+  Row_scanner scanner{needle, escape, true};
+  size_t rows = 0;
+  const char *first = data.data();
+  const char *last = first + data.size();
+
+  while ((first = scanner.find(first, last, last))) {
+    ++rows;
+  }
+
+  return rows;
+}
+
+template <typename F>
+void run(const std::string &name, const std::string &data, F &&f) {
+  constexpr int k_iterations = 10;
+  size_t rows = 0;
+
+  const auto t_start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < k_iterations; ++i) {
+    rows = f();
+  }
+
+  const auto t_end = std::chrono::steady_clock::now();
+  const auto t_int_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(t_end - t_start);
+  const auto bytes = data.size() * k_iterations;
+
+  std::cout << "# " << name << ": " << rows << " rows, " << bytes
+            << " bytes @ " << t_int_ms.count() << "ms";
+
+  if (t_int_ms.count()) {
+    std::cout << ", " << bytes / t_int_ms.count() / 1000.0 << " Mbytes/s";
+  }
+
+  std::cout << '\n';
+}
+
+}  // namespace
+
+int main() {
+  constexpr size_t k_size = 64 * 1024 * 1024;
+
+  std::cout << "# implementation: "
+            << mysqlsh::import_table::scanner::implementation() << '\n';
+
+  for (const auto &dialect : {std::make_pair("tsv", "\t"),
+                              std::make_pair("csv", ",")}) {
+    const std::string terminator = dialect.first == std::string{"tsv"}
+                                       ? "\n"
+                                       : "\r\n";
+    const auto data = generate_data(dialect.second, terminator, k_size);
+
+    run(std::string{dialect.first} + " std::string::find", data, [&]() {
+      return count_rows_string_find(data, terminator, '\\');
+    });
+    run(std::string{dialect.first} + " byte-by-byte", data, [&]() {
+      return count_rows_byte_by_byte(data, terminator, '\\');
+    });
+    run(std::string{dialect.first} + " Row_scanner", data,
+        [&]() { return count_rows_scanner(data, terminator, "\\"); });
+  }
+}
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/dialect_dump_writer.h"
+#include "modules/util/dump/encoder.h"
+#include "modules/util/dump/text_dump_writer.h"
+#include "modules/util/import_table/dialect.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row_batch.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using mysqlsh::dump::Dump_writer;
+using mysqlshdk::db::Column;
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Row_batch;
+using mysqlshdk::db::Type;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+constexpr int k_columns = 8;
+
+// text columns made of words, one in special_every words is followed by a
+// character which needs to be escaped
+void generate(size_t count, int special_every, Row_batch *rows) {
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> words(1, 40);
+  std::uniform_int_distribution<> word(0, 63);
+  std::uniform_int_distribution<> special(0, 2);
+
+  std::vector<std::string> dictionary;
+
+  for (int i = 0; i < 64; ++i) {
+    dictionary.emplace_back("word" + std::to_string(i * 7919 % 1000));
+  }
+
+  const std::vector<Type> types(k_columns, Type::String);
+  int counter = 0;
+
+  for (size_t i = 0; i < count; ++i) {
+    Mutable_row row{types};
+
+    for (uint32_t c = 0; c < k_columns; ++c) {
+      std::string text;
+
+      for (int w = words(gen); w > 0; --w) {
+        text += dictionary[word(gen)];
+
+        if (special_every && 0 == ++counter % special_every) {
+          text += "\t\n\\"[special(gen)];
+        } else {
+          text += ' ';
+        }
+      }
+
+      row.set_field(c, text);
+    }
+
+    rows->append(row);
+  }
+}
+
+// the previous implementation: each byte is checked separately
+std::string escape_per_byte(const std::string &data) {
+  std::string result;
+  result.reserve(2 * data.size());
+
+  for (const auto c : data) {
+    char to_write = 0;
+
+    switch (c) {
+      case '\0':
+        to_write = '0';
+        break;
+      case '\b':
+        to_write = 'b';
+        break;
+      case '\n':
+        to_write = 'n';
+        break;
+      case '\r':
+        to_write = 'r';
+        break;
+      case '\t':
+        to_write = 't';
+        break;
+      case 0x1A:
+        to_write = 'Z';
+        break;
+      default:
+        if ('\\' == c) to_write = c;
+        break;
+    }
+
+    if (to_write) {
+      result += '\\';
+      result += to_write;
+    } else {
+      result += c;
+    }
+  }
+
+  return result;
+}
+
+// clean spans are found by the vectorised scan and copied in one go
+std::string escape_with_scan(const std::string &data) {
+  static constexpr char k_escaped[mysqlsh::dump::encoder::k_escaped_characters] =
+      {'\\', '\t', '\n', 0};
+  std::string result;
+  result.reserve(2 * data.size());
+
+  const auto end = data.data() + data.size();
+
+  for (auto p = data.data(); p != end; ++p) {
+    const auto next =
+        mysqlsh::dump::encoder::find_escape_candidate(p, end, k_escaped);
+    result.append(p, next - p);
+
+    if (next == end) break;
+
+    p = next;
+
+    switch (*p) {
+      case '\0':
+        result += "\\0";
+        break;
+      case '\b':
+        result += "\\b";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\r':
+        result += "\\r";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      case 0x1A:
+        result += "\\Z";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      default:
+        result += *p;
+        break;
+    }
+  }
+
+  return result;
+}
+
+template <typename F>
+double measure(F &&f) {
+  const auto t_start = std::chrono::steady_clock::now();
+  f();
+  const auto t_end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(t_end - t_start).count();
+}
+
+void run_escape(const std::string &name, const Row_batch &rows) {
+  std::vector<std::string> fields;
+  size_t bytes = 0;
+
+  for (const auto &row : rows) {
+    for (uint32_t c = 0; c < k_columns; ++c) {
+      fields.emplace_back(row.get_string(c));
+      bytes += fields.back().size();
+    }
+  }
+
+  size_t per_byte_size = 0;
+  const auto t_per_byte = measure([&]() {
+    for (const auto &f : fields) per_byte_size += escape_per_byte(f).size();
+  });
+
+  size_t scan_size = 0;
+  const auto t_scan = measure([&]() {
+    for (const auto &f : fields) scan_size += escape_with_scan(f).size();
+  });
+
+  if (per_byte_size != scan_size) {
+    throw std::runtime_error(name + ": escaped sizes are different");
+  }
+
+  const auto mbytes = bytes / 1000.0 / 1000.0;
+
+  std::cout << "# escape " << name << ": per byte " << mbytes / t_per_byte
+            << " Mbytes/s, scan " << mbytes / t_scan << " Mbytes/s\n";
+}
+
+void run_writer(const std::string &name, const Row_batch &rows,
+                std::unique_ptr<Dump_writer> writer) {
+  std::vector<Column> metadata;
+
+  for (int c = 0; c < k_columns; ++c) {
+    const auto column_name = "c" + std::to_string(c);
+    metadata.emplace_back("def", "bench", "text", "text", column_name,
+                          column_name, 0, 0, Type::String, 255, false, false,
+                          false);
+  }
+
+  Memory_file file{""};
+  file.open(Mode::WRITE);
+  writer->set_output_file(&file);
+
+  const auto seconds = measure([&]() {
+    writer->open();
+    writer->write_preamble(metadata);
+
+    for (const auto &row : rows) {
+      writer->write_row(&row);
+    }
+
+    writer->write_postamble();
+    writer->close();
+  });
+
+  file.close();
+
+  const auto mbytes = file.content().size() / 1000.0 / 1000.0;
+
+  std::cout << "# writer " << name << ": " << mbytes / seconds
+            << " Mbytes/s\n";
+}
+
+}  // namespace
+
+int main() {
+  constexpr size_t k_rows = 100000;
+
+  std::cout << "# implementation: "
+            << mysqlsh::dump::encoder::implementation() << "\n";
+
+  for (const auto special_every : {0, 100, 10}) {
+    Row_batch rows;
+    generate(k_rows, special_every, &rows);
+
+    const auto name = special_every
+                          ? "1 in " + std::to_string(special_every) +
+                                " words escaped"
+                          : std::string{"nothing escaped"};
+
+    run_escape(name, rows);
+
+    run_writer("default, " + name, rows,
+               std::make_unique<mysqlsh::dump::Default_dump_writer>());
+    run_writer("csv, " + name, rows,
+               std::make_unique<mysqlsh::dump::Csv_dump_writer>());
+
+    auto dialect = mysqlsh::import_table::Dialect::default_();
+    dialect.lines_terminated_by = "\r\n";
+    run_writer("custom, " + name, rows,
+               std::make_unique<mysqlsh::dump::Text_dump_writer>(dialect));
+  }
+}
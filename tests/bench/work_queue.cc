@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int k_tasks = 1000000;
+
+// main thread pushes all the tasks, like the dumper does with the schema
+// and table tasks
+template <typename Queue>
+double single_producer(int threads) {
+  Queue queue;
+  std::atomic<int64_t> sum{0};
+  std::vector<std::thread> workers;
+
+  const auto t_start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < threads; ++i) {
+    workers.emplace_back([&queue, &sum]() {
+      int64_t local = 0;
+
+      while (const auto task = queue.pop()) {
+        local += task;
+      }
+
+      sum += local;
+    });
+  }
+
+  for (int i = 1; i <= k_tasks; ++i) {
+    queue.push(i);
+  }
+
+  queue.shutdown(threads);
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  const auto t_end = std::chrono::steady_clock::now();
+
+  if (sum != static_cast<int64_t>(k_tasks) * (k_tasks + 1) / 2) {
+    throw std::runtime_error("single producer: wrong result");
+  }
+
+  return std::chrono::duration<double>(t_end - t_start).count();
+}
+
+// workers push the tasks, like the dumper does with the chunks of a table
+template <typename Queue>
+double workers_produce(int threads) {
+  // each seed task creates this many follow-up tasks
+  constexpr int k_fan_out = 100;
+  constexpr int k_seeds = k_tasks / (k_fan_out + 1);
+
+  Queue queue;
+  std::atomic<int> done{0};
+  std::vector<std::thread> workers;
+
+  const auto t_start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < threads; ++i) {
+    workers.emplace_back([&queue, &done]() {
+      while (const auto task = queue.pop()) {
+        if (task < 0) {
+          for (int j = 0; j < k_fan_out; ++j) {
+            queue.push(1);
+          }
+        }
+
+        ++done;
+      }
+    });
+  }
+
+  for (int i = 0; i < k_seeds; ++i) {
+    queue.push(-1, shcore::Queue_priority::HIGH);
+  }
+
+  while (done < k_seeds * (k_fan_out + 1)) {
+    std::this_thread::sleep_for(std::chrono::microseconds{100});
+  }
+
+  queue.shutdown(threads);
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  const auto t_end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double>(t_end - t_start).count();
+}
+
+template <typename F>
+void run(const std::string &name, int threads, F &&f) {
+  const auto seconds = f(threads);
+
+  std::cout << "# " << name << ", " << threads << " threads: "
+            << k_tasks / seconds / 1000.0 / 1000.0 << " Mtasks/s\n";
+}
+
+}  // namespace
+
+int main() {
+  using Synchronized = shcore::Synchronized_queue<int>;
+  using Work_stealing = shcore::Work_stealing_queue<int>;
+
+  for (int threads = 1; threads <= 128; threads *= 2) {
+    run("single producer, Synchronized_queue", threads,
+        single_producer<Synchronized>);
+    run("single producer, Work_stealing_queue", threads,
+        single_producer<Work_stealing>);
+    run("workers produce, Synchronized_queue", threads,
+        workers_produce<Synchronized>);
+    run("workers produce, Work_stealing_queue", threads,
+        workers_produce<Work_stealing>);
+  }
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <chrono>
+
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/adminapi/common/connectivity_check.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/mysql/mock_instance.h"
+
+namespace mysqlsh {
+namespace dba {
+
+TEST(Connectivity_check, format_report) {
+  EXPECT_EQ("", format_connectivity_report({}));
+
+  Connectivity_report report;
+
+  {
+    Connection_check_result check;
+    check.from = "host1:3306";
+    check.to = "host2:3306";
+    check.address_source = "report_host";
+    check.ssl_mode = Cluster_ssl_mode::REQUIRED;
+    check.latency = std::chrono::milliseconds{12};
+    check.succeeded = true;
+    report.emplace_back(std::move(check));
+  }
+
+  {
+    Connection_check_result check;
+    check.from = "host2:3306";
+    check.to = "host1:33061";
+    check.address_source = "localAddress";
+    check.ssl_mode = Cluster_ssl_mode::REQUIRED;
+    check.latency = std::chrono::milliseconds{5003};
+    check.error = "error 2003: Can't connect";
+    report.emplace_back(std::move(check));
+  }
+
+  EXPECT_EQ(
+      "host1:3306 -> host2:3306 (report_host): OK, ssl_mode=REQUIRED, "
+      "latency=12ms\n"
+      "host2:3306 -> host1:33061 (localAddress): FAILED (error 2003: Can't "
+      "connect), ssl_mode=REQUIRED, latency=5003ms\n",
+      format_connectivity_report(report));
+}
+
+namespace {
+
+void setup_instance(testing::NiceMock<mysqlshdk::mysql::Mock_instance> *i,
+                    const std::string &host, int port) {
+  const auto address = host + ":" + std::to_string(port);
+
+  ON_CALL(*i, get_canonical_hostname()).WillByDefault(testing::Return(host));
+  ON_CALL(*i, get_canonical_port()).WillByDefault(testing::Return(port));
+  ON_CALL(*i, get_canonical_address())
+      .WillByDefault(testing::Return(address));
+  ON_CALL(*i, get_connection_options())
+      .WillByDefault(testing::Return(
+          mysqlshdk::db::Connection_options("root@" + address)));
+  ON_CALL(*i, descr()).WillByDefault(testing::Return(address));
+}
+
+}  // namespace
+
+TEST(Connectivity_check, peer_check_account_holders) {
+  using detail::Check_account_holder;
+
+  testing::NiceMock<mysqlshdk::mysql::Mock_instance> from;
+  testing::NiceMock<mysqlshdk::mysql::Mock_instance> to;
+  setup_instance(&from, "host1", 3306);
+  setup_instance(&to, "host2", 3307);
+
+  detail::Peer_check_accounts accounts;
+  accounts.at_to = "to-pwd";
+  accounts.at_from = "from-pwd";
+  accounts.loopback = "lo-pwd";
+
+  const auto lanes = detail::make_peer_check_lanes(
+      from, "", "from-subject", to, "", "to-subject", kCommunicationStackMySQL,
+      false, accounts);
+
+  ASSERT_EQ(2, lanes.size());
+
+  // checks executed at from_instance
+  const auto &from_lane = lanes[0];
+  EXPECT_EQ("host1:3306", from_lane.from_address);
+  ASSERT_EQ(2, from_lane.checks.size());
+
+  // loopback account exists at the source of the check
+  EXPECT_EQ("mysqlsh-lo.test", from_lane.checks[0].user);
+  EXPECT_EQ("lo-pwd", from_lane.checks[0].password);
+  EXPECT_EQ("host1:3306", from_lane.checks[0].to_endpoint());
+  EXPECT_EQ(Check_account_holder::SOURCE, from_lane.checks[0].account_holder);
+
+  EXPECT_EQ("mysqlsh.test", from_lane.checks[1].user);
+  EXPECT_EQ("to-pwd", from_lane.checks[1].password);
+  EXPECT_EQ("host2:3307", from_lane.checks[1].to_endpoint());
+  EXPECT_EQ(Check_account_holder::TARGET, from_lane.checks[1].account_holder);
+
+  // checks executed at to_instance
+  const auto &to_lane = lanes[1];
+  EXPECT_EQ("host2:3307", to_lane.from_address);
+  ASSERT_EQ(1, to_lane.checks.size());
+  EXPECT_EQ("from-pwd", to_lane.checks[0].password);
+  EXPECT_EQ("to-subject", to_lane.checks[0].cert_subject);
+  EXPECT_EQ("host1:3306", to_lane.checks[0].to_endpoint());
+  EXPECT_EQ(Check_account_holder::TARGET, to_lane.checks[0].account_holder);
+
+  // the account of the loopback check is altered at the source, there's no
+  // need to connect to the target
+  int target_calls = 0;
+  const auto target = [&]() -> const mysqlshdk::mysql::IInstance & {
+    ++target_calls;
+    return to;
+  };
+
+  EXPECT_EQ(&from, &detail::check_account_instance(from_lane.checks[0], from,
+                                                   target));
+  EXPECT_EQ(0, target_calls);
+
+  EXPECT_EQ(&to, &detail::check_account_instance(from_lane.checks[1], from,
+                                                 target));
+  EXPECT_EQ(1, target_calls);
+
+  // accounts which could not be created are not used
+  accounts.loopback.reset();
+  accounts.at_from.reset();
+
+  const auto partial = detail::make_peer_check_lanes(
+      from, "", "from-subject", to, "", "to-subject", kCommunicationStackMySQL,
+      false, accounts);
+
+  ASSERT_EQ(2, partial.size());
+  ASSERT_EQ(1, partial[0].checks.size());
+  EXPECT_EQ("mysqlsh.test", partial[0].checks[0].user);
+  EXPECT_TRUE(partial[1].checks.empty());
+
+  // loopback check is skipped if requested
+  accounts.loopback = "lo-pwd";
+
+  const auto no_self = detail::make_peer_check_lanes(
+      from, "", "from-subject", to, "", "to-subject", kCommunicationStackMySQL,
+      true, accounts);
+
+  ASSERT_EQ(1, no_self[0].checks.size());
+  EXPECT_EQ("mysqlsh.test", no_self[0].checks[0].user);
+}
+
+}  // namespace dba
+}  // namespace mysqlsh
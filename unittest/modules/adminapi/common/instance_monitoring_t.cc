@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <errmsg.h>
+#include <mysqld_error.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+#include "unittest/test_utils.h"
+
+#include "modules/adminapi/common/instance_monitoring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_result.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
+
+namespace mysqlsh {
+namespace dba {
+
+using std::chrono::milliseconds;
+using testing::Return;
+using testing::ReturnRef;
+
+TEST(Instance_monitoring, poll_interval_backoff) {
+  Poll_interval interval{milliseconds{100}, milliseconds{1000}};
+
+  EXPECT_EQ(milliseconds{100}, interval.next(false));
+  EXPECT_EQ(milliseconds{200}, interval.next(false));
+  EXPECT_EQ(milliseconds{400}, interval.next(false));
+  EXPECT_EQ(milliseconds{800}, interval.next(false));
+  EXPECT_EQ(milliseconds{1000}, interval.next(false));
+  EXPECT_EQ(milliseconds{1000}, interval.next(false));
+
+  // transition resets the interval
+  EXPECT_EQ(milliseconds{100}, interval.next(true));
+  EXPECT_EQ(milliseconds{200}, interval.next(false));
+
+  interval.reset();
+  EXPECT_EQ(milliseconds{100}, interval.current());
+}
+
+TEST(Instance_monitoring, poll_interval_fixed) {
+  Poll_interval interval{milliseconds{10}, milliseconds{10}};
+
+  EXPECT_EQ(milliseconds{10}, interval.next(false));
+  EXPECT_EQ(milliseconds{10}, interval.next(false));
+  EXPECT_EQ(milliseconds{10}, interval.next(true));
+
+  // maximum cannot be lower than minimum
+  Poll_interval invalid{milliseconds{50}, milliseconds{10}};
+
+  EXPECT_EQ(milliseconds{50}, invalid.next(false));
+  EXPECT_EQ(milliseconds{50}, invalid.next(false));
+}
+
+TEST(Instance_monitoring, sleep_unless_stopped) {
+  bool stop = false;
+
+  EXPECT_TRUE(sleep_unless_stopped(milliseconds{1}, stop));
+
+  stop = true;
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(sleep_unless_stopped(milliseconds{60000}, stop));
+  EXPECT_GT(milliseconds{10000}, std::chrono::steady_clock::now() - start);
+}
+
+TEST(Instance_monitoring, recovery_state_changes) {
+  Recovery_state a;
+  Recovery_state b;
+
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(mysqlshdk::gr::Member_state::MISSING, a.get_member_state());
+
+  b.reachable = true;
+  b.member_state = "RECOVERING";
+  EXPECT_NE(a, b);
+  EXPECT_EQ(mysqlshdk::gr::Member_state::RECOVERING, b.get_member_state());
+
+  a = b;
+  b.clone_stage = "FILE COPY";
+  EXPECT_NE(a, b);
+
+  a = b;
+  b.applier_error_time = "2024-01-01 00:00:00.000000";
+  EXPECT_NE(a, b);
+
+  a = b;
+  EXPECT_EQ(a, b);
+}
+
+class Recovery_monitor_test : public Shell_core_test_wrapper {
+ protected:
+  struct Mock_target {
+    mysqlshdk::db::Connection_options coptions;
+    std::shared_ptr<testing::Mock_session> session;
+    std::shared_ptr<Instance> instance;
+    // called by a worker thread
+    std::function<std::shared_ptr<mysqlshdk::db::IResult>(const std::string &)>
+        handler;
+    std::atomic<int> clone_queries{0};
+  };
+
+  std::unique_ptr<Mock_target> make_target(const std::string &uri) {
+    auto target = std::make_unique<Mock_target>();
+    const auto t = target.get();
+
+    t->coptions = mysqlshdk::db::Connection_options(uri);
+    t->session = std::make_shared<testing::Mock_session>();
+
+    ON_CALL(*t->session, get_connection_options())
+        .WillByDefault(ReturnRef(t->coptions));
+    ON_CALL(*t->session, get_server_version())
+        .WillByDefault(Return(mysqlshdk::utils::Version(8, 0, 30)));
+
+    t->session->set_query_handler([this, t](const std::string &sql) {
+      if (shcore::str_beginswith(sql, "SELECT (SELECT member_state")) {
+        if (sql.find("performance_schema.clone_status") != std::string::npos) {
+          ++t->clone_queries;
+        }
+
+        return t->handler(sql);
+      }
+
+      return make_result({}, {});
+    });
+
+    t->instance = std::make_shared<Instance>(t->session);
+
+    return target;
+  }
+
+  std::shared_ptr<mysqlshdk::db::IResult> make_result(
+      const std::vector<std::string> &names,
+      const std::vector<std::vector<std::string>> &rows) {
+    auto result = std::make_shared<testing::Mock_result>();
+
+    ON_CALL(*result, get_metadata()).WillByDefault(ReturnRef(m_columns));
+
+    if (!names.empty()) {
+      result->add_result(names, std::vector<mysqlshdk::db::Type>(
+                                    names.size(), mysqlshdk::db::Type::String),
+                         rows);
+    }
+
+    return result;
+  }
+
+  std::shared_ptr<mysqlshdk::db::IResult> make_state(
+      const std::string &member_state, const std::string &clone_state = {},
+      const std::string &clone_stage = {}) {
+    std::vector<std::string> names{"member_state", "receiver_state",
+                                   "applier_state", "receiver_error_time",
+                                   "applier_error_time"};
+    std::vector<std::string> row{member_state, "ON", "ON", "", ""};
+
+    if (!clone_state.empty()) {
+      names.emplace_back("clone_state");
+      names.emplace_back("clone_stage");
+      row.emplace_back(clone_state);
+      row.emplace_back(clone_stage);
+    }
+
+    return make_result(names, {row});
+  }
+
+  std::vector<mysqlshdk::db::Column> m_columns;
+};
+
+TEST_F(Recovery_monitor_test, poll_multiple_targets) {
+  // first target does not have the clone plugin installed
+  const auto first = make_target("root@localhost:3306");
+  int first_polls = 0;
+
+  first->handler = [&](const std::string &sql) {
+    if (sql.find("performance_schema.clone_status") != std::string::npos) {
+      throw mysqlshdk::db::Error(
+          "Table 'performance_schema.clone_status' doesn't exist",
+          ER_NO_SUCH_TABLE);
+    }
+
+    return make_state(++first_polls > 1 ? "ONLINE" : "RECOVERING");
+  };
+
+  // second target is being cloned and restarts
+  const auto second = make_target("root@localhost:3307");
+  int second_polls = 0;
+
+  second->handler = [&](const std::string &) {
+    if (++second_polls > 1) {
+      throw mysqlshdk::db::Error("Lost connection to MySQL server",
+                                 CR_SERVER_LOST);
+    }
+
+    return make_state("RECOVERING", "In Progress", "FILE COPY");
+  };
+
+  Recovery_monitor monitor{"", Poll_interval{milliseconds{1}, milliseconds{1}}};
+
+  EXPECT_EQ(0u, monitor.add_target(first->instance));
+  EXPECT_EQ(1u, monitor.add_target(second->instance));
+  EXPECT_EQ(2u, monitor.size());
+
+  EXPECT_TRUE(monitor.poll());
+
+  EXPECT_TRUE(monitor.state(0).reachable);
+  EXPECT_EQ("RECOVERING", monitor.state(0).member_state);
+  EXPECT_EQ("", monitor.state(0).clone_state);
+  EXPECT_EQ(first->instance, monitor.instance(0));
+  EXPECT_EQ(1, first->clone_queries);
+
+  EXPECT_TRUE(monitor.state(1).reachable);
+  EXPECT_EQ("RECOVERING", monitor.state(1).member_state);
+  EXPECT_EQ("In Progress", monitor.state(1).clone_state);
+  EXPECT_EQ("FILE COPY", monitor.state(1).clone_stage);
+  EXPECT_EQ(second->instance, monitor.instance(1));
+  EXPECT_EQ(1, second->clone_queries);
+
+  // each target changes in a different way
+  EXPECT_TRUE(monitor.poll());
+
+  EXPECT_TRUE(monitor.state(0).reachable);
+  EXPECT_EQ("ONLINE", monitor.state(0).member_state);
+  EXPECT_EQ(first->instance, monitor.instance(0));
+  // missing clone plugin was remembered, clone state is no longer queried
+  EXPECT_EQ(1, first->clone_queries);
+  EXPECT_EQ(2, first_polls);
+
+  EXPECT_FALSE(monitor.state(1).reachable);
+  EXPECT_EQ(Recovery_state{}, monitor.state(1));
+  EXPECT_EQ(nullptr, monitor.instance(1));
+  EXPECT_EQ(2, second->clone_queries);
+}
+
+}  // namespace dba
+}  // namespace mysqlsh
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "unittest/test_utils.h"
+
+#include "modules/adminapi/common/metadata_storage.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_result.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
+
+namespace mysqlsh {
+namespace dba {
+
+using testing::ReturnRef;
+
+class Metadata_storage_test : public Shell_core_test_wrapper {
+ protected:
+  static constexpr const char *k_gtid_executed_query =
+      "SELECT @@GLOBAL.gtid_executed";
+  static constexpr const char *k_tags_query =
+      "SELECT attributes->'$.tags' from "
+      "mysql_innodb_cluster_metadata.`instances` WHERE `mysql_server_uuid` = "
+      "'uuid1'";
+
+  void SetUp() override {
+    Shell_core_test_wrapper::SetUp();
+
+    m_mock_session = std::make_shared<testing::Mock_session>();
+    m_mock_session->set_query_handler([this](const std::string &sql) {
+      ++m_queries[sql];
+
+      if (sql == k_gtid_executed_query) {
+        return make_result({"@@GLOBAL.gtid_executed"}, {{m_gtid_executed}});
+      } else if (sql == k_tags_query) {
+        return make_result({"attributes->'$.tags'"}, {{"{\"a\": 1}"}});
+      } else if (shcore::str_beginswith(sql,
+                                        "SELECT COUNT(*) FROM mysql.func")) {
+        // lock service is installed
+        return make_result({"COUNT(*)"}, {{"3"}});
+      } else if (shcore::str_beginswith(sql, "SELECT COALESCE(@@report_host")) {
+        return make_result({"Host", "Port"}, {{"mock@localhost", "3306"}});
+      }
+
+      return make_result({}, {});
+    });
+
+    m_mock_instance = std::make_shared<Instance>(m_mock_session);
+  }
+
+  std::shared_ptr<mysqlshdk::db::IResult> make_result(
+      const std::vector<std::string> &names,
+      const std::vector<std::vector<std::string>> &rows) {
+    auto result = std::make_shared<testing::Mock_result>();
+
+    ON_CALL(*result, get_metadata()).WillByDefault(ReturnRef(m_columns));
+
+    if (!names.empty()) {
+      result->add_result(names, std::vector<mysqlshdk::db::Type>(
+                                    names.size(), mysqlshdk::db::Type::String),
+                         rows);
+    }
+
+    return result;
+  }
+
+  std::vector<mysqlshdk::db::Column> m_columns;
+  std::map<std::string, int> m_queries;
+  std::string m_gtid_executed = "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-10";
+  std::shared_ptr<testing::Mock_session> m_mock_session;
+  std::shared_ptr<Instance> m_mock_instance;
+};
+
+TEST_F(Metadata_storage_test, read_cache_disabled) {
+  MetadataStorage metadata(m_mock_instance);
+
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+
+  EXPECT_EQ(2, m_queries[k_tags_query]);
+  EXPECT_EQ(0, m_queries[k_gtid_executed_query]);
+  EXPECT_EQ(0u, metadata.cache_stats().hits);
+  EXPECT_EQ(0u, metadata.cache_stats().misses);
+}
+
+TEST_F(Metadata_storage_test, read_cache) {
+  MetadataStorage metadata(m_mock_instance);
+  metadata.enable_read_cache();
+
+  // first read is sent to the server, after the generation is checked
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(1, m_queries[k_tags_query]);
+  EXPECT_EQ(1, m_queries[k_gtid_executed_query]);
+
+  // the same read is served from the cache
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(1, m_queries[k_tags_query]);
+  EXPECT_EQ(1, m_queries[k_gtid_executed_query]);
+
+  // new API call, nothing was committed in the meantime
+  metadata.invalidate_cached();
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(1, m_queries[k_tags_query]);
+  EXPECT_EQ(2, m_queries[k_gtid_executed_query]);
+
+  // new API call, something was committed
+  m_gtid_executed = "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-11";
+  metadata.invalidate_cached();
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(2, m_queries[k_tags_query]);
+  EXPECT_EQ(3, m_queries[k_gtid_executed_query]);
+
+  // a write invalidates the cache immediately, reads are not cached until the
+  // next API call
+  metadata.remove_instance("localhost:3306");
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(4, m_queries[k_tags_query]);
+  EXPECT_EQ(3, m_queries[k_gtid_executed_query]);
+
+  // so does a write executed by a different object
+  metadata.invalidate_cached();
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(5, m_queries[k_tags_query]);
+  EXPECT_EQ(4, m_queries[k_gtid_executed_query]);
+  {
+    MetadataStorage other(m_mock_instance);
+    other.remove_instance("localhost:3306");
+  }
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(6, m_queries[k_tags_query]);
+  EXPECT_EQ(4, m_queries[k_gtid_executed_query]);
+
+  // new API call, rows cached before the write are not used
+  metadata.invalidate_cached();
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(7, m_queries[k_tags_query]);
+  EXPECT_EQ(5, m_queries[k_gtid_executed_query]);
+
+  const auto &stats = metadata.cache_stats();
+  EXPECT_EQ(4u, stats.hits);
+  EXPECT_EQ(7u, stats.misses);
+  EXPECT_EQ(5u, stats.validations);
+  EXPECT_EQ(3u, stats.invalidations);
+  EXPECT_DOUBLE_EQ(4.0 / 11, stats.hit_rate());
+  EXPECT_EQ(0u, stats.queries_avoided());
+}
+
+TEST_F(Metadata_storage_test, read_cache_round_trips) {
+  const auto total_queries = [this]() {
+    int total = 0;
+
+    for (const auto &q : m_queries) {
+      total += q.second;
+    }
+
+    return total;
+  };
+
+  // a mutating API call: reads interleaved with writes
+  const auto api_call = [](MetadataStorage *metadata) {
+    metadata->invalidate_cached();
+
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_EQ("{\"a\": 1}", metadata->get_instance_tags("uuid1"));
+      EXPECT_EQ("{\"a\": 1}", metadata->get_instance_tags("uuid1"));
+      metadata->remove_instance("localhost:3306");
+    }
+
+    EXPECT_EQ("{\"a\": 1}", metadata->get_instance_tags("uuid1"));
+  };
+
+  {
+    MetadataStorage metadata(m_mock_instance);
+    api_call(&metadata);
+  }
+
+  const auto uncached = total_queries();
+  EXPECT_EQ(7, m_queries[k_tags_query]);
+  m_queries.clear();
+
+  {
+    MetadataStorage metadata(m_mock_instance);
+    metadata.enable_read_cache();
+    api_call(&metadata);
+
+    // one validation and a cache hit before the first write, reads after it
+    // are sent to the server without being revalidated
+    EXPECT_EQ(1, m_queries[k_gtid_executed_query]);
+    EXPECT_EQ(6, m_queries[k_tags_query]);
+    EXPECT_EQ(1u, metadata.cache_stats().hits);
+    EXPECT_EQ(1u, metadata.cache_stats().validations);
+  }
+
+  // the cache does not add round trips to a mutating API call
+  EXPECT_EQ(uncached, total_queries());
+
+  // the next API call caches the reads again
+  m_queries.clear();
+
+  {
+    MetadataStorage metadata(m_mock_instance);
+    metadata.enable_read_cache();
+    metadata.invalidate_cached();
+
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+    }
+
+    EXPECT_EQ(1, m_queries[k_gtid_executed_query]);
+    EXPECT_EQ(1, m_queries[k_tags_query]);
+  }
+}
+
+TEST_F(Metadata_storage_test, read_cache_lock) {
+  MetadataStorage metadata(m_mock_instance);
+  metadata.enable_read_cache();
+
+  // preconditions are checked before the lock is acquired
+  metadata.invalidate_cached();
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(1, m_queries[k_tags_query]);
+  EXPECT_EQ(1, m_queries[k_gtid_executed_query]);
+
+  // another process commits a change and releases the lock, cached rows must
+  // not be used once the lock is held
+  m_gtid_executed = "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-11";
+  metadata.get_lock_exclusive();
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(2, m_queries[k_tags_query]);
+  EXPECT_EQ(2, m_queries[k_gtid_executed_query]);
+
+  // nothing changed while the lock is held
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(2, m_queries[k_tags_query]);
+  EXPECT_EQ(2, m_queries[k_gtid_executed_query]);
+
+  // cluster and instance locks revalidate the cache too, rows are kept if
+  // nothing was committed
+  MetadataStorage::revalidate_read_caches();
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(2, m_queries[k_tags_query]);
+  EXPECT_EQ(3, m_queries[k_gtid_executed_query]);
+
+  {
+    auto lock = m_mock_instance->get_lock_shared();
+    EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+    EXPECT_EQ(2, m_queries[k_tags_query]);
+    EXPECT_EQ(4, m_queries[k_gtid_executed_query]);
+  }
+}
+
+TEST_F(Metadata_storage_test, read_cache_external_write) {
+  MetadataStorage metadata(m_mock_instance);
+  metadata.enable_read_cache();
+
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(1, m_queries[k_tags_query]);
+
+  // metadata modified without MetadataStorage, i.e. by a schema upgrade
+  MetadataStorage::invalidate_read_caches();
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(2, m_queries[k_tags_query]);
+  EXPECT_EQ(1, m_queries[k_gtid_executed_query]);
+
+  // cached again after the next API call
+  metadata.invalidate_cached();
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ("{\"a\": 1}", metadata.get_instance_tags("uuid1"));
+  EXPECT_EQ(3, m_queries[k_tags_query]);
+  EXPECT_EQ(2, m_queries[k_gtid_executed_query]);
+}
+
+}  // namespace dba
+}  // namespace mysqlsh
@@ -159,7 +159,7 @@ class Dump_scheduler : public ::testing::Test {
       size_t nthreads) {
     std::vector<std::string> schedule_order;
 
-    std::unordered_multimap<std::string, size_t> tables_being_loaded;
+    Dump_reader::Tables_being_loaded tables_being_loaded;
     std::unordered_set<Dump_reader::Table_data_info *> tables_with_data;
 
     auto copy = tables;
@@ -241,7 +241,7 @@ class Dump_scheduler : public ::testing::Test {
             t.count = count;
             t.count_left = count;
             schedule_order.push_back(file);
-            tables_being_loaded.emplace(table, count);
+            tables_being_loaded.add(table, count);
             n_busy_threads++;
           }
         } else {
@@ -305,7 +305,7 @@ class Dump_scheduler : public ::testing::Test {
       while (!done) {
         for (auto &t : threads) {
           if (t.count_left > 0 && --t.count_left == 0) {
-            tables_being_loaded.erase(t.table);
+            tables_being_loaded.remove(t.table, t.count);
             t.table = "";
             done = true;
           }
@@ -29,6 +29,7 @@
 
 #include "modules/util/import_table/chunk_file.h"
 #include "modules/util/import_table/import_table.h"
+#include "modules/util/import_table/scanner.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 
@@ -1042,5 +1043,200 @@ TEST(import_table, twochar_aa_line_terminator_same_as_row_data) {
   shcore::delete_file(path, true);
 }
 
+TEST(import_table, parallel_chunking) {
+  const std::string path{"import_table_parallel_chunks.dump"};
+  std::string test_string;
+
+  // rows of different lengths, some of them with escaped line terminators
+  for (size_t i = 0; i < 20000; ++i) {
+    test_string += std::string(i % 97, 'a' + i % 26);
+
+    if (0 == i % 7) {
+      test_string += "\\\n";
+    }
+
+    test_string += std::to_string(i) + "\n";
+  }
+
+  shcore::create_file(path, test_string, true);
+
+  const auto chunk = [&path](size_t threads) {
+    auto fh = mysqlshdk::storage::make_file(path);
+    shcore::Synchronized_queue<File_import_info> queue;
+    Dialect dialect;
+    dialect.lines_terminated_by = "\n";
+    dialect.fields_escaped_by = "\\";
+
+    Chunk_file chunk_file;
+    chunk_file.set_chunk_size(0);
+    chunk_file.set_file_handle(fh.get());
+    chunk_file.set_dialect(dialect);
+    chunk_file.set_rows_to_skip(1);
+    chunk_file.set_output_queue(&queue);
+    chunk_file.set_threads(threads);
+    chunk_file.set_file_handle_factory(
+        [&path]() { return mysqlshdk::storage::make_file(path); });
+    chunk_file.start();
+
+    std::vector<std::pair<size_t, size_t>> ranges;
+
+    while (queue.size() > 0) {
+      ranges.emplace_back(queue.pop().range);
+    }
+
+    std::sort(ranges.begin(), ranges.end());
+    return ranges;
+  };
+
+  const auto expected = chunk(1);
+  ASSERT_LT(4, expected.size());
+  EXPECT_NE(0, expected.front().first);
+  EXPECT_EQ(test_string.size(), expected.back().second);
+
+  for (const auto threads : {2, 3, 4, 16}) {
+    SCOPED_TRACE("threads: " + std::to_string(threads));
+
+    const auto ranges = chunk(threads);
+
+    ASSERT_FALSE(ranges.empty());
+    EXPECT_EQ(expected.front().first, ranges.front().first);
+    EXPECT_EQ(test_string.size(), ranges.back().second);
+
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      EXPECT_LT(ranges[i].first, ranges[i].second);
+      // each chunk ends with an unescaped line terminator
+      EXPECT_EQ('\n', test_string[ranges[i].second - 1]);
+      EXPECT_NE('\\', test_string[ranges[i].second - 2]);
+
+      if (i > 0) {
+        // chunks are contiguous
+        EXPECT_EQ(ranges[i - 1].second, ranges[i].first);
+      }
+    }
+  }
+
+  shcore::delete_file(path, true);
+}
+
+TEST(import_table, row_scanner) {
+  EXPECT_FALSE(scanner::is_escaped("a\n", "a\n" + 1, '\\'));
+
+  {
+    const std::string s{"a\\\\\n"};
+    // even number of escape characters
+    EXPECT_FALSE(scanner::is_escaped(s.data(), s.data() + 3, '\\'));
+    // odd number of escape characters
+    EXPECT_TRUE(scanner::is_escaped(s.data(), s.data() + 2, '\\'));
+    // only escape characters which are within the range are counted
+    EXPECT_TRUE(scanner::is_escaped(s.data() + 2, s.data() + 3, '\\'));
+  }
+
+  const auto find = [](const std::string &data, const std::string &terminator,
+                       const std::string &escape, bool at_row_start,
+                       size_t piece) -> size_t {
+    Row_scanner scanner{terminator, escape, at_row_start};
+    const auto begin = data.data();
+    const auto end = begin + data.size();
+
+    for (auto first = begin; first < end; first += piece) {
+      const auto last = std::min(first + piece, end);
+
+      if (const auto r = scanner.find(first, last, end)) {
+        return r - begin;
+      }
+    }
+
+    return std::string::npos;
+  };
+
+  for (size_t piece : {1, 2, 3, 7, 16, 33, 100}) {
+    SCOPED_TRACE("piece: " + std::to_string(piece));
+
+    EXPECT_EQ(4, find("abc\ndef\n", "\n", "\\", true, piece));
+    EXPECT_EQ(7, find("ab\\\ncd\n", "\n", "\\", true, piece));
+    EXPECT_EQ(5, find("ab\\\\\ncd\n", "\n", "\\", true, piece));
+    EXPECT_EQ(9, find("ab\\\\\\\ncd\n", "\n", "\\", true, piece));
+    EXPECT_EQ(std::string::npos, find("ab\\\ncd", "\n", "\\", true, piece));
+    EXPECT_EQ(1, find("\ncd\n", "\n", "\\", true, piece));
+    EXPECT_EQ(1, find("\ncd\n", "\n", "", true, piece));
+
+    // escape state is unknown at the beginning
+    EXPECT_EQ(4, find("\ncd\n", "\n", "\\", false, piece));
+    EXPECT_EQ(4, find("\ncd\n", "\n", "", false, piece));
+    EXPECT_EQ(6, find("\\\\\ncd\n", "\n", "\\", false, piece));
+    EXPECT_EQ(4, find("a\\\\\ncd\n", "\n", "\\", false, piece));
+
+    // multi-character terminator
+    EXPECT_EQ(5, find("abc\r\ndef\r\n", "\r\n", "\\", true, piece));
+    EXPECT_EQ(11, find("abc\\\r\ndef\r\n", "\r\n", "\\", true, piece));
+    EXPECT_EQ(7, find("abc\r\r\r\n", "\r\n", "\\", true, piece));
+  }
+
+  {
+    const std::string s{"ab\n\\\ncd\\\\\nef"};
+    const auto begin = s.data();
+    const auto end = begin + s.size();
+    const auto rfind = [&](size_t pos) -> size_t {
+      const auto r = scanner::rfind_row_end(begin, begin + pos, end, "\n", "\\");
+      return r ? r - begin : std::string::npos;
+    };
+
+    EXPECT_EQ(std::string::npos, rfind(1));
+    EXPECT_EQ(3, rfind(2));
+    EXPECT_EQ(3, rfind(8));
+    EXPECT_EQ(10, rfind(9));
+    EXPECT_EQ(10, rfind(s.size() - 1));
+  }
+}
+
+TEST(import_table, chunking_escape_parity) {
+  const std::string path{"import_table_escape_parity.dump"};
+  std::string test_string;
+  std::vector<size_t> row_ends;
+
+  // rows ending with escaped escape characters, followed by a line terminator,
+  // and rows with escaped line terminators
+  for (size_t i = 0; i < 10000; ++i) {
+    test_string += std::string(i % 53, 'a' + i % 26);
+    test_string += std::string(2 * (i % 4), '\\');
+
+    if (0 == i % 5) {
+      test_string += "\\\n";
+    }
+
+    test_string += "\n";
+    row_ends.emplace_back(test_string.size());
+  }
+
+  shcore::create_file(path, test_string, true);
+
+  auto fh_ptr = mysqlshdk::storage::make_file(path);
+  shcore::Synchronized_queue<File_import_info> queue;
+  const std::string needle{"\n"};
+
+  {
+    File_handler fh{fh_ptr.get()};
+    chunk_by_max_bytes(fh.begin(needle.size()), fh.end(needle.size()), needle,
+                       '\\', kBufferSize / 3, &queue, {});
+  }
+
+  size_t previous_end = 0;
+
+  while (queue.size() > 0) {
+    const auto range = queue.pop().range;
+
+    EXPECT_EQ(previous_end, range.first);
+    EXPECT_TRUE(std::binary_search(row_ends.begin(), row_ends.end(),
+                                   range.second))
+        << "chunk ends in the middle of a row: " << range.second;
+
+    previous_end = range.second;
+  }
+
+  EXPECT_EQ(test_string.size(), previous_end);
+
+  shcore::delete_file(path, true);
+}
+
 }  // namespace import_table
 }  // namespace mysqlsh
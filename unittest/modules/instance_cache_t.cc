@@ -1723,6 +1723,97 @@ TEST_F(Instance_cache_test, table_histograms) {
   }
 }
 
+TEST_F(Instance_cache_test, metadata_helper_sessions) {
+  {
+    // setup
+    m_session->execute("CREATE SCHEMA first;");
+    m_session->execute(
+        "CREATE TABLE first.one (id INT PRIMARY KEY, data INT) "
+        "PARTITION BY HASH(id) PARTITIONS 2;");
+    m_session->execute(
+        "CREATE TABLE first.two (a INT NOT NULL, b INT NOT NULL, "
+        "UNIQUE KEY (b, a));");
+    m_session->execute("CREATE VIEW first.three AS SELECT * FROM first.one;");
+    m_session->execute("CREATE SCHEMA second;");
+    m_session->execute("CREATE TABLE second.one (id INT, data TEXT);");
+    m_session->execute("CREATE SCHEMA third;");
+    m_session->execute("CREATE TABLE third.one (id BIGINT PRIMARY KEY);");
+  }
+
+  Filtering_options filters;
+  filters.schemas().include("first");
+  filters.schemas().include("second");
+  filters.schemas().include("third");
+
+  const auto expected =
+      Instance_cache_builder(m_session, filters).metadata({}).build();
+
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> helpers;
+
+  for (int i = 0; i < 3; ++i) {
+    helpers.emplace_back(connect_session());
+  }
+
+  const auto actual = Instance_cache_builder(m_session, filters)
+                          .helper_sessions(helpers)
+                          .metadata({})
+                          .build();
+
+  for (const auto &helper : helpers) {
+    helper->close();
+  }
+
+  const auto columns = [](const Instance_cache::Table &t) {
+    std::vector<std::string> result;
+
+    for (const auto &c : t.all_columns) {
+      result.emplace_back(c.name);
+    }
+
+    return result;
+  };
+
+  ASSERT_EQ(expected.schemas.size(), actual.schemas.size());
+
+  for (const auto &schema : expected.schemas) {
+    SCOPED_TRACE("schema: " + schema.first);
+
+    const auto &s = actual.schemas.at(schema.first);
+
+    ASSERT_EQ(schema.second.tables.size(), s.tables.size());
+
+    for (const auto &table : schema.second.tables) {
+      SCOPED_TRACE("table: " + table.first);
+
+      const auto &t = s.tables.at(table.first);
+
+      EXPECT_EQ(columns(table.second), columns(t));
+      EXPECT_EQ(table.second.index.columns_sql(), t.index.columns_sql());
+      EXPECT_EQ(table.second.index.primary(), t.index.primary());
+      EXPECT_EQ(table.second.has_not_null_unique_key,
+                t.has_not_null_unique_key);
+      EXPECT_EQ(table.second.partitions.size(), t.partitions.size());
+      EXPECT_EQ(table.second.histograms.size(), t.histograms.size());
+    }
+
+    ASSERT_EQ(schema.second.views.size(), s.views.size());
+
+    for (const auto &view : schema.second.views) {
+      SCOPED_TRACE("view: " + view.first);
+
+      const auto &v = s.views.at(view.first);
+
+      EXPECT_EQ(columns(view.second), columns(v));
+      EXPECT_EQ(view.second.character_set_client, v.character_set_client);
+      EXPECT_EQ(view.second.collation_connection, v.collation_connection);
+    }
+  }
+
+  EXPECT_EQ(2, actual.schemas.at("first").tables.at("one").partitions.size());
+  EXPECT_EQ("`b`, `a`",
+            actual.schemas.at("first").tables.at("two").index.columns_sql());
+}
+
 #if defined(_WIN32) || defined(__APPLE__)
 TEST_F(Instance_cache_test, filter_schemas_and_tables_case_sensitive) {
   {
@@ -219,6 +219,57 @@ TEST(Load_dump, add_execute_conditionally) {
       "", "", false);
 }
 
+TEST(Load_dump, parallel_downloads_option) {
+  {
+    Load_dump_options options;
+    Load_dump_options::options().unpack(shcore::make_dict(), &options);
+    EXPECT_EQ(0, options.parallel_downloads());
+  }
+
+  {
+    Load_dump_options options;
+    Load_dump_options::options().unpack(
+        shcore::make_dict("parallelDownloads", 0), &options);
+    EXPECT_EQ(0, options.parallel_downloads());
+  }
+
+  {
+    Load_dump_options options;
+    EXPECT_THROW_MSG(Load_dump_options::options().unpack(
+                         shcore::make_dict("parallelDownloads", 4), &options),
+                     std::invalid_argument,
+                     "The 'parallelDownloads' option can only be used when "
+                     "loading from an object storage.");
+  }
+}
+
+TEST(Load_dump, download_memory_limit_option) {
+  {
+    Load_dump_options options;
+    Load_dump_options::options().unpack(shcore::make_dict(), &options);
+    EXPECT_EQ(0, options.download_memory_limit());
+  }
+
+  {
+    Load_dump_options options;
+    EXPECT_THROW_MSG(
+        Load_dump_options::options().unpack(
+            shcore::make_dict("downloadMemoryLimit", ""), &options),
+        std::invalid_argument,
+        "The option 'downloadMemoryLimit' cannot be set to an empty string.");
+  }
+
+  {
+    Load_dump_options options;
+    EXPECT_THROW_MSG(Load_dump_options::options().unpack(
+                         shcore::make_dict("downloadMemoryLimit", "64M"),
+                         &options),
+                     std::invalid_argument,
+                     "The 'downloadMemoryLimit' option can only be used when "
+                     "loading from an object storage.");
+  }
+}
+
 static std::string table_name_for_chunk_file(const std::string &f) {
   return shcore::str_rstrip(f.substr(0, f.rfind('@')), "@");
 }
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2020, 2022, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+
+#include "modules/util/import_table/prefetching_file.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+namespace {
+
+using mysqlshdk::storage::Compression;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+std::string generate_data(size_t size) {
+  std::string data;
+  data.reserve(size + 64);
+
+  for (size_t i = 0; data.size() < size; ++i) {
+    data += std::to_string(i) + "\tsome text " + std::to_string(i * 31) + '\n';
+  }
+
+  return data;
+}
+
+std::unique_ptr<mysqlshdk::storage::IFile> compressed_file(
+    const std::string &data, Compression c, std::string *compressed) {
+  {
+    auto memory = std::make_unique<Memory_file>("data");
+    auto raw = memory.get();
+    auto file = mysqlshdk::storage::make_file(std::move(memory), c);
+    file->open(Mode::WRITE);
+    file->write(data.data(), data.size());
+    file->close();
+    *compressed = raw->content();
+  }
+
+  auto memory = std::make_unique<Memory_file>("data");
+  memory->set_content(*compressed);
+  return mysqlshdk::storage::make_file(std::move(memory), c);
+}
+
+class Failing_file : public Memory_file {
+ public:
+  explicit Failing_file(const std::string &data) : Memory_file("failing") {
+    set_content(data);
+  }
+
+  ssize_t read(void *buffer, size_t length) override {
+    if (tell() >= 100) return -1;
+    return Memory_file::read(buffer, std::min<size_t>(length, 10));
+  }
+};
+
+}  // namespace
+
+TEST(Prefetching_file, read) {
+  const auto data = generate_data(1024 * 1024);
+
+  for (const auto c :
+       {Compression::GZIP, Compression::ZSTD, Compression::LZ4}) {
+    SCOPED_TRACE(mysqlshdk::storage::to_string(c));
+
+    std::string compressed;
+    // small buffers, so that the ring is filled and reused multiple times
+    Prefetching_file file{compressed_file(data, c, &compressed), 1000, 3};
+
+    file.open(Mode::READ);
+    EXPECT_TRUE(file.is_open());
+    EXPECT_TRUE(file.is_compressed());
+    EXPECT_EQ(file.file()->filename(), file.filename());
+
+    std::string result;
+    std::string buffer;
+    size_t file_bytes = 0;
+    size_t length = 1;
+
+    while (true) {
+      // vary the size of reads to cross the buffer boundaries differently
+      length = length % 2999 + 7;
+      buffer.resize(length);
+
+      const auto bytes = file.read(buffer.data(), buffer.size());
+      ASSERT_GE(bytes, 0);
+
+      if (0 == bytes) break;
+
+      result.append(buffer.data(), bytes);
+      file_bytes += file.latest_io_size();
+      EXPECT_EQ(result.size(), file.tell());
+    }
+
+    file.close();
+
+    EXPECT_FALSE(file.is_open());
+    EXPECT_EQ(data, result);
+    EXPECT_EQ(compressed.size(), file_bytes);
+  }
+}
+
+TEST(Prefetching_file, reopen) {
+  const auto data = generate_data(100000);
+  std::string compressed;
+  Prefetching_file file{compressed_file(data, Compression::ZSTD, &compressed),
+                        4096, 2};
+
+  for (int i = 0; i < 2; ++i) {
+    file.open(Mode::READ);
+
+    // stop reading in the middle, background thread should be stopped on close
+    std::string buffer(10, '\0');
+    ASSERT_EQ(10, file.read(buffer.data(), buffer.size()));
+    EXPECT_EQ(data.substr(0, 10), buffer);
+
+    EXPECT_THROW(file.seek(0), std::logic_error);
+
+    file.close();
+  }
+
+  // file can be destroyed while being open
+  file.open(Mode::READ);
+  std::string buffer(10, '\0');
+  ASSERT_EQ(10, file.read(buffer.data(), buffer.size()));
+}
+
+TEST(Prefetching_file, seek) {
+  const auto data = generate_data(100000);
+  std::string compressed;
+  Prefetching_file file{compressed_file(data, Compression::GZIP, &compressed)};
+
+  file.open(Mode::READ);
+  // gzip file is not seekable
+  EXPECT_THROW(file.seek(10), std::logic_error);
+  file.close();
+
+  Prefetching_file plain{std::make_unique<Memory_file>("plain"), 10, 2};
+  static_cast<Memory_file *>(plain.file())->set_content(data);
+
+  plain.open(Mode::READ);
+  plain.seek(1000);
+  EXPECT_EQ(1000, plain.tell());
+
+  std::string buffer(50, '\0');
+  ASSERT_EQ(50, plain.read(buffer.data(), buffer.size()));
+  EXPECT_EQ(data.substr(1000, 50), buffer);
+  EXPECT_EQ(1050, plain.tell());
+  plain.close();
+}
+
+TEST(Prefetching_file, error) {
+  Prefetching_file file{
+      std::make_unique<Failing_file>(generate_data(100000)), 40, 2};
+
+  file.open(Mode::READ);
+
+  std::string result;
+  std::string buffer(7, '\0');
+
+  try {
+    while (true) {
+      const auto bytes = file.read(buffer.data(), buffer.size());
+      if (0 == bytes) break;
+      result.append(buffer.data(), bytes);
+    }
+
+    FAIL() << "Exception was expected";
+  } catch (const std::runtime_error &e) {
+    EXPECT_EQ("Failed to read data from " + file.full_path().masked(),
+              e.what());
+  }
+
+  // data which was read before the error is available
+  EXPECT_EQ(80, result.size());
+
+  file.close();
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2020, 2022, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/devapi/base_resultset.h"
+#include "mysqlshdk/include/scripting/obj_date.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Type;
+
+TEST(Row_schema, fields) {
+  const Row_schema schema{{"id", "length", "first name", "id", "getField"}};
+
+  EXPECT_EQ(5u, schema.size());
+
+  EXPECT_EQ(0u, schema.index_of("id"));
+  EXPECT_EQ(1u, schema.index_of("length"));
+  EXPECT_EQ(2u, schema.index_of("first name"));
+  EXPECT_EQ(4u, schema.index_of("getField"));
+  EXPECT_EQ(std::string::npos, schema.index_of("name"));
+
+  // only valid identifiers which are not members of the Row are properties,
+  // duplicates are exposed once
+  EXPECT_TRUE(schema.is_property("id"));
+  EXPECT_FALSE(schema.is_property("length"));
+  EXPECT_FALSE(schema.is_property("first name"));
+  EXPECT_FALSE(schema.is_property("getField"));
+  EXPECT_EQ(std::vector<std::string>{"id"}, schema.properties());
+}
+
+TEST(Row_schema, shared_by_rows) {
+  const auto schema = std::make_shared<Row_schema>(
+      std::vector<std::string>{"id", "name", "length"});
+  const std::vector<Type> types{Type::Integer, Type::String, Type::Integer};
+
+  Row first{schema, Mutable_row(types, 1, "one", 10)};
+  Row second{schema, Mutable_row(types, 2, "two", 20)};
+
+  EXPECT_EQ(1, first.get_member("id").as_int());
+  EXPECT_EQ("two", second.get_member("name").get_string());
+  EXPECT_EQ("two", second.get_field("name").get_string());
+  EXPECT_EQ(20, second.get_field("length").as_int());
+  EXPECT_EQ(3, second.get_member("length").as_int());
+
+  EXPECT_TRUE(first.has_member("id"));
+  EXPECT_TRUE(first.has_member("getField"));
+  EXPECT_FALSE(first.has_member("surname"));
+
+  const auto members = first.get_members();
+  EXPECT_EQ("length", members[0]);
+  EXPECT_EQ("id", members[1]);
+  EXPECT_EQ("name", members[2]);
+
+  // adding a field does not modify other rows
+  first.add_item("extra", shcore::Value(5));
+
+  EXPECT_TRUE(first.has_member("extra"));
+  EXPECT_FALSE(second.has_member("extra"));
+  EXPECT_EQ(3u, schema->size());
+}
+
+TEST(Row_schema, add_item) {
+  Row row;
+
+  row.add_item("level", shcore::Value("Note"));
+  row.add_item("code", shcore::Value(1234));
+
+  EXPECT_EQ(2u, row.get_length());
+  EXPECT_EQ("Note", row.get_member("level").get_string());
+  EXPECT_EQ(1234, row.get_field("code").as_int());
+  EXPECT_EQ(1234, row.as_object()->get_int("code"));
+}
+
+TEST(Row_schema, fields_converted_on_access) {
+  const auto schema = std::make_shared<Row_schema>(
+      std::vector<std::string>{"id", "created", "note", "data"});
+  const std::vector<Type> types{Type::Integer, Type::DateTime, Type::String,
+                                Type::Bytes};
+
+  // the row keeps its own copy of the fetched values
+  Row row{schema,
+          Mutable_row(types, 7, "2020-01-02 03:04:05", nullptr, "\x01\x02")};
+
+  EXPECT_EQ(4u, row.get_length());
+
+  const auto created = row.get_field("created");
+  ASSERT_EQ(shcore::Object, created.type);
+  const auto date = created.as_object<shcore::Date>();
+  ASSERT_NE(nullptr, date);
+  EXPECT_EQ(2020, date->get_year());
+  EXPECT_EQ(5, date->get_sec());
+
+  EXPECT_EQ(shcore::Null, row.get_member(2).type);
+
+  // new fields can be added before all the fetched ones are converted
+  row.add_item("extra", shcore::Value("value"));
+  EXPECT_EQ(5u, row.get_length());
+
+  const auto object = row.as_object();
+  EXPECT_EQ(5u, object->size());
+  EXPECT_EQ(7, object->get_int("id"));
+  EXPECT_EQ(shcore::Null, object->at("note").type);
+  EXPECT_EQ(std::string("\x01\x02"), object->get_string("data"));
+  EXPECT_EQ("value", object->get_string("extra"));
+
+  // converted values are not modified by subsequent accesses
+  EXPECT_EQ(7, row.get_member("id").as_int());
+  EXPECT_EQ(date, row.get_member(1).as_object<shcore::Date>());
+}
+
+}  // namespace mysqlsh
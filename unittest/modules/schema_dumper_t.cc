@@ -47,6 +47,7 @@ namespace mysqlsh {
 namespace dump {
 
 using ::testing::AnyOf;
+using ::testing::Contains;
 using ::testing::HasSubstr;
 using ::testing::Not;
 
@@ -339,6 +340,88 @@ DELIMITER ;
   wipe_all();
 }
 
+TEST_F(Schema_dumper_test, dump_table_with_cache) {
+  std::vector<std::string> tables = {"t1", "t2", "at1"};
+
+  const auto create_table = [this, &tables](const std::string &name,
+                                            const std::string &definition) {
+    session->executef("CREATE TABLE !.! (" + definition + ")", db_name, name);
+    tables.emplace_back(name);
+  };
+
+  shcore::on_leave_scope drop_tables([this]() {
+    for (const auto table : {"uk_not_null", "uk_prefix", "uk_functional",
+                             "uk_partly_functional"}) {
+      session->executef("DROP TABLE IF EXISTS !.!", db_name, table);
+    }
+  });
+
+  create_table("uk_not_null", "a INT NOT NULL, b INT NOT NULL, UNIQUE (a, b)");
+  // unique keys with prefix or functional parts are never used as a primary
+  // key by the server
+  create_table("uk_prefix", "c VARCHAR(100) NOT NULL, UNIQUE (c(10))");
+
+  if (_target_server_version >= mysqlshdk::utils::Version(8, 0, 13)) {
+    create_table("uk_functional", "a INT NOT NULL, UNIQUE ((a + 1))");
+    create_table("uk_partly_functional",
+                 "a INT NOT NULL, b INT NOT NULL, UNIQUE (a, (b + 1))");
+  }
+
+  Filtering_options filters;
+  filters.schemas().include(db_name);
+  const auto cache =
+      Instance_cache_builder(session, filters).metadata({}).triggers().build();
+
+  const auto dump = [this, &tables](Schema_dumper *sd) {
+    sd->opt_drop_table = true;
+    sd->opt_drop_trigger = true;
+    sd->opt_pk_mandatory_check = true;
+
+    std::vector<std::string> issues;
+
+    for (const auto &table : tables) {
+      for (const auto &issue : sd->dump_table_ddl(file.get(), db_name, table)) {
+        issues.emplace_back(issue.description);
+      }
+
+      if (sd->count_triggers_for_table(db_name, table)) {
+        sd->dump_triggers_for_table_ddl(file.get(), db_name, table);
+      }
+    }
+
+    file->flush();
+    file->close();
+
+    issues.emplace_back(testutil->cat_file(file_path));
+    file->open(mysqlshdk::storage::Mode::WRITE);
+
+    return issues;
+  };
+
+  Schema_dumper uncached(session);
+  const auto expected = dump(&uncached);
+
+  for (const auto &table : tables) {
+    if (shcore::str_beginswith(table, "uk_") && table != "uk_not_null") {
+      EXPECT_THAT(expected,
+                  Contains("Table `" + std::string(db_name) + "`.`" + table +
+                           "` does not have primary or unique non null key "
+                           "defined"));
+    }
+  }
+
+  Schema_dumper cached(session);
+  cached.use_cache(&cache);
+  EXPECT_EQ(expected, dump(&cached));
+
+  EXPECT_TRUE(output_handler.std_err.empty());
+  wipe_all();
+
+  // metadata of all tables is fetched upfront, per-table queries are limited to
+  // SHOW CREATE statements and session setup
+  EXPECT_LT(cached.round_trips(), uncached.round_trips());
+}
+
 TEST_F(Schema_dumper_test, dump_schema) {
   Schema_dumper sd(session);
   sd.opt_mysqlaas = true;
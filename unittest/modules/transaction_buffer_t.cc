@@ -23,7 +23,9 @@
 
 #include "unittest/gprod_clean.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <vector>
 
 #include "modules/util/import_table/load_data.h"
 #include "mysqlshdk/libs/storage/backend/memory_file.h"
@@ -218,5 +220,73 @@ TEST(Transaction_buffer, test_subchunking) {
   std::cout << count << "\n";
 }
 
+TEST(Transaction_buffer, escape_parity) {
+  // rows ending with escaped escape characters, followed by a line terminator,
+  // and rows with escaped line terminators
+  std::string data;
+  std::vector<size_t> row_ends;
+
+  for (int i = 0; i < 200; ++i) {
+    data += std::string(i % 13, 'a' + i % 26);
+    data += std::string(2 * (i % 3), '\\');
+
+    if (0 == i % 4) {
+      data += "\\\n";
+    }
+
+    data += "\n";
+    row_ends.emplace_back(data.size());
+  }
+
+  const auto dialect = Dialect::csv_unix();
+
+  for (int max_trx_size = 20; max_trx_size < 60; max_trx_size += 7) {
+    SCOPED_TRACE("max_trx_size: " + std::to_string(max_trx_size));
+
+    mysqlshdk::storage::backend::Memory_file mfile("-");
+    mfile.set_content(data);
+    mfile.open(mysqlshdk::storage::Mode::READ);
+
+    Transaction_options options;
+    options.max_trx_size = max_trx_size;
+    Transaction_buffer buffer(dialect, &mfile, options);
+
+    std::string net_buffer;
+    net_buffer.resize(16);
+
+    std::string reassembled_data;
+
+    for (;;) {
+      std::string transaction_data;
+
+      for (;;) {
+        const auto bytes = buffer.read(&net_buffer[0], net_buffer.size());
+
+        if (bytes <= 0) break;
+
+        transaction_data.append(&net_buffer[0], bytes);
+
+        if (buffer.flush_pending()) break;
+      }
+
+      if (!transaction_data.empty()) {
+        reassembled_data.append(transaction_data);
+
+        // transaction always ends at the end of a row
+        EXPECT_TRUE(std::binary_search(row_ends.begin(), row_ends.end(),
+                                       reassembled_data.size()))
+            << "transaction ends in the middle of a row: "
+            << reassembled_data.size();
+      }
+
+      bool has_more;
+      buffer.flush_done(&has_more);
+      if (!has_more) break;
+    }
+
+    EXPECT_EQ(data, reassembled_data);
+  }
+}
+
 }  // namespace import_table
 }  // namespace mysqlsh
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/dump_metrics.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+Table_data_metrics metrics(uint64_t rows, milliseconds fetch) {
+  Table_data_metrics m;
+
+  m.chunks = 1;
+  m.rows = rows;
+  m.data_bytes = 10 * rows;
+  m.file_bytes = 5 * rows;
+  m.time = 2 * fetch;
+  m.first_row_time = milliseconds{1};
+  m.fetch_time = fetch;
+  m.encode_time = fetch / 2;
+  m.write_time = fetch / 4;
+
+  return m;
+}
+
+}  // namespace
+
+TEST(Dump_metrics, format) {
+  EXPECT_EQ(Metrics_format::JSON, to_metrics_format("json"));
+  EXPECT_EQ(Metrics_format::PROMETHEUS, to_metrics_format("prometheus"));
+  EXPECT_THROW(to_metrics_format("xml"), std::invalid_argument);
+  EXPECT_THROW(to_metrics_format("JSON"), std::invalid_argument);
+
+  EXPECT_EQ("json", to_string(Metrics_format::JSON));
+  EXPECT_EQ("prometheus", to_string(Metrics_format::PROMETHEUS));
+
+  EXPECT_STREQ("@.metrics.json",
+               Dump_metrics(Metrics_format::JSON, seconds{1}).filename());
+  EXPECT_STREQ("@.metrics.prom",
+               Dump_metrics(Metrics_format::PROMETHEUS, seconds{1}).filename());
+}
+
+TEST(Dump_metrics, json) {
+  Dump_metrics m{Metrics_format::JSON, seconds{1}};
+
+  m.update("s", "t", "chunk 1", metrics(100, milliseconds{200}));
+  m.update("s", "t", "chunk 0", metrics(50, milliseconds{100}));
+  m.update("s", "a", "whole table", metrics(1, milliseconds{2}));
+
+  const auto doc = shcore::Value::parse(m.format(true)).as_map();
+
+  EXPECT_TRUE(doc->get_bool("finished"));
+  EXPECT_FALSE(doc->get_string("timestamp").empty());
+
+  const auto tables = doc->get_array("tables");
+  ASSERT_EQ(2, tables->size());
+
+  // tables are sorted
+  const auto a = tables->at(0).as_map();
+  EXPECT_EQ("s", a->get_string("schema"));
+  EXPECT_EQ("a", a->get_string("table"));
+  EXPECT_EQ(1, a->get_uint("chunks"));
+  EXPECT_EQ(1, a->get_uint("rows"));
+
+  const auto t = tables->at(1).as_map();
+  EXPECT_EQ("s", t->get_string("schema"));
+  EXPECT_EQ("t", t->get_string("table"));
+  EXPECT_EQ(2, t->get_uint("chunks"));
+  EXPECT_EQ(150, t->get_uint("rows"));
+  EXPECT_EQ(1500, t->get_uint("dataBytes"));
+  EXPECT_EQ(750, t->get_uint("fileBytes"));
+  EXPECT_NEAR(0.6, t->get_double("seconds"), 1e-9);
+  EXPECT_NEAR(0.002, t->get_double("firstRowSeconds"), 1e-9);
+  EXPECT_NEAR(0.3, t->get_double("fetchSeconds"), 1e-9);
+  EXPECT_NEAR(0.15, t->get_double("encodeSeconds"), 1e-9);
+  EXPECT_NEAR(0.075, t->get_double("writeSeconds"), 1e-9);
+  EXPECT_NEAR(0.0, t->get_double("throttleSeconds"), 1e-9);
+
+  // chunks are sorted by their IDs
+  const auto chunks = t->get_array("chunkMetrics");
+  ASSERT_EQ(2, chunks->size());
+
+  const auto c0 = chunks->at(0).as_map();
+  EXPECT_EQ("chunk 0", c0->get_string("id"));
+  EXPECT_FALSE(c0->has_key("chunks"));
+  EXPECT_EQ(50, c0->get_uint("rows"));
+  EXPECT_EQ(500, c0->get_uint("dataBytes"));
+  EXPECT_NEAR(0.1, c0->get_double("fetchSeconds"), 1e-9);
+
+  const auto c1 = chunks->at(1).as_map();
+  EXPECT_EQ("chunk 1", c1->get_string("id"));
+  EXPECT_EQ(100, c1->get_uint("rows"));
+  EXPECT_NEAR(0.4, c1->get_double("seconds"), 1e-9);
+
+  ASSERT_EQ(1, a->get_array("chunkMetrics")->size());
+  EXPECT_EQ("whole table",
+            a->get_array("chunkMetrics")->at(0).as_map()->get_string("id"));
+}
+
+TEST(Dump_metrics, prometheus) {
+  Dump_metrics m{Metrics_format::PROMETHEUS, seconds{1}};
+
+  EXPECT_NE(std::string::npos,
+            m.format(false).find("mysqlsh_dump_finished 0\n"));
+
+  m.update("s\"1", "t\\\n", "chunk 0", metrics(100, milliseconds{200}));
+
+  const auto output = m.format(true);
+
+  EXPECT_NE(std::string::npos, output.find("mysqlsh_dump_finished 1\n"));
+  EXPECT_NE(std::string::npos,
+            output.find("# TYPE mysqlsh_dump_table_rows_total counter\n"));
+  EXPECT_NE(std::string::npos,
+            output.find("mysqlsh_dump_table_rows_total{schema=\"s\\\"1\","
+                        "table=\"t\\\\\\n\"} 100\n"));
+  EXPECT_NE(std::string::npos,
+            output.find("mysqlsh_dump_table_fetch_seconds_total{schema=\"s\\\""
+                        "1\",table=\"t\\\\\\n\"} 0.200000\n"));
+
+  // chunk-level metrics are not reported in this format
+  EXPECT_EQ(std::string::npos, output.find("chunk 0"));
+}
+
+TEST(Dump_metrics, write_due) {
+  Dump_metrics m{Metrics_format::JSON, milliseconds{100}};
+
+  EXPECT_FALSE(m.write_due());
+
+  shcore::sleep_ms(150);
+
+  // only one of the concurrent callers gets to write the output
+  std::atomic<int> due{0};
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&]() {
+      if (m.write_due()) ++due;
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(1, due);
+  EXPECT_FALSE(m.write_due());
+}
+
+TEST(Dump_metrics, concurrent_updates) {
+  Dump_metrics m{Metrics_format::JSON, seconds{1}};
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < 1000; ++j) {
+        m.update("s", "t", "chunk " + std::to_string(j % 2),
+                 metrics(1, milliseconds{1}));
+      }
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  const auto doc = shcore::Value::parse(m.format(false)).as_map();
+  const auto t = doc->get_array("tables")->at(0).as_map();
+
+  EXPECT_EQ(4000, t->get_uint("chunks"));
+  EXPECT_EQ(4000, t->get_uint("rows"));
+
+  const auto chunks = t->get_array("chunkMetrics");
+  ASSERT_EQ(2, chunks->size());
+  EXPECT_EQ(2000, chunks->at(0).as_map()->get_uint("rows"));
+  EXPECT_EQ(2000, chunks->at(1).as_map()->get_uint("rows"));
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
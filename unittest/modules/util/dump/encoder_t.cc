@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/encoder.h"
+
+#include <cstddef>
+#include <random>
+#include <string>
+
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace encoder {
+
+namespace {
+
+std::string encode_base64(const std::string &data) {
+  std::string result(base64_length(data.length()), '\0');
+  result.resize(base64(data.data(), data.length(), result.data()) -
+                result.data());
+  return result;
+}
+
+std::string encode_hex(const std::string &data) {
+  std::string result(hex_length(data.length()), '\0');
+  result.resize(hex(data.data(), data.length(), result.data()) -
+                result.data());
+  return result;
+}
+
+std::string reference_hex(const std::string &data) {
+  static constexpr char k_digits[] = "0123456789ABCDEF";
+  std::string result;
+
+  for (const auto c : data) {
+    result += k_digits[static_cast<unsigned char>(c) >> 4];
+    result += k_digits[c & 0x0f];
+  }
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Dump_encoder, base64) {
+  SCOPED_TRACE(implementation());
+
+  // RFC 4648 test vectors
+  EXPECT_EQ("", encode_base64(""));
+  EXPECT_EQ("Zg==", encode_base64("f"));
+  EXPECT_EQ("Zm8=", encode_base64("fo"));
+  EXPECT_EQ("Zm9v", encode_base64("foo"));
+  EXPECT_EQ("Zm9vYg==", encode_base64("foob"));
+  EXPECT_EQ("Zm9vYmE=", encode_base64("fooba"));
+  EXPECT_EQ("Zm9vYmFy", encode_base64("foobar"));
+
+  // characters from all the ranges of the alphabet
+  EXPECT_EQ("AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8gISIjJCUmJygpKissLS4v"
+            "+/v7/w==",
+            encode_base64(std::string{"\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09"
+                                      "\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13"
+                                      "\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d"
+                                      "\x1e\x1f\x20\x21\x22\x23\x24\x25\x26\x27"
+                                      "\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f\xfb\xfb"
+                                      "\xfb\xff",
+                                      52}));
+
+  // vectorised code paths, including the scalar tail
+  std::mt19937 generator{5489u};
+  std::uniform_int_distribution<int> byte{0, 255};
+
+  for (std::size_t length = 0; length <= 300; ++length) {
+    SCOPED_TRACE("length: " + std::to_string(length));
+
+    std::string data;
+
+    for (std::size_t i = 0; i < length; ++i) {
+      data += static_cast<char>(byte(generator));
+    }
+
+    std::string expected;
+    ASSERT_TRUE(shcore::encode_base64(
+        reinterpret_cast<const unsigned char *>(data.data()),
+        static_cast<int>(data.length()), &expected));
+
+    const auto actual = encode_base64(data);
+    EXPECT_EQ(base64_length(length), actual.length());
+    EXPECT_EQ(expected, actual);
+  }
+}
+
+TEST(Dump_encoder, hex) {
+  SCOPED_TRACE(implementation());
+
+  EXPECT_EQ("", encode_hex(""));
+  EXPECT_EQ("00", encode_hex(std::string{"\0", 1}));
+  EXPECT_EQ("0123456789ABCDEFFF",
+            encode_hex("\x01\x23\x45\x67\x89\xab\xcd\xef\xff"));
+
+  std::mt19937 generator{5489u};
+  std::uniform_int_distribution<int> byte{0, 255};
+
+  for (std::size_t length = 0; length <= 300; ++length) {
+    SCOPED_TRACE("length: " + std::to_string(length));
+
+    std::string data;
+
+    for (std::size_t i = 0; i < length; ++i) {
+      data += static_cast<char>(byte(generator));
+    }
+
+    const auto actual = encode_hex(data);
+    EXPECT_EQ(hex_length(length), actual.length());
+    EXPECT_EQ(reference_hex(data), actual);
+  }
+}
+
+TEST(Dump_encoder, find_escape_candidate) {
+  SCOPED_TRACE(implementation());
+
+  const char escaped[k_escaped_characters] = {'\\', '\t', '\n', '"'};
+
+  const auto find = [&escaped](const std::string &data) {
+    return find_escape_candidate(data.data(), data.data() + data.length(),
+                                 escaped) -
+           data.data();
+  };
+
+  EXPECT_EQ(0, find(""));
+  EXPECT_EQ(3, find("abc"));
+  EXPECT_EQ(1, find("a\\bc"));
+  EXPECT_EQ(2, find(std::string{"ab\0c", 4}));
+  EXPECT_EQ(0, find("\x1A"));
+  EXPECT_EQ(1, find("\x1B\x01"));
+  EXPECT_EQ(2, find("\x7f\xff\""));
+
+  // vectorised code paths, including the scalar tail
+  std::mt19937 generator{5489u};
+  std::uniform_int_distribution<int> byte{0, 255};
+
+  for (std::size_t length = 0; length <= 300; ++length) {
+    SCOPED_TRACE("length: " + std::to_string(length));
+
+    for (std::size_t position = 0; position <= length; ++position) {
+      // none of the bytes match, except for the one at the given position
+      std::string data;
+
+      while (data.length() < length) {
+        const auto c = static_cast<char>(byte(generator));
+
+        if (static_cast<unsigned char>(c) > 0x1A && '\\' != c && '"' != c) {
+          data += c;
+        }
+      }
+
+      if (position < length) {
+        data[position] = escaped[position % k_escaped_characters];
+
+        if (position % 5 == 4) {
+          data[position] = static_cast<char>(position % 0x1B);
+        }
+      }
+
+      EXPECT_EQ(static_cast<std::ptrdiff_t>(position), find(data));
+    }
+  }
+}
+
+}  // namespace encoder
+}  // namespace dump
+}  // namespace mysqlsh
@@ -232,6 +232,109 @@ TEST_P(Object_storage_test, file_write_multipart_upload) {
   bucket.delete_object("test/sample\".txt");
 }
 
+TEST_P(Object_storage_test, file_write_parallel_multipart_upload) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  auto config = get_config();
+  config->set_part_size(k_min_part_size);
+  config->set_parallel_uploads(3);
+  config->set_upload_memory_limit(2 * k_min_part_size);
+  S3_bucket bucket(config);
+  Directory root(config, "test");
+
+  auto file = root.file("parallel.txt");
+
+  std::string data;
+  constexpr std::size_t k_parts = 5;
+
+  for (std::size_t i = 0; i < k_parts; ++i) {
+    data += std::string(k_min_part_size, 'a' + i);
+  }
+
+  data += "tail";
+
+  size_t offset = 0;
+
+  file->open(Mode::WRITE);
+
+  while (offset < data.size()) {
+    offset += file->write(data.data() + offset,
+                          std::min(k_min_part_size / 3, data.size() - offset));
+  }
+
+  EXPECT_EQ(data.size(), file->file_size());
+
+  // close() waits for all the parts to be uploaded
+  file->close();
+
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+
+  file->open(Mode::READ);
+  std::string buffer;
+  buffer.resize(data.size() + 5);
+  size_t read = file->read(buffer.data(), buffer.size());
+  EXPECT_EQ(data.size(), read);
+  buffer.resize(read);
+  EXPECT_EQ(data, buffer);
+  file->close();
+
+  bucket.delete_object("test/parallel.txt");
+}
+
+TEST_P(Object_storage_test, file_read_parallel_downloads) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  auto config = get_config();
+  const auto chunk_size = config->download_chunk_size();
+  EXPECT_THROW_MSG(config->set_download_chunk_size(0), std::invalid_argument,
+                   "The size of a download chunk must be greater than 0.");
+  EXPECT_EQ(chunk_size, config->download_chunk_size());
+
+  config->set_parallel_downloads(3);
+  config->set_download_chunk_size(1000);
+  config->set_download_memory_limit(2500);
+  S3_bucket bucket(config);
+  Directory root(config, "test");
+
+  std::string data;
+
+  for (int i = 0; i < 1000; ++i) {
+    data += std::to_string(i) + "\n";
+  }
+
+  bucket.put_object("test/prefetch.txt", data.data(), data.size());
+
+  auto file = root.file("prefetch.txt");
+  file->open(Mode::READ);
+
+  // reads crossing the chunk boundaries
+  std::string buffer;
+  std::string chunk;
+  chunk.resize(777);
+  ssize_t read = 0;
+
+  while ((read = file->read(chunk.data(), chunk.size())) > 0) {
+    buffer.append(chunk.data(), read);
+  }
+
+  EXPECT_EQ(data, buffer);
+
+  // seek outside of the read-ahead window
+  file->seek(10);
+  chunk.resize(1500);
+  read = file->read(chunk.data(), chunk.size());
+  EXPECT_EQ(1500, read);
+  EXPECT_EQ(data.substr(10, 1500), chunk);
+
+  // seek to the end of the object
+  file->seek(data.size());
+  EXPECT_EQ(0, file->read(chunk.data(), chunk.size()));
+
+  file->close();
+
+  bucket.delete_object("test/prefetch.txt");
+}
+
 TEST_P(Object_storage_test, file_append_new_file) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
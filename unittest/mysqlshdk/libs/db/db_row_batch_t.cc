@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gtest_clean.h"
+
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/db/row_batch.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+const std::vector<Type> k_types = {
+    Type::Null,    Type::String,   Type::Bytes, Type::Integer, Type::UInteger,
+    Type::Float,   Type::Double,   Type::Decimal, Type::Date,  Type::Time,
+    Type::DateTime, Type::Bit,     Type::Geometry, Type::Json, Type::Enum,
+    Type::Set};
+
+Mutable_row make_row(int i) {
+  return Mutable_row(
+      k_types, nullptr, "string " + std::to_string(i),
+      std::string("by\0tes", 6), -i, static_cast<uint64_t>(i) << 40,
+      1.5f * i, 2.25 * i, std::to_string(i) + ".25", "2024-01-0" +
+      std::to_string(i % 9 + 1), "12:34:56", "2024-01-01 12:34:56", "101",
+      "geometry", "{\"a\": 1}", "enum", "a,b");
+}
+
+void expect_equal(const IRow &expected, const IRow &actual) {
+  ASSERT_EQ(expected.num_fields(), actual.num_fields());
+
+  for (uint32_t i = 0; i < expected.num_fields(); ++i) {
+    SCOPED_TRACE("field " + std::to_string(i));
+
+    EXPECT_EQ(expected.get_type(i), actual.get_type(i));
+    EXPECT_EQ(expected.is_null(i), actual.is_null(i));
+    EXPECT_EQ(expected.get_as_string(i), actual.get_as_string(i));
+
+    if (expected.is_null(i)) {
+      EXPECT_THROW(actual.get_string(i), std::invalid_argument);
+      EXPECT_THROW(actual.get_int(i), std::invalid_argument);
+
+      const char *data = "x";
+      size_t size = 1;
+      actual.get_raw_data(i, &data, &size);
+      EXPECT_EQ(nullptr, data);
+      EXPECT_EQ(0, size);
+      continue;
+    }
+
+    switch (expected.get_type(i)) {
+      case Type::String:
+      case Type::Bytes:
+        EXPECT_EQ(std::string(actual.get_string_data(i).first,
+                              actual.get_string_data(i).second),
+                  expected.get_string(i));
+        [[fallthrough]];
+
+      case Type::Date:
+      case Type::Time:
+      case Type::DateTime:
+      case Type::Geometry:
+      case Type::Json:
+      case Type::Enum:
+      case Type::Set:
+        EXPECT_EQ(expected.get_string(i), actual.get_string(i));
+        EXPECT_THROW(actual.get_int(i), std::invalid_argument);
+        EXPECT_THROW(actual.get_double(i), std::invalid_argument);
+        break;
+
+      case Type::Integer:
+      case Type::UInteger:
+        EXPECT_EQ(expected.get_int(i), actual.get_int(i));
+        EXPECT_THROW(actual.get_double(i), std::invalid_argument);
+        EXPECT_THROW(actual.get_string(i), std::invalid_argument);
+        break;
+
+      case Type::Float:
+      case Type::Double:
+        EXPECT_EQ(expected.get_float(i), actual.get_float(i));
+        EXPECT_EQ(expected.get_double(i), actual.get_double(i));
+        EXPECT_THROW(actual.get_int(i), std::invalid_argument);
+        break;
+
+      case Type::Decimal:
+        EXPECT_EQ(expected.get_double(i), actual.get_double(i));
+        EXPECT_THROW(actual.get_int(i), std::invalid_argument);
+        break;
+
+      case Type::Bit:
+        EXPECT_EQ(expected.get_bit(i), actual.get_bit(i));
+        break;
+
+      case Type::Null:
+        break;
+    }
+
+    const char *expected_data;
+    size_t expected_size;
+    expected.get_raw_data(i, &expected_data, &expected_size);
+    const auto expected_raw = std::string(expected_data, expected_size);
+
+    const char *actual_data;
+    size_t actual_size;
+    actual.get_raw_data(i, &actual_data, &actual_size);
+    EXPECT_EQ(expected_raw, std::string(actual_data, actual_size));
+  }
+
+  EXPECT_THROW(actual.get_type(expected.num_fields()), std::invalid_argument);
+  EXPECT_THROW(actual.is_null(expected.num_fields()), std::invalid_argument);
+}
+
+}  // namespace
+
+TEST(Row_batch, same_as_row_copy) {
+  Row_batch batch;
+  std::vector<Row_copy> copies;
+
+  for (int i = 0; i < 10; ++i) {
+    const auto row = make_row(i);
+    batch.append(row);
+    copies.emplace_back(row);
+  }
+
+  ASSERT_EQ(10, batch.size());
+  EXPECT_FALSE(batch.empty());
+
+  for (size_t i = 0; i < copies.size(); ++i) {
+    SCOPED_TRACE("row " + std::to_string(i));
+    expect_equal(copies[i], batch[i]);
+  }
+
+  size_t count = 0;
+
+  for (const auto &row : batch) {
+    EXPECT_EQ(&batch[count++], &row);
+  }
+
+  EXPECT_EQ(10, count);
+  EXPECT_EQ(&batch[0], &batch.front());
+  EXPECT_EQ(&batch[9], &batch.back());
+}
+
+TEST(Row_batch, nulls) {
+  // more than 64 fields, so that the NULL bitmap spans multiple words
+  constexpr uint32_t k_fields = 100;
+  const std::vector<Type> types(k_fields, Type::Integer);
+  Row_batch batch;
+
+  for (uint32_t r = 0; r < 5; ++r) {
+    Mutable_row row{types};
+
+    for (uint32_t f = 0; f < k_fields; ++f) {
+      if ((f + r) % 3) {
+        row.set_field(f, static_cast<int64_t>(f * r));
+      }
+    }
+
+    batch.append(row);
+  }
+
+  for (uint32_t r = 0; r < 5; ++r) {
+    for (uint32_t f = 0; f < k_fields; ++f) {
+      if ((f + r) % 3) {
+        ASSERT_FALSE(batch[r].is_null(f));
+        EXPECT_EQ(f * r, batch[r].get_int(f));
+      } else {
+        EXPECT_TRUE(batch[r].is_null(f));
+      }
+    }
+  }
+}
+
+TEST(Row_batch, raw_data_of_different_rows) {
+  const std::vector<Type> types = {Type::Integer, Type::String};
+  Row_batch batch;
+
+  batch.append(Mutable_row(types, 1234, "first"));
+  batch.append(Mutable_row(types, 5678, "second"));
+
+  const char *data[4];
+  size_t size[4];
+
+  batch[0].get_raw_data(0, &data[0], &size[0]);
+  batch[0].get_raw_data(1, &data[1], &size[1]);
+  batch[1].get_raw_data(0, &data[2], &size[2]);
+  batch[1].get_raw_data(1, &data[3], &size[3]);
+
+  // converted values of different rows do not overwrite each other
+  EXPECT_EQ("1234", std::string(data[0], size[0]));
+  EXPECT_EQ("first", std::string(data[1], size[1]));
+  EXPECT_EQ("5678", std::string(data[2], size[2]));
+  EXPECT_EQ("second", std::string(data[3], size[3]));
+}
+
+TEST(Row_batch, clear) {
+  Row_batch batch;
+
+  batch.append(make_row(1));
+  batch.append(make_row(2));
+
+  const auto data_size = batch.data_size();
+  EXPECT_LT(0, data_size);
+
+  batch.clear();
+
+  EXPECT_TRUE(batch.empty());
+  EXPECT_EQ(0, batch.size());
+  EXPECT_EQ(0, batch.data_size());
+
+  // rows with different types can be stored once the batch is cleared
+  batch.append(Mutable_row({Type::String, Type::Integer}, "text", 7));
+  batch.shrink_to_fit();
+
+  ASSERT_EQ(1, batch.size());
+  EXPECT_EQ(2, batch[0].num_fields());
+  EXPECT_EQ("text", batch[0].get_string(0));
+  EXPECT_EQ(7, batch[0].get_int(1));
+}
+
+TEST(Row_batch, append_failure) {
+  class Failing_row : public Mutable_row {
+   public:
+    using Mutable_row::Mutable_row;
+
+    std::pair<const char *, size_t> get_string_data(
+        uint32_t index) const override {
+      if (is_null(0)) throw std::runtime_error("failure");
+      return Mutable_row::get_string_data(index);
+    }
+  };
+
+  const std::vector<Type> types = {Type::Integer, Type::String};
+  Row_batch batch;
+
+  batch.append(Failing_row(types, 1, "one"));
+
+  // NULL value followed by a failure
+  Failing_row failing{types};
+  failing.set_field(1, "two");
+  EXPECT_THROW(batch.append(failing), std::runtime_error);
+
+  // different number of fields
+  EXPECT_THROW(batch.append(Mutable_row({Type::Integer}, 3)),
+               std::invalid_argument);
+
+  batch.append(Failing_row(types, 4, "four"));
+
+  // partially copied row is removed
+  ASSERT_EQ(2, batch.size());
+  EXPECT_FALSE(batch[0].is_null(0));
+  EXPECT_EQ(1, batch[0].get_int(0));
+  EXPECT_EQ("one", batch[0].get_string(1));
+  EXPECT_FALSE(batch[1].is_null(0));
+  EXPECT_EQ(4, batch[1].get_int(0));
+  EXPECT_EQ("four", batch[1].get_string(1));
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
@@ -21,6 +21,8 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <vector>
+
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -181,6 +183,26 @@ TEST_F(Db_tests, query) {
   } while (switch_proto());
 }
 
+TEST_F(Db_tests, query_udf_unbuffered) {
+  // classic protocol pre-fetches the first row of an unbuffered UDF query to
+  // check for errors, the rows which follow it must not be lost
+  auto connection_options = shcore::get_connection_options(uri());
+  session->connect(connection_options);
+
+  const auto result = session->query_udf(
+      "SELECT 1 UNION ALL SELECT 2 UNION ALL SELECT 3", false);
+  std::vector<int64_t> values;
+
+  while (const auto row = result->fetch_one()) {
+    values.emplace_back(row->get_int(0));
+  }
+
+  EXPECT_EQ((std::vector<int64_t>{1, 2, 3}), values);
+  EXPECT_EQ(nullptr, result->fetch_one());
+
+  session->close();
+}
+
 TEST_F(Db_tests, auto_close) {
   do {
     SCOPED_TRACE(is_classic ? "mysql" : "mysqlx");
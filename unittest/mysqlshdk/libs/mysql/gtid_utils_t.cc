@@ -23,6 +23,8 @@
 
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 
+#include <mysqld_error.h>
+
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_mysql_session.h"
@@ -68,14 +70,7 @@ TEST_F(Gtid_utils, gtid_set_basics) {
     EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:5", gs.str());
   }
 
-  EXPECT_THROW(gs2_s.count(), std::invalid_argument);
-
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-  mysqlshdk::mysql::Instance server(session);
-
-  gs2_s.normalize(server);
-  gs6.normalize(server);
+  EXPECT_EQ(43, gs2_s.count());
 
   EXPECT_EQ(gs2_r, gs2_s);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2_r.str());
@@ -100,29 +95,24 @@ TEST_F(Gtid_utils, gtid_set_basics) {
   EXPECT_FALSE(gs2.empty());
   EXPECT_EQ(43, gs2.count());
 
-  EXPECT_TRUE(gs2_r.contains(gs2_s, server));
-  EXPECT_TRUE(gs2_r.contains(gs2_s, server));
-  EXPECT_TRUE(gs2.contains(gs3, server));
-  EXPECT_FALSE(gs3.contains(gs2, server));
+  EXPECT_TRUE(gs2_r.contains(gs2_s));
+  EXPECT_TRUE(gs2_r.contains(gs2_s));
+  EXPECT_TRUE(gs2.contains(gs3));
+  EXPECT_FALSE(gs3.contains(gs2));
 
-  EXPECT_FALSE(gs2.contains(gs4, server));
-  EXPECT_FALSE(gs4.contains(gs2, server));
+  EXPECT_FALSE(gs2.contains(gs4));
+  EXPECT_FALSE(gs4.contains(gs2));
 
-  EXPECT_FALSE(gs2.contains(gs5, server));
-  EXPECT_FALSE(gs5.contains(gs2, server));
+  EXPECT_FALSE(gs2.contains(gs5));
+  EXPECT_FALSE(gs5.contains(gs2));
 
-  EXPECT_TRUE(gs6.contains(gs2, server));
-  EXPECT_TRUE(gs6.contains(gs5, server));
+  EXPECT_TRUE(gs6.contains(gs2));
+  EXPECT_TRUE(gs6.contains(gs5));
 
   EXPECT_EQ(50, gs6.count());
 }
 
 TEST_F(Gtid_utils, gtid_set_ops) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   Gtid_set gs1;
   Gtid_set gs2_r(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", 1, 43});
   Gtid_set gs2_s(
@@ -141,7 +131,6 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(gs2_s);
-  gs2.normalize(server);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
@@ -150,35 +139,25 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(gs3);
-  EXPECT_THROW(
-      {
-        bool x = gs3 == gs2;
-        (void)x;
-      },
-      std::invalid_argument);
-  EXPECT_THROW(gs2.count(), std::invalid_argument);
-  gs2.normalize(server);
+  EXPECT_EQ(gs2_r, gs2);
+  EXPECT_EQ(43, gs2.count());
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs4);
-  gs2.normalize(server);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-44", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs5);
-  gs2.normalize(server);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43:45-70", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs4);
   gs2.add(gs5);
-  gs2.normalize(server);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-70", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs8);
-  gs2.normalize(server);
   EXPECT_EQ(
       "88888888-8803-11eb-af3d-a1178d81dccc:1-8,\n8b8dc2ba-8803-11eb-af3d-"
       "a1178d81dccc:1-43",
@@ -186,18 +165,11 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", 99, 99));
-  EXPECT_THROW(
-      {
-        bool x = gs1 == gs2;
-        (void)x;
-      },
-      std::invalid_argument);
-  gs2.normalize(server);
+  EXPECT_NE(gs2_r, gs2);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43:99", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("9b8dc2ba-0000-11eb-af3d-a1178d81dccc", 99, 99));
-  gs2.normalize(server);
   EXPECT_EQ(
       "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43,\n9b8dc2ba-0000-11eb-af3d-"
       "a1178d81dccc:99",
@@ -205,7 +177,6 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("9b8dc2ba-0000-11eb-af3d-a1178d81dccc", 10, 99));
-  gs2.normalize(server);
   EXPECT_EQ(
       "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43,\n9b8dc2ba-0000-11eb-af3d-"
       "a1178d81dccc:10-99",
@@ -213,36 +184,30 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", 10, 99));
-  gs2.normalize(server);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-99", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs1, server);
+  gs2.subtract(gs1);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs2, server);
+  gs2.subtract(gs2);
   EXPECT_EQ("", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs5, server);
+  gs2.subtract(gs5);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs3, server);
+  gs2.subtract(gs3);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:6-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs7, server);
+  gs2.subtract(gs7);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-9:21-43", gs2.str());
 }
 
 TEST_F(Gtid_utils, gtid_set_enumerate) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   Gtid_set gs1(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", 1, 9});
   Gtid_set gs2(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", 1, 1});
   Gtid_set gs3(
@@ -256,7 +221,6 @@ TEST_F(Gtid_utils, gtid_set_enumerate) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
     EXPECT_EQ(gs1, result);
     EXPECT_EQ(gs1.count(), calls);
   }
@@ -267,14 +231,10 @@ TEST_F(Gtid_utils, gtid_set_enumerate) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
     EXPECT_EQ(gs2.str(), result.str());
     EXPECT_EQ(gs2.count(), calls);
   }
 
-  EXPECT_THROW(gs3.enumerate([&](const auto &) {}), std::invalid_argument);
-  gs3.normalize(server);
-
   {
     int calls = 0;
     Gtid_set result;
@@ -282,18 +242,12 @@ TEST_F(Gtid_utils, gtid_set_enumerate) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
     EXPECT_EQ(gs3.str(), result.str());
     EXPECT_EQ(gs3.count(), calls);
   }
 }
 
 TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   Gtid_set gs1(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", 1, 9});
   Gtid_set gs2(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", 1, 1});
   Gtid_set gs3(
@@ -307,7 +261,6 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
       result.add(gtids);
       ++calls;
     });
-    result.normalize(server);
     EXPECT_EQ(gs1, result);
     EXPECT_EQ(1, calls);
   }
@@ -318,15 +271,10 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
       result.add(gtids);
       ++calls;
     });
-    result.normalize(server);
     EXPECT_EQ(gs2.str(), result.str());
     EXPECT_EQ(1, calls);
   }
 
-  EXPECT_THROW(gs3.enumerate_ranges([&](const auto &) {}),
-               std::invalid_argument);
-  gs3.normalize(server);
-
   {
     int calls = 0;
     Gtid_set result;
@@ -336,7 +284,6 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
       ranges.push_back(gtids);
       ++calls;
     });
-    result.normalize(server);
     EXPECT_EQ(gs3.str(), result.str());
     EXPECT_EQ(3, calls);
     EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", std::get<0>(ranges[0]));
@@ -352,21 +299,14 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
 }
 
 TEST_F(Gtid_utils, subtract_view_changes) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   auto gtid_set = Gtid_set::from_string(
       "ec32d2c0-d3f0-11eb-abf3-eb7171e21adc:1-79,\nec32e076-d3f0-11eb-abf3-"
       "eb7171e21adc:1-3,\nf37283fa-d3f0-11eb-84e6-06d82947e5a7:1-2");
 
-  gtid_set.normalize(server);
-
   auto view_changes =
       gtid_set.get_gtids_from("f37283fa-d3f0-11eb-84e6-06d82947e5a7");
 
-  gtid_set.subtract(view_changes, server);
+  gtid_set.subtract(view_changes);
 
   EXPECT_EQ(
       "ec32d2c0-d3f0-11eb-abf3-eb7171e21adc:1-79,\nec32e076-d3f0-11eb-abf3-"
@@ -374,5 +314,137 @@ TEST_F(Gtid_utils, subtract_view_changes) {
       gtid_set.str());
 }
 
+TEST_F(Gtid_utils, gtid_set_parse) {
+  // text produced by the server is written back without any changes
+  for (const auto &text : {
+           "",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43:45-50:99",
+           "88888888-8803-11eb-af3d-a1178d81dccc:1-8,\n"
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-5:aa:1-3:7:bb:2,\n"
+           "9b8dc2ba-0000-11eb-af3d-a1178d81dccc:tag:10",
+       }) {
+    EXPECT_EQ(text, Gtid_set::from_string(text).str());
+  }
+
+  // text is normalized
+  EXPECT_EQ(
+      "88888888-8803-11eb-af3d-a1178d81dccc:1-8,\n"
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-44:99",
+      Gtid_set::from_string(" 8B8DC2BA-8803-11EB-AF3D-A1178D81DCCC:99:10-44 , "
+                            "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-20,,"
+                            "\n88888888-8803-11eb-af3d-a1178d81dccc:1-8")
+          .str());
+  EXPECT_EQ(
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-3:aa:1-3:bb:5",
+      Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:BB:5:Aa:1-2,"
+                            "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-3:aa:3")
+          .str());
+
+  for (const auto &text : {
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:0",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:5-1",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1x",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1:2tag:3",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1:tag-x:3",
+           "8b8dc2ba880311ebaf3da1178d81dccc:1",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccz:1",
+       }) {
+    EXPECT_THROW(Gtid_set::from_string(text), shcore::Exception) << text;
+  }
+
+  try {
+    Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:0");
+    ADD_FAILURE() << "Exception expected";
+  } catch (const shcore::Exception &e) {
+    // same error as reported by the server
+    EXPECT_EQ(ER_MALFORMED_GTID_SET_SPECIFICATION, e.code());
+  }
+}
+
+TEST_F(Gtid_utils, gtid_set_algebra) {
+  const auto uuid1 = "8b8dc2ba-8803-11eb-af3d-a1178d81dccc";
+  const auto uuid2 = "9b8dc2ba-0000-11eb-af3d-a1178d81dccc";
+  const auto set = [](const std::string &text) {
+    return Gtid_set::from_string(text);
+  };
+
+  const auto gs1 = set(std::string{uuid1} + ":1-10:20-30:tag:1-5," + uuid2 +
+                       ":1-100");
+  const auto gs2 = set(std::string{uuid1} + ":5-25:tag:5-9," + uuid2 + ":50");
+
+  {
+    auto gs = gs1;
+    gs.add(gs2);
+    EXPECT_EQ(std::string{uuid1} + ":1-30:tag:1-9,\n" + uuid2 + ":1-100",
+              gs.str());
+    EXPECT_EQ(139, gs.count());
+  }
+
+  {
+    auto gs = gs1;
+    gs.subtract(gs2);
+    EXPECT_EQ(std::string{uuid1} + ":1-4:26-30:tag:1-4,\n" + uuid2 +
+                  ":1-49:51-100",
+              gs.str());
+    EXPECT_EQ(112, gs.count());
+  }
+
+  {
+    auto gs = gs2;
+    gs.subtract(gs1);
+    EXPECT_EQ(std::string{uuid1} + ":11-19:tag:6-9", gs.str());
+  }
+
+  {
+    auto gs = gs1;
+    gs.intersect(gs2);
+    EXPECT_EQ(std::string{uuid1} + ":5-10:20-25:tag:5,\n" + uuid2 + ":50",
+              gs.str());
+
+    EXPECT_TRUE(gs1.contains(gs));
+    EXPECT_TRUE(gs2.contains(gs));
+    EXPECT_FALSE(gs.contains(gs1));
+  }
+
+  {
+    auto gs = gs1;
+    gs.intersect(set(std::string{uuid2} + ":101-200"));
+    EXPECT_TRUE(gs.empty());
+    EXPECT_EQ("", gs.str());
+  }
+
+  EXPECT_TRUE(gs1.contains(Gtid_set()));
+  EXPECT_TRUE(gs1.contains(gs1));
+  EXPECT_FALSE(gs1.contains(gs2));
+  EXPECT_FALSE(gs2.contains(gs1));
+  // intervals which are adjacent are coalesced
+  EXPECT_TRUE(set(std::string{uuid1} + ":1-5:6-10").contains(
+      set(std::string{uuid1} + ":3-8")));
+  EXPECT_FALSE(set(std::string{uuid1} + ":1-5:7-10").contains(
+      set(std::string{uuid1} + ":3-8")));
+  // tagged and untagged GTIDs are different
+  EXPECT_FALSE(set(std::string{uuid1} + ":tag:1-5").contains(
+      set(std::string{uuid1} + ":1-5")));
+
+  EXPECT_EQ(set(std::string{uuid1} + ":tag:1-5"),
+            gs1.get_gtids_from(std::string{uuid1} + ":tag"));
+  EXPECT_EQ(set(std::string{uuid2} + ":1-100"), gs1.get_gtids_from(uuid2));
+  EXPECT_TRUE(gs1.get_gtids_from("").empty());
+
+  {
+    std::vector<std::string> gtids;
+    set(std::string{uuid1} + ":1-2:tag:3").enumerate(
+        [&gtids](const Gtid &gtid) { gtids.emplace_back(gtid); });
+    EXPECT_EQ((std::vector<std::string>{std::string{uuid1} + ":1",
+                                        std::string{uuid1} + ":2",
+                                        std::string{uuid1} + ":tag:3"}),
+              gtids);
+  }
+}
+
 }  // namespace mysql
 }  // namespace mysqlshdk
@@ -36,9 +36,6 @@ using testing::Mock_session;
 class Replication_test : public tests::Shell_base_test {};
 
 TEST_F(Replication_test, compare_gtid_sets) {
-  auto session = create_mysql_session(_mysql_uri);
-  Instance instance(session);
-
   std::string gtidset1 =
       "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-124,\n"
       "b75881c0-6ae5-11e9-bef7-24bb3d014d7f:1";
@@ -54,58 +51,55 @@ TEST_F(Replication_test, compare_gtid_sets) {
   std::string diff_b;
 
   EXPECT_EQ(Gtid_set_relation::EQUAL,
-            compare_gtid_sets(instance, gtidset1, gtidset1, &diff_a, &diff_b));
+            compare_gtid_sets(gtidset1, gtidset1, &diff_a, &diff_b));
   EXPECT_EQ("", diff_a);
   EXPECT_EQ("", diff_b);
 
   EXPECT_EQ(Gtid_set_relation::EQUAL,
-            compare_gtid_sets(instance, gtidset1, gtidset1r, &diff_a, &diff_b));
+            compare_gtid_sets(gtidset1, gtidset1r, &diff_a, &diff_b));
   EXPECT_EQ("", diff_a);
   EXPECT_EQ("", diff_b);
 
   EXPECT_EQ(Gtid_set_relation::EQUAL,
-            compare_gtid_sets(instance, "", "", &diff_a, &diff_b));
+            compare_gtid_sets("", "", &diff_a, &diff_b));
   EXPECT_EQ("", diff_a);
   EXPECT_EQ("", diff_b);
 
   EXPECT_EQ(Gtid_set_relation::DISJOINT,
-            compare_gtid_sets(instance, gtidset1, gtidset2, &diff_a, &diff_b));
+            compare_gtid_sets(gtidset1, gtidset2, &diff_a, &diff_b));
   EXPECT_EQ(gtidset2, diff_a);
   EXPECT_EQ(gtidset1, diff_b);
 
   EXPECT_EQ(Gtid_set_relation::INTERSECTS,
-            compare_gtid_sets(instance, gtidset1 + "," + gtidset2,
+            compare_gtid_sets(gtidset1 + "," + gtidset2,
                               gtidset3 + "," + gtidset1, &diff_a, &diff_b));
   EXPECT_EQ(gtidset3, diff_a);
   EXPECT_EQ(gtidset2, diff_b);
 
   EXPECT_EQ(Gtid_set_relation::CONTAINED,
-            compare_gtid_sets(instance, gtidset1, gtidset3 + "," + gtidset1,
+            compare_gtid_sets(gtidset1, gtidset3 + "," + gtidset1,
                               &diff_a, &diff_b));
   EXPECT_EQ(gtidset3, diff_a);
   EXPECT_EQ("", diff_b);
 
   EXPECT_EQ(Gtid_set_relation::CONTAINED,
-            compare_gtid_sets(instance, "", gtidset1, &diff_a, &diff_b));
+            compare_gtid_sets("", gtidset1, &diff_a, &diff_b));
   EXPECT_EQ(gtidset1, diff_a);
   EXPECT_EQ("", diff_b);
 
   EXPECT_EQ(Gtid_set_relation::CONTAINS,
-            compare_gtid_sets(instance, gtidset3 + "," + gtidset1, gtidset1,
+            compare_gtid_sets(gtidset3 + "," + gtidset1, gtidset1,
                               &diff_a, &diff_b));
   EXPECT_EQ("", diff_a);
   EXPECT_EQ(gtidset3, diff_b);
 
   EXPECT_EQ(Gtid_set_relation::CONTAINS,
-            compare_gtid_sets(instance, gtidset1, "", &diff_a, &diff_b));
+            compare_gtid_sets(gtidset1, "", &diff_a, &diff_b));
   EXPECT_EQ("", diff_a);
   EXPECT_EQ(gtidset1, diff_b);
 }
 
 TEST_F(Replication_test, check_replica_gtid_state) {
-  auto session = create_mysql_session(_mysql_uri);
-  Instance instance(session);
-
   const std::string gtidset1 =
       "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-124,\n"
       "b75881c0-6ae5-11e9-bef7-24bb3d014d7f:1";
@@ -120,71 +114,70 @@ TEST_F(Replication_test, check_replica_gtid_state) {
   std::string missing;
   std::string errant;
 
-  EXPECT_EQ(
-      Replica_gtid_state::NEW,
-      check_replica_gtid_state(instance, gtidset1, "", "", &missing, &errant));
+  EXPECT_EQ(Replica_gtid_state::NEW,
+            check_replica_gtid_state(gtidset1, "", "", &missing, &errant));
   EXPECT_EQ(gtidset1, missing);
   EXPECT_EQ("", errant);
 
-  EXPECT_EQ(Replica_gtid_state::IDENTICAL,
-            check_replica_gtid_state(instance, gtidset1, "", gtidset1, &missing,
-                                     &errant));
+  EXPECT_EQ(
+      Replica_gtid_state::IDENTICAL,
+      check_replica_gtid_state(gtidset1, "", gtidset1, &missing, &errant));
   EXPECT_EQ("", missing);
   EXPECT_EQ("", errant);
 
   EXPECT_EQ(Replica_gtid_state::IDENTICAL,
-            check_replica_gtid_state(instance, gtidset1, gtidset1, gtidset1r,
-                                     &missing, &errant));
+            check_replica_gtid_state(gtidset1, gtidset1, gtidset1r, &missing,
+                                     &errant));
   EXPECT_EQ("", missing);
   EXPECT_EQ("", errant);
 
-  EXPECT_EQ(
-      Replica_gtid_state::IDENTICAL,
-      check_replica_gtid_state(instance, gtidset1 + "," + gtidset2, gtidset1,
-                               gtidset1r + "," + gtidset2, &missing, &errant));
+  EXPECT_EQ(Replica_gtid_state::IDENTICAL,
+            check_replica_gtid_state(gtidset1 + "," + gtidset2, gtidset1,
+                                     gtidset1r + "," + gtidset2, &missing,
+                                     &errant));
   EXPECT_EQ("", missing);
   EXPECT_EQ("", errant);
 
-  EXPECT_EQ(Replica_gtid_state::IRRECOVERABLE,
-            check_replica_gtid_state(instance, gtidset1, gtidset1, "", &missing,
-                                     &errant));
+  EXPECT_EQ(
+      Replica_gtid_state::IRRECOVERABLE,
+      check_replica_gtid_state(gtidset1, gtidset1, "", &missing, &errant));
   EXPECT_EQ(gtidset1, missing);
   EXPECT_EQ("", errant);
 
   EXPECT_EQ(Replica_gtid_state::IRRECOVERABLE,
-            check_replica_gtid_state(instance, gtidset1 + "," + gtidset2,
-                                     gtidset1, "", &missing, &errant));
+            check_replica_gtid_state(gtidset1 + "," + gtidset2, gtidset1, "",
+                                     &missing, &errant));
   EXPECT_EQ(gtidset1 + "," + gtidset2, missing);
   EXPECT_EQ("", errant);
 
   EXPECT_EQ(Replica_gtid_state::IRRECOVERABLE,
-            check_replica_gtid_state(instance, gtidset1 + "," + gtidset2,
-                                     gtidset1, gtidset2, &missing, &errant));
+            check_replica_gtid_state(gtidset1 + "," + gtidset2, gtidset1,
+                                     gtidset2, &missing, &errant));
   EXPECT_EQ(gtidset1, missing);
   EXPECT_EQ("", errant);
 
   EXPECT_EQ(Replica_gtid_state::RECOVERABLE,
-            check_replica_gtid_state(instance, gtidset1 + "," + gtidset2,
-                                     gtidset1, gtidset1, &missing, &errant));
+            check_replica_gtid_state(gtidset1 + "," + gtidset2, gtidset1,
+                                     gtidset1, &missing, &errant));
   EXPECT_EQ(gtidset2, missing);
   EXPECT_EQ("", errant);
 
   EXPECT_EQ(Replica_gtid_state::RECOVERABLE,
-            check_replica_gtid_state(instance, gtidset1 + "," + gtidset2, "",
-                                     gtidset2, &missing, &errant));
+            check_replica_gtid_state(gtidset1 + "," + gtidset2, "", gtidset2,
+                                     &missing, &errant));
   EXPECT_EQ(gtidset1, missing);
   EXPECT_EQ("", errant);
 
-  EXPECT_EQ(
-      Replica_gtid_state::DIVERGED,
-      check_replica_gtid_state(instance, gtidset1 + "," + gtidset2, "",
-                               gtidset1 + "," + gtidset3, &missing, &errant));
+  EXPECT_EQ(Replica_gtid_state::DIVERGED,
+            check_replica_gtid_state(gtidset1 + "," + gtidset2, "",
+                                     gtidset1 + "," + gtidset3, &missing,
+                                     &errant));
   EXPECT_EQ(gtidset2, missing);
   EXPECT_EQ(gtidset3, errant);
 
-  EXPECT_EQ(Replica_gtid_state::DIVERGED,
-            check_replica_gtid_state(instance, gtidset1, "", gtidset3, &missing,
-                                     &errant));
+  EXPECT_EQ(
+      Replica_gtid_state::DIVERGED,
+      check_replica_gtid_state(gtidset1, "", gtidset3, &missing, &errant));
   EXPECT_EQ(gtidset1, missing);
   EXPECT_EQ(gtidset3, errant);
 }
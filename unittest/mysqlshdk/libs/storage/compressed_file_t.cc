@@ -30,6 +30,7 @@
 #include <utility>
 #include "mysqlshdk/libs/storage/backend/memory_file.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 
 namespace mysqlshdk {
@@ -154,11 +155,7 @@ class Compression
     if (mmap_mode.empty()) {
       return std::make_unique<backend::Memory_file>("");
     } else {
-      std::string fn;
-      if (std::get<0>(GetParam()) == storage::Compression::GZIP)
-        fn = "compressed.gz";
-      else
-        fn = "compressed.zst";
+      const auto fn = "compressed" + get_extension(std::get<0>(GetParam()));
       auto f = make_file(shcore::path::join_path(getenv("TMPDIR"), fn),
                          {{"file.mmap", mmap_mode}});
       f->remove();  // make sure file doesn't already exist
@@ -248,6 +245,14 @@ class Compression
         EXPECT_EQ(static_cast<std::string::value_type>(0xfd), header[3]);
         break;
 
+      case mysqlshdk::storage::Compression::LZ4:
+        // is lz4? (lz4 header startswith "\x04\x22\x4d\x18")
+        EXPECT_EQ(static_cast<std::string::value_type>(0x04), header[0]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x22), header[1]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x4d), header[2]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x18), header[3]);
+        break;
+
       case mysqlshdk::storage::Compression::NONE:
         break;
     }
@@ -375,6 +380,213 @@ TEST_P(Compression, compress_decompress_bigdata) {
   }
 }
 
+TEST(Zstd_file, seekable) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+  using Zstd_file = mysqlshdk::storage::compression::Zstd_file;
+  using Mode = mysqlshdk::storage::Mode;
+
+  const auto input_data = Generate_text().bytes(1000000);
+  const auto compress = [&input_data](size_t max_frame_size) {
+    auto file = std::make_unique<Memory_file>("");
+    const auto file_ptr = file.get();
+    Zstd_file zstd{std::move(file)};
+
+    zstd.set_max_frame_size(max_frame_size);
+    zstd.open(Mode::WRITE);
+
+    for (size_t offset = 0; offset < input_data.size(); offset += 7777) {
+      zstd.write(input_data.data() + offset,
+                 std::min<size_t>(7777, input_data.size() - offset));
+    }
+
+    zstd.close();
+
+    return file_ptr->content();
+  };
+  const auto decompress = [](const std::string &content) {
+    auto file = std::make_unique<Memory_file>("");
+    file->set_content(content);
+    return std::make_unique<Zstd_file>(std::move(file));
+  };
+
+  {
+    // single frame, no seek table
+    const auto zstd = decompress(compress(0));
+    EXPECT_FALSE(zstd->load_seek_table());
+    EXPECT_FALSE(zstd->is_seekable());
+  }
+
+  const auto zstd = decompress(compress(100000));
+  ASSERT_TRUE(zstd->load_seek_table());
+  EXPECT_TRUE(zstd->is_seekable());
+  EXPECT_EQ(input_data.size(), zstd->file_size());
+
+  byte buffer[BUFSIZE];
+  std::string output;
+
+  zstd->open(Mode::READ);
+
+  for (auto read_bytes = zstd->read(buffer, BUFSIZE); read_bytes > 0;
+       read_bytes = zstd->read(buffer, BUFSIZE)) {
+    output.append(buffer, read_bytes);
+  }
+
+  EXPECT_EQ(input_data, output);
+
+  std::mt19937_64 generator{42};
+  std::uniform_int_distribution<size_t> distribution(0, input_data.size());
+
+  for (int i = 0; i < 100; ++i) {
+    auto offset = distribution(generator);
+
+    if (i % 4 == 0) {
+      // frame boundary
+      offset = offset / 100000 * 100000;
+    }
+
+    SCOPED_TRACE("offset: " + std::to_string(offset));
+
+    zstd->seek(offset);
+    EXPECT_EQ(offset, zstd->tell());
+
+    const auto read_bytes = zstd->read(buffer, 100);
+    ASSERT_LE(0, read_bytes);
+    EXPECT_EQ(input_data.substr(offset, 100), std::string(buffer, read_bytes));
+    EXPECT_EQ(offset + read_bytes, zstd->tell());
+  }
+
+  zstd->close();
+}
+
+TEST(Zstd_file, seekable_short_backward_seeks) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+  using Zstd_file = mysqlshdk::storage::compression::Zstd_file;
+  using Mode = mysqlshdk::storage::Mode;
+
+  class Counting_file : public Memory_file {
+   public:
+    using Memory_file::Memory_file;
+
+    off64_t seek(off64_t offset) override {
+      ++seeks;
+      return Memory_file::seek(offset);
+    }
+
+    int seeks = 0;
+  };
+
+  const auto input_data = Generate_text().bytes(1000000);
+  std::string content;
+
+  {
+    auto file = std::make_unique<Memory_file>("");
+    const auto file_ptr = file.get();
+    Zstd_file zstd{std::move(file)};
+
+    zstd.set_max_frame_size(300000);
+    zstd.open(Mode::WRITE);
+    zstd.write(input_data.data(), input_data.size());
+    zstd.close();
+
+    content = file_ptr->content();
+  }
+
+  auto file = std::make_unique<Counting_file>("");
+  const auto file_ptr = file.get();
+  file->set_content(content);
+  Zstd_file zstd{std::move(file)};
+
+  ASSERT_TRUE(zstd.load_seek_table());
+  zstd.open(Mode::READ);
+
+  const auto seeks = file_ptr->seeks;
+  constexpr size_t k_buffer_size = 65536;
+  constexpr size_t k_overlap = 2;
+  char buffer[k_buffer_size];
+  size_t offset = 0;
+
+  // read the file the way the chunk scanner does: each buffer starts a few
+  // bytes before the end of the previous one
+  while (offset < input_data.size()) {
+    SCOPED_TRACE("offset: " + std::to_string(offset));
+
+    zstd.seek(offset);
+    ASSERT_EQ(offset, zstd.tell());
+
+    const auto read_bytes = zstd.read(buffer, k_buffer_size);
+    ASSERT_LT(0, read_bytes);
+    ASSERT_EQ(input_data.substr(offset, read_bytes),
+              std::string(buffer, read_bytes));
+
+    if (offset + read_bytes >= input_data.size()) break;
+
+    offset += read_bytes - k_overlap;
+  }
+
+  // backward seeks were served from the recently decompressed data, frames
+  // were not decompressed again
+  EXPECT_EQ(seeks, file_ptr->seeks);
+
+  // seek back within the history and read past its end
+  zstd.seek(input_data.size() - 1000);
+  zstd.seek(input_data.size() - 100);
+  EXPECT_EQ(100, zstd.read(buffer, k_buffer_size));
+  EXPECT_EQ(input_data.substr(input_data.size() - 100),
+            std::string(buffer, 100));
+  EXPECT_EQ(seeks, file_ptr->seeks);
+
+  // longer backward seek restarts the frame
+  zstd.seek(10);
+  EXPECT_EQ(1000, zstd.read(buffer, 1000));
+  EXPECT_EQ(input_data.substr(10, 1000), std::string(buffer, 1000));
+  EXPECT_EQ(seeks + 1, file_ptr->seeks);
+
+  zstd.close();
+}
+
+TEST(Zstd_file, workers) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+  using Zstd_file = mysqlshdk::storage::compression::Zstd_file;
+  using Mode = mysqlshdk::storage::Mode;
+
+  const auto input_data = Generate_text().bytes(10000000);
+
+  auto file = std::make_unique<Memory_file>("");
+  const auto file_ptr = file.get();
+  Zstd_file compress{std::move(file)};
+
+  compress.set_workers(4);
+  compress.open(Mode::WRITE);
+
+  for (size_t offset = 0; offset < input_data.size(); offset += BUFSIZE) {
+    compress.write(input_data.data() + offset,
+                   std::min(BUFSIZE, input_data.size() - offset));
+  }
+
+  compress.close();
+
+  // library may have been built without multithreading support
+  EXPECT_TRUE(4 == compress.workers() || 0 == compress.workers());
+
+  auto input = std::make_unique<Memory_file>("");
+  input->set_content(file_ptr->content());
+  Zstd_file decompress{std::move(input)};
+
+  byte buffer[BUFSIZE];
+  std::string output;
+
+  decompress.open(Mode::READ);
+
+  for (auto read_bytes = decompress.read(buffer, BUFSIZE); read_bytes > 0;
+       read_bytes = decompress.read(buffer, BUFSIZE)) {
+    output.append(buffer, read_bytes);
+  }
+
+  decompress.close();
+
+  EXPECT_EQ(input_data, output);
+}
+
 inline std::string fmt_compr(
     const testing::TestParamInfo<
         std::tuple<mysqlshdk::storage::Compression, std::string>> &info) {
@@ -392,7 +604,11 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, ""),
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "off"),
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "on"),
-        std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "required")),
+        std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "required"),
+        std::make_tuple(mysqlshdk::storage::Compression::LZ4, ""),
+        std::make_tuple(mysqlshdk::storage::Compression::LZ4, "off"),
+        std::make_tuple(mysqlshdk::storage::Compression::LZ4, "on"),
+        std::make_tuple(mysqlshdk::storage::Compression::LZ4, "required")),
     fmt_compr);
 
 }  // namespace tests
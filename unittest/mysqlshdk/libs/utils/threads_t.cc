@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/threads.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+using namespace std::chrono_literals;
+
+TEST(Fan_out, results_in_order) {
+  std::vector<int> items;
+
+  for (int i = 0; i < 20; ++i) {
+    items.emplace_back(i);
+  }
+
+  const auto results = fan_out<int>(
+      items,
+      [](int i) {
+        // later items finish first
+        std::this_thread::sleep_for(std::chrono::milliseconds(20 - i));
+        return i * i;
+      },
+      8, 0ms);
+
+  ASSERT_EQ(items.size(), results.size());
+
+  for (std::size_t i = 0; i < items.size(); ++i) {
+    EXPECT_EQ(items[i] * items[i], results[i].get());
+    EXPECT_FALSE(results[i].timed_out);
+  }
+}
+
+TEST(Fan_out, bounded_threads) {
+  std::atomic<int> running{0};
+  std::atomic<int> max_running{0};
+
+  const auto results = fan_out<bool>(
+      std::vector<int>(16, 0),
+      [&running, &max_running](int) {
+        const auto current = ++running;
+        auto max = max_running.load();
+
+        while (current > max &&
+               !max_running.compare_exchange_weak(max, current)) {
+        }
+
+        std::this_thread::sleep_for(10ms);
+        --running;
+        return true;
+      },
+      3, 0ms);
+
+  EXPECT_EQ(16, results.size());
+  EXPECT_GE(3, max_running.load());
+}
+
+TEST(Fan_out, errors) {
+  const auto results = fan_out<int>(
+      std::vector<int>{1, 2, 3},
+      [](int i) {
+        if (2 == i) throw std::runtime_error("failed");
+        return i;
+      },
+      2, 0ms);
+
+  ASSERT_EQ(3, results.size());
+  EXPECT_EQ(1, results[0].get());
+  EXPECT_THROW(results[1].get(), std::runtime_error);
+  EXPECT_FALSE(results[1].timed_out);
+  EXPECT_EQ(3, results[2].get());
+}
+
+TEST(Fan_out, deadline) {
+  const auto start = std::chrono::steady_clock::now();
+  const auto results = fan_out<int>(
+      std::vector<int>{1, 2, 3, 4},
+      [](int i) {
+        if (1 == i) std::this_thread::sleep_for(2s);
+        return i;
+      },
+      1, 200ms);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  ASSERT_EQ(4, results.size());
+  EXPECT_TRUE(results[0].timed_out);
+  EXPECT_THROW(results[0].get(), std::runtime_error);
+
+  // a replacement thread handled the remaining items
+  for (std::size_t i = 1; i < results.size(); ++i) {
+    EXPECT_EQ(static_cast<int>(i + 1), results[i].get());
+  }
+
+  EXPECT_GT(2s, elapsed);
+}
+
+TEST(Fan_out, abandoned_calls_are_bounded) {
+  const auto wait_for_abandoned_calls = []() {
+    for (int i = 0; i < 500 && detail::g_abandoned_fan_out_calls > 0; ++i) {
+      std::this_thread::sleep_for(10ms);
+    }
+
+    return detail::g_abandoned_fan_out_calls.load();
+  };
+
+  // calls abandoned by the other tests need to finish first
+  ASSERT_EQ(0, wait_for_abandoned_calls());
+
+  const auto calls = k_max_abandoned_fan_out_calls + 2;
+  std::promise<void> release;
+  const auto released = release.get_future().share();
+
+  auto running = std::async(std::launch::async, [calls, released]() {
+    return fan_out<int>(
+        std::vector<int>(calls, 1),
+        [released](int i) {
+          released.wait();
+          return i;
+        },
+        calls, 10ms);
+  });
+
+  // the two calls over the limit cannot be abandoned, fan_out() keeps waiting
+  EXPECT_EQ(std::future_status::timeout, running.wait_for(300ms));
+  EXPECT_EQ(k_max_abandoned_fan_out_calls,
+            detail::g_abandoned_fan_out_calls.load());
+
+  release.set_value();
+
+  const auto results = running.get();
+  ASSERT_EQ(calls, results.size());
+
+  std::size_t timed_out = 0;
+
+  for (const auto &result : results) {
+    if (result.timed_out) {
+      ++timed_out;
+    } else {
+      EXPECT_EQ(1, result.get());
+    }
+  }
+
+  // the remaining calls either finish or are abandoned once the limit allows
+  EXPECT_LE(k_max_abandoned_fan_out_calls, timed_out);
+
+  EXPECT_EQ(0, wait_for_abandoned_calls());
+}
+
+TEST(Fan_out, empty) {
+  EXPECT_TRUE(
+      fan_out<int>(std::vector<int>{}, [](int i) { return i; }, 4, 0ms)
+          .empty());
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+TEST(Work_stealing_queue, fifo) {
+  Work_stealing_queue<int> queue{4};
+
+  for (int i = 1; i <= 100; ++i) {
+    queue.push(i);
+  }
+
+  EXPECT_EQ(100, queue.size());
+
+  for (int i = 1; i <= 100; ++i) {
+    EXPECT_EQ(i, queue.pop());
+  }
+
+  EXPECT_EQ(0, queue.size());
+}
+
+TEST(Work_stealing_queue, priorities) {
+  Work_stealing_queue<std::string> queue{4};
+
+  queue.push("low 1", Queue_priority::LOW);
+  queue.push("medium 1");
+  queue.push("high 1", Queue_priority::HIGH);
+  queue.shutdown(1);
+  queue.push("medium 2", Queue_priority::MEDIUM);
+  queue.push("high 2", Queue_priority::HIGH);
+  queue.push("low 2", Queue_priority::LOW);
+
+  EXPECT_EQ("high 1", queue.pop());
+  EXPECT_EQ("high 2", queue.pop());
+  EXPECT_EQ("medium 1", queue.pop());
+  EXPECT_EQ("medium 2", queue.pop());
+  EXPECT_EQ("low 1", queue.pop());
+  EXPECT_EQ("low 2", queue.pop());
+  // shutdown guard is popped last
+  EXPECT_EQ("", queue.pop());
+}
+
+TEST(Work_stealing_queue, try_pop) {
+  Work_stealing_queue<std::unique_ptr<int>> queue{4};
+
+  EXPECT_FALSE(queue.try_pop(std::chrono::milliseconds{1}));
+
+  queue.push(std::make_unique<int>(7));
+
+  const auto item = queue.try_pop(std::chrono::milliseconds{1});
+  ASSERT_TRUE(item);
+  ASSERT_NE(nullptr, item->get());
+  EXPECT_EQ(7, **item);
+
+  EXPECT_FALSE(queue.try_pop(std::chrono::milliseconds{1}));
+
+  // item pushed by another thread wakes up the waiting consumer
+  std::thread producer{[&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    queue.push(std::make_unique<int>(8));
+  }};
+
+  const auto stolen = queue.try_pop(std::chrono::seconds{10});
+  producer.join();
+
+  ASSERT_TRUE(stolen);
+  EXPECT_EQ(8, **stolen);
+}
+
+TEST(Work_stealing_queue, shutdown) {
+  Work_stealing_queue<std::unique_ptr<int>> queue{2};
+  std::atomic<int> popped{0};
+  std::vector<std::thread> consumers;
+
+  for (int i = 0; i < 8; ++i) {
+    consumers.emplace_back([&queue, &popped]() {
+      while (queue.pop()) {
+        ++popped;
+      }
+    });
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    queue.push(std::make_unique<int>(i));
+  }
+
+  queue.shutdown(8);
+
+  for (auto &consumer : consumers) {
+    consumer.join();
+  }
+
+  EXPECT_EQ(100, popped);
+  EXPECT_EQ(0, queue.size());
+}
+
+TEST(Work_stealing_queue, multiple_producers_and_consumers) {
+  constexpr int k_producers = 8;
+  constexpr int k_consumers = 16;
+  constexpr int k_items = 10000;
+
+  Work_stealing_queue<int> queue{4};
+  std::atomic<int64_t> sum{0};
+  std::atomic<int> count{0};
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < k_consumers; ++i) {
+    threads.emplace_back([&]() {
+      // consumers also produce items, which are mostly consumed by themselves
+      int value;
+
+      while ((value = queue.pop()) != 0) {
+        if (value < 0) {
+          queue.push(-value);
+        } else {
+          sum += value;
+          ++count;
+        }
+      }
+    });
+  }
+
+  std::vector<std::thread> producers;
+
+  for (int i = 0; i < k_producers; ++i) {
+    producers.emplace_back([&queue]() {
+      for (int v = 1; v <= k_items; ++v) {
+        queue.push(v % 2 ? v : -v,
+                   v % 3 ? Queue_priority::MEDIUM : Queue_priority::HIGH);
+      }
+    });
+  }
+
+  for (auto &producer : producers) {
+    producer.join();
+  }
+
+  // wait for all the items to be consumed, as consumers push items too
+  while (count < k_producers * k_items) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+
+  queue.shutdown(k_consumers);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(static_cast<int64_t>(k_producers) * k_items * (k_items + 1) / 2,
+            sum);
+  EXPECT_EQ(0, queue.size());
+}
+
+}  // namespace shcore
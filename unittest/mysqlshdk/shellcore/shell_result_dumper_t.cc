@@ -22,7 +22,13 @@
  */
 
 #include <gtest_clean.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
 #include "mysqlshdk/include/shellcore/shell_resultset_dumper.h"
+#include "mysqlshdk/libs/db/mutable_result.h"
 
 using Print_flags = mysqlsh::Print_flags;
 using Print_flag = mysqlsh::Print_flag;
@@ -67,3 +73,129 @@ TEST(Resultset_dumper, get_data_sizes) {
   // Multibyte character 3 bytes represented in 2 spaces
   TEST_DATA_SIZES("I 爱 MySQL Shell\0", 17, Print_flags(), 16, 17);
 }
+
+namespace {
+
+using mysqlshdk::db::Mutable_result;
+using mysqlshdk::db::Type;
+
+class Counting_printer : public mysqlsh::Resultset_printer {
+ public:
+  void print(const std::string &s) override {
+    m_output += s;
+    ++calls;
+  }
+
+  void println(const std::string &s) override { print(s + "\n"); }
+
+  void raw_print(const std::string &s) override { print(s); }
+
+  std::string data() const override { return m_output; }
+
+  int calls = 0;
+
+ private:
+  std::string m_output;
+};
+
+class Test_writer : public mysqlsh::Resultset_writer {
+ public:
+  Test_writer(mysqlshdk::db::IResult *target, const std::string &format,
+              Counting_printer *printer)
+      : Resultset_writer(target, std::unique_ptr<Counting_printer>(printer),
+                         "off", format) {}
+
+  std::string tabbed() {
+    dump_tabbed();
+    return m_printer->data();
+  }
+
+  std::string table() {
+    dump_table();
+    return m_printer->data();
+  }
+
+  std::string documents() {
+    dump_documents(false);
+    return m_printer->data();
+  }
+};
+
+std::unique_ptr<Mutable_result> make_result() {
+  auto result = std::make_unique<Mutable_result>(
+      std::vector<mysqlshdk::db::Column>{
+          Mutable_result::make_column("id", Type::Integer),
+          Mutable_result::make_column("name", Type::String),
+          Mutable_result::make_column("data", Type::Bytes)});
+
+  result->append(1, "one", "\x01");
+  result->append(2, std::string("a\tb\nc\\d\0e", 9), nullptr);
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Resultset_dumper, tabbed) {
+  const auto result = make_result();
+  const auto printer = new Counting_printer();
+  Test_writer writer{result.get(), "tabbed", printer};
+
+  EXPECT_EQ(
+      "id\tname\tdata\n"
+      "1\tone\t0x01\n"
+      "2\ta\\tb\\nc\\\\d\\0e\tNULL\n",
+      writer.tabbed());
+  // output is passed to the printer in blocks
+  EXPECT_EQ(1, printer->calls);
+}
+
+TEST(Resultset_dumper, tabbed_long_value) {
+  const std::string value(2000, 'x');
+  Mutable_result result{std::vector<mysqlshdk::db::Column>{
+      Mutable_result::make_column("v", Type::String)}};
+  result.append(value + "\t");
+
+  const auto printer = new Counting_printer();
+  Test_writer writer{&result, "tabbed", printer};
+
+  // values which are too long are not escaped
+  EXPECT_EQ("v\n" + value + "\t\n", writer.tabbed());
+}
+
+TEST(Resultset_dumper, table) {
+  Mutable_result result{std::vector<mysqlshdk::db::Column>{
+      Mutable_result::make_column("id", Type::Integer),
+      Mutable_result::make_column("name", Type::String),
+      Mutable_result::make_column("data", Type::Bytes)}};
+  result.append(1, "one", "\x01");
+  result.append(2, "two", nullptr);
+
+  const auto printer = new Counting_printer();
+  Test_writer writer{&result, "table", printer};
+
+  EXPECT_EQ(
+      "+----+------+------+\n"
+      "| id | name | data |\n"
+      "+----+------+------+\n"
+      "|  1 | one  | 0x01 |\n"
+      "|  2 | two  | NULL |\n"
+      "+----+------+------+\n",
+      writer.table());
+  EXPECT_EQ(1, printer->calls);
+}
+
+TEST(Resultset_dumper, json_raw) {
+  Mutable_result result{std::vector<mysqlshdk::db::Column>{
+      Mutable_result::make_column("id", Type::Integer),
+      Mutable_result::make_column("name", Type::String)}};
+  result.append(1, "one");
+  result.append(2, "two");
+
+  const auto printer = new Counting_printer();
+  Test_writer writer{&result, "json/raw", printer};
+
+  EXPECT_EQ("{\"id\":1,\"name\":\"one\"}\n{\"id\":2,\"name\":\"two\"}\n",
+            writer.documents());
+  EXPECT_EQ(1, printer->calls);
+}
@@ -224,11 +224,30 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "zstd".
+            "gzip", "zstd", "lz4". Default: "zstd".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
 
+--encodeBinaryOnClient=<bool>
+            Fetch the values of binary columns (BINARY, VARBINARY, BLOB and
+            GEOMETRY) as they are and encode them on the client, instead of
+            encoding them on the server using TO_BASE64(). Reduces the load on
+            the server and the amount of data transferred, contents of the dump
+            files are the same. Default: false.
+
+--parallelUploads=<uint>
+            Number of parts of a dump file which are uploaded concurrently in
+            the background when dumping to an object storage, while the next
+            part is being written. If set to 0, parts are uploaded by the thread
+            which writes the file. Default: 0.
+
+--uploadMemoryLimit=<str>
+            Maximum amount of memory held by the parts of a single dump file
+            which are being uploaded in the background, supports the same unit
+            suffixes as maxRate. At least one part is always uploaded. Default:
+            not set.
+
 --dialect=<str>
             Setup fields and lines options that matches specific data file
             format. Can be used as base dialect and customized with
@@ -270,6 +289,24 @@ OPTIONS
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--compressionThreads=<uint>
+            Maximum number of zstd worker threads used to compress a single
+            data file, 0 disables them. Worker threads are used only when fewer
+            data chunks remain to be dumped than the number of threads, so that
+            the threads which would be idle compress the remaining files in
+            parallel. Default: 0.
+
+--metricsFormat=<str>
+            Collect per-table metrics of the data dump: number of chunks, rows,
+            uncompressed bytes and bytes written to the files, time spent
+            waiting for the first rows, fetching the rows, encoding them,
+            compressing and writing the files and waiting due to maxRate. The
+            metrics are written to the "@.metrics.json" file if set to "json",
+            or to the "@.metrics.prom" file in the Prometheus text format if set
+            to "prometheus". The file is rewritten every 5 seconds while the
+            data is being dumped. The JSON format also includes the metrics of
+            each chunk. Default: not set.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -463,11 +500,30 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "zstd".
+            "gzip", "zstd", "lz4". Default: "zstd".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
 
+--encodeBinaryOnClient=<bool>
+            Fetch the values of binary columns (BINARY, VARBINARY, BLOB and
+            GEOMETRY) as they are and encode them on the client, instead of
+            encoding them on the server using TO_BASE64(). Reduces the load on
+            the server and the amount of data transferred, contents of the dump
+            files are the same. Default: false.
+
+--parallelUploads=<uint>
+            Number of parts of a dump file which are uploaded concurrently in
+            the background when dumping to an object storage, while the next
+            part is being written. If set to 0, parts are uploaded by the thread
+            which writes the file. Default: 0.
+
+--uploadMemoryLimit=<str>
+            Maximum amount of memory held by the parts of a single dump file
+            which are being uploaded in the background, supports the same unit
+            suffixes as maxRate. At least one part is always uploaded. Default:
+            not set.
+
 --dialect=<str>
             Setup fields and lines options that matches specific data file
             format. Can be used as base dialect and customized with
@@ -509,6 +565,24 @@ OPTIONS
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--compressionThreads=<uint>
+            Maximum number of zstd worker threads used to compress a single
+            data file, 0 disables them. Worker threads are used only when fewer
+            data chunks remain to be dumped than the number of threads, so that
+            the threads which would be idle compress the remaining files in
+            parallel. Default: 0.
+
+--metricsFormat=<str>
+            Collect per-table metrics of the data dump: number of chunks, rows,
+            uncompressed bytes and bytes written to the files, time spent
+            waiting for the first rows, fetching the rows, encoding them,
+            compressing and writing the files and waiting due to maxRate. The
+            metrics are written to the "@.metrics.json" file if set to "json",
+            or to the "@.metrics.prom" file in the Prometheus text format if set
+            to "prometheus". The file is rewritten every 5 seconds while the
+            data is being dumped. The JSON format also includes the metrics of
+            each chunk. Default: not set.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -683,11 +757,30 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "zstd".
+            "gzip", "zstd", "lz4". Default: "zstd".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
 
+--encodeBinaryOnClient=<bool>
+            Fetch the values of binary columns (BINARY, VARBINARY, BLOB and
+            GEOMETRY) as they are and encode them on the client, instead of
+            encoding them on the server using TO_BASE64(). Reduces the load on
+            the server and the amount of data transferred, contents of the dump
+            files are the same. Default: false.
+
+--parallelUploads=<uint>
+            Number of parts of a dump file which are uploaded concurrently in
+            the background when dumping to an object storage, while the next
+            part is being written. If set to 0, parts are uploaded by the thread
+            which writes the file. Default: 0.
+
+--uploadMemoryLimit=<str>
+            Maximum amount of memory held by the parts of a single dump file
+            which are being uploaded in the background, supports the same unit
+            suffixes as maxRate. At least one part is always uploaded. Default:
+            not set.
+
 --dialect=<str>
             Setup fields and lines options that matches specific data file
             format. Can be used as base dialect and customized with
@@ -729,6 +822,24 @@ OPTIONS
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--compressionThreads=<uint>
+            Maximum number of zstd worker threads used to compress a single
+            data file, 0 disables them. Worker threads are used only when fewer
+            data chunks remain to be dumped than the number of threads, so that
+            the threads which would be idle compress the remaining files in
+            parallel. Default: 0.
+
+--metricsFormat=<str>
+            Collect per-table metrics of the data dump: number of chunks, rows,
+            uncompressed bytes and bytes written to the files, time spent
+            waiting for the first rows, fetching the rows, encoding them,
+            compressing and writing the files and waiting due to maxRate. The
+            metrics are written to the "@.metrics.json" file if set to "json",
+            or to the "@.metrics.prom" file in the Prometheus text format if set
+            to "prometheus". The file is rewritten every 5 seconds while the
+            data is being dumped. The JSON format also includes the metrics of
+            each chunk. Default: not set.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -872,11 +983,30 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "none".
+            "gzip", "zstd", "lz4". Default: "none".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
 
+--encodeBinaryOnClient=<bool>
+            Fetch the values of binary columns (BINARY, VARBINARY, BLOB and
+            GEOMETRY) as they are and encode them on the client, instead of
+            encoding them on the server using TO_BASE64(). Reduces the load on
+            the server and the amount of data transferred, contents of the dump
+            files are the same. Default: false.
+
+--parallelUploads=<uint>
+            Number of parts of a dump file which are uploaded concurrently in
+            the background when dumping to an object storage, while the next
+            part is being written. If set to 0, parts are uploaded by the thread
+            which writes the file. Default: 0.
+
+--uploadMemoryLimit=<str>
+            Maximum amount of memory held by the parts of a single dump file
+            which are being uploaded in the background, supports the same unit
+            suffixes as maxRate. At least one part is always uploaded. Default:
+            not set.
+
 --dialect=<str>
             Setup fields and lines options that matches specific data file
             format. Can be used as base dialect and customized with
@@ -916,6 +1046,14 @@ OPTIONS
             A list of valid partition names used to limit the data export to
             just the specified partitions. Default: not set.
 
+--compressionFrameSize=<str>
+            Write the zstd compressed data as independently compressed frames,
+            each holding at most the given number of uncompressed bytes,
+            followed by a seek table (zstd seekable format), which allows the
+            file to be read from any frame. Can only be used if the compression
+            option is set to "zstd". Supports the same unit suffixes as maxRate.
+            Default: not set.
+
 --osBucketName=<str>
             Use specified OCI bucket for the location of the dump. Default: not
             set.
@@ -1399,6 +1537,19 @@ OPTIONS
             continues, "ignore": ignores the error and continues loading the
             account.
 
+--parallelDownloads=<uint>
+            Number of ranged requests which are used to concurrently fetch the
+            data of a dump file ahead of the current read position, when loading
+            from an object storage. If set to 0, data is fetched by the thread
+            which reads the file. Default: 0.
+
+--downloadMemoryLimit=<str>
+            Maximum amount of memory held by the data of a single dump file
+            which is fetched ahead of the current read position, when loading
+            from an object storage, supports the same unit suffixes as
+            maxBytesPerTransaction. At least one chunk is always fetched.
+            Default: not set.
+
 --osBucketName=<str>
             Use specified OCI bucket for the location of the dump. Default: not
             set.
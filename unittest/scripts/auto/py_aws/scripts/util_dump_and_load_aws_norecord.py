@@ -399,6 +399,42 @@ EXPECT_STDOUT_CONTAINS(f"1 tables in 1 schemas were loaded")
 #@<> BUG#34599319 - cleanup
 dump_session.run_sql("DROP SCHEMA IF EXISTS !;", [ tested_schema ])
 
+#@<> parallelUploads and uploadMemoryLimit
+for upload_options in [ { "parallelUploads": 2 }, { "parallelUploads": 4, "uploadMemoryLimit": "1k" } ]:
+    setup_session(__sandbox_uri1)
+    clean_bucket()
+    EXPECT_NO_THROWS(lambda: util.dump_schemas([ "world" ], dump_dir, get_options({ **upload_options, "bytesPerChunk": "128k" })), f"dump with {upload_options}")
+    setup_session(__sandbox_uri2)
+    wipeout_server(session)
+    EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, get_options()), f"load of a dump created with {upload_options}")
+    EXPECT_STDOUT_CONTAINS("3 tables in 1 schemas were loaded")
+
+#@<> parallelDownloads
+setup_session(__sandbox_uri1)
+clean_bucket()
+util.dump_schemas([ "world" ], dump_dir, get_options({ "bytesPerChunk": "128k" }))
+
+for parallel_downloads in [ 1, 4 ]:
+    setup_session(__sandbox_uri2)
+    wipeout_server(session)
+    EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, get_options({ "parallelDownloads": parallel_downloads })), f"load with parallelDownloads: {parallel_downloads}")
+    EXPECT_STDOUT_CONTAINS("3 tables in 1 schemas were loaded")
+
+#@<> parallelDownloads requires an object storage
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, { "parallelDownloads": 4 }), "ValueError: Util.load_dump: Argument #2: The 'parallelDownloads' option can only be used when loading from an object storage.")
+
+#@<> downloadMemoryLimit
+for download_options in [ { "parallelDownloads": 4, "downloadMemoryLimit": "1" }, { "parallelDownloads": 4, "downloadMemoryLimit": "20M" } ]:
+    setup_session(__sandbox_uri2)
+    wipeout_server(session)
+    EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, get_options(download_options)), f"load with {download_options}")
+    EXPECT_STDOUT_CONTAINS("3 tables in 1 schemas were loaded")
+
+#@<> downloadMemoryLimit - invalid values
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, get_options({ "downloadMemoryLimit": 1024 })), "TypeError: Util.load_dump: Argument #2: Option 'downloadMemoryLimit' is expected to be of type String, but is Integer")
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, get_options({ "downloadMemoryLimit": "" })), "ValueError: Util.load_dump: Argument #2: The option 'downloadMemoryLimit' cannot be set to an empty string.")
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, { "downloadMemoryLimit": "64M" }), "ValueError: Util.load_dump: Argument #2: The 'downloadMemoryLimit' option can only be used when loading from an object storage.")
+
 #@<> BUG#34604763 - new s3Region option
 with write_profile(local_aws_config_file, "profile " + local_aws_profile, { "region": "invalid" }):
     with write_profile(local_aws_credentials_file, local_aws_profile, { "aws_access_key_id": aws_settings["aws_access_key_id"], "aws_secret_access_key": aws_settings["aws_secret_access_key"] }):
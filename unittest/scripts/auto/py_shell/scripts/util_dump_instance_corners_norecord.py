@@ -104,5 +104,92 @@ CHECK_OUTPUT_SANITY(dump_dir, min_chunk_size = row_length, min_chunks = rows)
 #@<> BUG#32955616 - cleanup
 session.run_sql("DROP SCHEMA !;", [ tested_schema ])
 
+#@<> chunking corner cases - setup
+chunking_schema = "chunking"
+session.run_sql("CREATE SCHEMA !", [ chunking_schema ])
+
+def create_chunking_table(table, key, values):
+    session.run_sql(f"CREATE TABLE !.! (id {key}, data TEXT)", [ chunking_schema, table ])
+    for i in range(0, len(values), 100):
+        rows = ",".join(f"({v}, REPEAT('x', 1000))" for v in values[i:i + 100])
+        session.run_sql(f"INSERT INTO !.! VALUES {rows}", [ chunking_schema, table ])
+    session.run_sql("ANALYZE TABLE !.!", [ chunking_schema, table ])
+
+def chunk_files(outdir, table):
+    # chunk files of the given table, ordered by the chunk index
+    prefix = encode_table_basename(chunking_schema, table) + "@"
+    files = {}
+    for f in os.listdir(outdir):
+        if f.startswith(prefix) and f.endswith(".tsv"):
+            files[int(f[len(prefix):-len(".tsv")].lstrip("@"))] = os.path.join(outdir, f)
+    return [files[i] for i in sorted(files)]
+
+def chunk_rows(outdir, table):
+    rows = []
+    for f in chunk_files(outdir, table):
+        with open(f, "rb") as fh:
+            rows.append(fh.read().count(b"\n"))
+    return rows
+
+def last_chunk_contains(outdir, table, key):
+    with open(chunk_files(outdir, table)[-1], "rb") as fh:
+        return f"{key}\t".encode() in fh.read()
+
+def EXPECT_CHUNK_STATS(table, chunks, stats = r"\d+\.\d, variance \d+\.\d, standard deviation \d+\.\d"):
+    EXPECT_SHELL_LOG_MATCHES(re.compile(f"Table `{chunking_schema}`\\.`{table}` was chunked in \\d+\\.\\d+ seconds and written to {chunks}, rows per chunk: average {stats}"))
+
+# most of the values are dense, the rest is spread over a huge range
+create_chunking_table("skewed", "BIGINT PRIMARY KEY", list(range(1, 901)) + [10**12 + i * 10**9 for i in range(100)])
+create_chunking_table("empty", "INT PRIMARY KEY", [])
+create_chunking_table("single", "INT PRIMARY KEY", [ 1 ])
+# NULL keys and the maximum value of the key at the end of the range
+null_values = 20
+create_chunking_table("nullkey", "BIGINT UNSIGNED NULL UNIQUE KEY", ["NULL"] * null_values + list(range(500)) + [18446744073709551615 - i for i in range(10)])
+# dense values at the end of the range, chunked with a constant step
+create_chunking_table("boundary", "BIGINT PRIMARY KEY", [9223372036854775807 - i for i in range(1000)])
+
+chunking_dir = os.path.join(dumpdir, "chunking")
+WIPE_SHELL_LOG()
+util.dump_schemas([ chunking_schema ], chunking_dir, { "bytesPerChunk": "128k", "compression": "none", "showProgress": False })
+
+#@<> chunking corner cases - skewed integer key
+EXPECT_SHELL_LOG_CONTAINS("Chunking `chunking`.`skewed` using index walk")
+rows = chunk_rows(chunking_dir, "skewed")
+EXPECT_LT(1, len(rows))
+EXPECT_EQ(1000, sum(rows))
+# index walk creates chunks with the same number of rows, the last one may be smaller
+EXPECT_EQ([ rows[0] ] * (len(rows) - 1), rows[:-1])
+EXPECT_GE(rows[0], rows[-1])
+EXPECT_CHUNK_STATS("skewed", f"{len(rows)} chunks")
+
+#@<> chunking corner cases - empty table
+EXPECT_EQ([ 0 ], chunk_rows(chunking_dir, "empty"))
+EXPECT_CHUNK_STATS("empty", "1 chunk", r"0\.0, variance 0\.0, standard deviation 0\.0")
+
+#@<> chunking corner cases - single row
+EXPECT_EQ([ 1 ], chunk_rows(chunking_dir, "single"))
+EXPECT_CHUNK_STATS("single", "1 chunk", r"1\.0, variance 0\.0, standard deviation 0\.0")
+
+#@<> chunking corner cases - NULL and maximum key
+EXPECT_SHELL_LOG_CONTAINS("Chunking `chunking`.`nullkey` using index walk")
+rows = chunk_rows(chunking_dir, "nullkey")
+EXPECT_LT(2, len(rows))
+EXPECT_EQ(null_values + 510, sum(rows))
+# rows with NULL keys are written to the first chunk
+EXPECT_EQ(rows[1] + null_values, rows[0])
+EXPECT_TRUE(last_chunk_contains(chunking_dir, "nullkey", 18446744073709551615))
+EXPECT_CHUNK_STATS("nullkey", f"{len(rows)} chunks")
+
+#@<> chunking corner cases - maximum key with constant step
+EXPECT_SHELL_LOG_CONTAINS("Chunking `chunking`.`boundary` using integer algorithm with constant step")
+rows = chunk_rows(chunking_dir, "boundary")
+EXPECT_LT(1, len(rows))
+EXPECT_EQ(1000, sum(rows))
+EXPECT_TRUE(last_chunk_contains(chunking_dir, "boundary", 9223372036854775807))
+EXPECT_CHUNK_STATS("boundary", f"{len(rows)} chunks")
+
+#@<> chunking corner cases - cleanup
+session.run_sql("DROP SCHEMA !", [ chunking_schema ])
+
 #@<> cleanup
 testutil.destroy_sandbox(__mysql_sandbox_port1)
@@ -821,6 +821,20 @@ EXPECT_FAIL("ValueError", "Argument #2: Unknown compression type: dummy", test_o
 EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "zstd", "chunking": False, "showProgress": False })
 EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.zst")))
 
+#@<> compressionThreads requires zstd compression
+EXPECT_FAIL("ValueError", "Argument #2: The 'compressionThreads' option can only be used if the 'compression' option is set to 'zstd'.", test_output_relative, { "compression": "gzip", "compressionThreads": 2 })
+EXPECT_FAIL("ValueError", "Argument #2: The 'compressionThreads' option can only be used if the 'compression' option is set to 'zstd'.", test_output_relative, { "compression": "none", "compressionThreads": 2 })
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "gzip", "compressionThreads": 0, "chunking": False, "showProgress": False })
+
+#@<> parallelUploads and uploadMemoryLimit require an object storage
+TEST_UINT_OPTION("parallelUploads")
+TEST_STRING_OPTION("uploadMemoryLimit")
+EXPECT_FAIL("ValueError", "Argument #2: The option 'uploadMemoryLimit' cannot be set to an empty string.", test_output_relative, { "uploadMemoryLimit": "" })
+EXPECT_FAIL("ValueError", 'Argument #2: Wrong input number "dummy"', test_output_relative, { "uploadMemoryLimit": "dummy" })
+EXPECT_FAIL("ValueError", "The 'parallelUploads' option can only be used when dumping to an object storage.", test_output_relative, { "parallelUploads": 2 })
+EXPECT_FAIL("ValueError", "The 'uploadMemoryLimit' option can only be used when dumping to an object storage.", test_output_relative, { "uploadMemoryLimit": "10M" })
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "parallelUploads": 0, "chunking": False, "showProgress": False })
+
 #@<> WL13807: WL13804-FR5.3.2 - If the `compression` option is not given, a default value of `"none"` must be used instead.
 # WL13807-FR3 - Both new functions must accept the following options specified in WL#13804, FR5:
 # * The `compression` option specified in WL#13804, FR5.3, with the modification of FR5.3.2, the default value must be`"zstd"`.
@@ -689,6 +689,27 @@ TEST_LOAD(test_schema, custom_dialect_table, { "linesTerminatedBy": "a" })
 TEST_LOAD(test_schema, custom_dialect_table, { "fieldsEnclosedBy": '"', "fieldsOptionallyEnclosed": False , "linesTerminatedBy": "a"})
 TEST_LOAD(test_schema, custom_dialect_table, { "fieldsEnclosedBy": '"', "fieldsOptionallyEnclosed": False , "linesTerminatedBy": "ab"})
 
+#@<> compressionFrameSize - zstd seekable format
+TEST_STRING_OPTION("compressionFrameSize")
+EXPECT_FAIL("ValueError", "Argument #3: The option 'compressionFrameSize' cannot be set to an empty string.", quote(test_schema, custom_dialect_table), test_output_relative, { "compressionFrameSize": "" })
+EXPECT_FAIL("ValueError", "Argument #3: The 'compressionFrameSize' option can only be used if the 'compression' option is set to 'zstd'.", quote(test_schema, custom_dialect_table), test_output_relative, { "compressionFrameSize": "1k" })
+EXPECT_FAIL("ValueError", "Argument #3: The 'compressionFrameSize' option can only be used if the 'compression' option is set to 'zstd'.", quote(test_schema, custom_dialect_table), test_output_relative, { "compression": "gzip", "compressionFrameSize": "1k" })
+
+EXPECT_SUCCESS(quote(test_schema, custom_dialect_table), test_output_absolute, { "compression": "zstd", "compressionFrameSize": "1k", "showProgress": False })
+EXPECT_EQ(ZSTD_MAGIC_NUMBER, get_magic_number(test_output_absolute, 4))
+
+with open(test_output_absolute, "rb") as f:
+    # the file ends with the seek table footer
+    EXPECT_EQ("B1EA928F", f.read()[-4:].hex().upper())
+
+# the frames are loaded as a regular zstd file
+seekable_output = test_output_absolute + ".zst"
+shutil.move(test_output_absolute, seekable_output)
+recreate_verification_schema()
+session.run_sql("CREATE TABLE !.! LIKE !.!;", [verification_schema, verification_table, test_schema, custom_dialect_table])
+util.import_table(seekable_output, { "schema": verification_schema, "table": verification_table, "characterSet": "utf8mb4", "showProgress": False })
+EXPECT_EQ(md5_table(session, test_schema, custom_dialect_table), md5_table(session, verification_schema, verification_table))
+
 session.run_sql("DROP TABLE !.!;", [ test_schema, custom_dialect_table ])
 
 #@<> WL13804-FR5.9 - fixed-row format is not supported yet
@@ -276,8 +276,35 @@ DESCRIPTION
         otherwise) - Enable or disable dump progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
+      - encodeBinaryOnClient: bool (default: false) - Fetch the values of binary
+        columns (BINARY, VARBINARY, BLOB and GEOMETRY) as they are and encode
+        them on the client, instead of encoding them on the server using
+        TO_BASE64(). Reduces the load on the server and the amount of data
+        transferred, contents of the dump files are the same.
+      - parallelUploads: int (default: 0) - Number of parts of a dump file which
+        are uploaded concurrently in the background when dumping to an object
+        storage, while the next part is being written. If set to 0, parts are
+        uploaded by the thread which writes the file.
+      - uploadMemoryLimit: string (default: not set) - Maximum amount of memory
+        held by the parts of a single dump file which are being uploaded in the
+        background, supports the same unit suffixes as maxRate. At least one
+        part is always uploaded.
       - compression: string (default: "zstd") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "zstd", "lz4".
+      - compressionThreads: int (default: 0) - Maximum number of zstd worker
+        threads used to compress a single data file, 0 disables them. Worker
+        threads are used only when fewer data chunks remain to be dumped than
+        the number of threads, so that the threads which would be idle compress
+        the remaining files in parallel.
+      - metricsFormat: string (default: not set) - Collect per-table metrics of
+        the data dump: number of chunks, rows, uncompressed bytes and bytes
+        written to the files, time spent waiting for the first rows, fetching
+        the rows, encoding them, compressing and writing the files and waiting
+        due to maxRate. The metrics are written to the "@.metrics.json" file if
+        set to "json", or to the "@.metrics.prom" file in the Prometheus text
+        format if set to "prometheus". The file is rewritten every 5 seconds
+        while the data is being dumped. The JSON format also includes the
+        metrics of each chunk.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -838,8 +865,35 @@ DESCRIPTION
         otherwise) - Enable or disable dump progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
+      - encodeBinaryOnClient: bool (default: false) - Fetch the values of binary
+        columns (BINARY, VARBINARY, BLOB and GEOMETRY) as they are and encode
+        them on the client, instead of encoding them on the server using
+        TO_BASE64(). Reduces the load on the server and the amount of data
+        transferred, contents of the dump files are the same.
+      - parallelUploads: int (default: 0) - Number of parts of a dump file which
+        are uploaded concurrently in the background when dumping to an object
+        storage, while the next part is being written. If set to 0, parts are
+        uploaded by the thread which writes the file.
+      - uploadMemoryLimit: string (default: not set) - Maximum amount of memory
+        held by the parts of a single dump file which are being uploaded in the
+        background, supports the same unit suffixes as maxRate. At least one
+        part is always uploaded.
       - compression: string (default: "zstd") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "zstd", "lz4".
+      - compressionThreads: int (default: 0) - Maximum number of zstd worker
+        threads used to compress a single data file, 0 disables them. Worker
+        threads are used only when fewer data chunks remain to be dumped than
+        the number of threads, so that the threads which would be idle compress
+        the remaining files in parallel.
+      - metricsFormat: string (default: not set) - Collect per-table metrics of
+        the data dump: number of chunks, rows, uncompressed bytes and bytes
+        written to the files, time spent waiting for the first rows, fetching
+        the rows, encoding them, compressing and writing the files and waiting
+        due to maxRate. The metrics are written to the "@.metrics.json" file if
+        set to "json", or to the "@.metrics.prom" file in the Prometheus text
+        format if set to "prometheus". The file is rewritten every 5 seconds
+        while the data is being dumped. The JSON format also includes the
+        metrics of each chunk.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -1377,8 +1431,35 @@ DESCRIPTION
         otherwise) - Enable or disable dump progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
+      - encodeBinaryOnClient: bool (default: false) - Fetch the values of binary
+        columns (BINARY, VARBINARY, BLOB and GEOMETRY) as they are and encode
+        them on the client, instead of encoding them on the server using
+        TO_BASE64(). Reduces the load on the server and the amount of data
+        transferred, contents of the dump files are the same.
+      - parallelUploads: int (default: 0) - Number of parts of a dump file which
+        are uploaded concurrently in the background when dumping to an object
+        storage, while the next part is being written. If set to 0, parts are
+        uploaded by the thread which writes the file.
+      - uploadMemoryLimit: string (default: not set) - Maximum amount of memory
+        held by the parts of a single dump file which are being uploaded in the
+        background, supports the same unit suffixes as maxRate. At least one
+        part is always uploaded.
       - compression: string (default: "zstd") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "zstd", "lz4".
+      - compressionThreads: int (default: 0) - Maximum number of zstd worker
+        threads used to compress a single data file, 0 disables them. Worker
+        threads are used only when fewer data chunks remain to be dumped than
+        the number of threads, so that the threads which would be idle compress
+        the remaining files in parallel.
+      - metricsFormat: string (default: not set) - Collect per-table metrics of
+        the data dump: number of chunks, rows, uncompressed bytes and bytes
+        written to the files, time spent waiting for the first rows, fetching
+        the rows, encoding them, compressing and writing the files and waiting
+        due to maxRate. The metrics are written to the "@.metrics.json" file if
+        set to "json", or to the "@.metrics.prom" file in the Prometheus text
+        format if set to "prometheus". The file is rewritten every 5 seconds
+        while the data is being dumped. The JSON format also includes the
+        metrics of each chunk.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -1860,6 +1941,12 @@ DESCRIPTION
       - partitions: list of strings (default: not set) - A list of valid
         partition names used to limit the data export to just the specified
         partitions.
+      - compressionFrameSize: string (default: not set) - Write the zstd
+        compressed data as independently compressed frames, each holding at most
+        the given number of uncompressed bytes, followed by a seek table (zstd
+        seekable format), which allows the file to be read from any frame. Can
+        only be used if the compression option is set to "zstd". Supports the
+        same unit suffixes as maxRate.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -1885,8 +1972,21 @@ DESCRIPTION
         otherwise) - Enable or disable dump progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
+      - encodeBinaryOnClient: bool (default: false) - Fetch the values of binary
+        columns (BINARY, VARBINARY, BLOB and GEOMETRY) as they are and encode
+        them on the client, instead of encoding them on the server using
+        TO_BASE64(). Reduces the load on the server and the amount of data
+        transferred, contents of the dump files are the same.
+      - parallelUploads: int (default: 0) - Number of parts of a dump file which
+        are uploaded concurrently in the background when dumping to an object
+        storage, while the next part is being written. If set to 0, parts are
+        uploaded by the thread which writes the file.
+      - uploadMemoryLimit: string (default: not set) - Maximum amount of memory
+        held by the parts of a single dump file which are being uploaded in the
+        background, supports the same unit suffixes as maxRate. At least one
+        part is always uploaded.
       - compression: string (default: "none") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "zstd", "lz4".
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -2565,6 +2665,11 @@ DESCRIPTION
       If you specify one separator that is the same as or a prefix of another,
       LOAD DATA INFILE cannot interpret the input properly.
 
+      A single compressed file is imported using one thread, unless it is a
+      zstd file written in the seekable format (independently compressed frames
+      followed by a seek table), in which case it is split into chunks which
+      are imported in parallel.
+
       Connection options set in the global session, such as compression,
       ssl-mode, etc. are used in parallel connections.
 
@@ -2752,6 +2857,15 @@ DESCRIPTION
         not specified explicitly, the value of the bytesPerChunk dump option is
         used, but only in case of the files with data size greater than 1.5 *
         bytesPerChunk.
+      - parallelDownloads: int (default: 0) - Number of ranged requests which
+        are used to concurrently fetch the data of a dump file ahead of the
+        current read position, when loading from an object storage. If set to 0,
+        data is fetched by the thread which reads the file.
+      - downloadMemoryLimit: string (default: not set) - Maximum amount of
+        memory held by the data of a single dump file which is fetched ahead of
+        the current read position, when loading from an object storage, supports
+        the same unit suffixes as maxBytesPerTransaction. At least one chunk is
+        always fetched.
       - progressFile: path (default: load-progress.<server_uuid>.progress) -
         Stores load progress information in the given local file path.
       - resetProgress: bool (default: false) - Discards progress information of
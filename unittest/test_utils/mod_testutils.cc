@@ -2760,10 +2760,8 @@ void Testutils::inject_gtid_set(int port, const std::string &gtid_set) {
   auto session = connect_to_sandbox(port);
   auto instance = mysqlshdk::mysql::Instance(session);
 
-  auto gtids = mysqlshdk::mysql::Gtid_set::from_string(gtid_set);
-  gtids.normalize(instance);
-
-  mysqlshdk::mysql::inject_gtid_set(instance, gtids);
+  mysqlshdk::mysql::inject_gtid_set(
+      instance, mysqlshdk::mysql::Gtid_set::from_string(gtid_set));
 }
 
 //!<  @name Misc Utilities